@@ -10,12 +10,15 @@
 #include "MainFrm.h"
 #include "utils/PerformUtil.h"
 #include "utils/Log.h"
+#include "core/common/Lang.h"
 
 CAppModule _Module;
 
 int Run(LPTSTR /*lpstrCmdLine*/ = NULL, int nCmdShow = SW_SHOWDEFAULT)
 {
 	auto _begin = PerformUtil::begin();
+	// build the language table before the windows are created
+	Lang::load();
 	CMessageLoop theLoop;
 	_Module.AddMessageLoop(&theLoop);
 
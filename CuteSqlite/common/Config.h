@@ -56,6 +56,7 @@ typedef enum {
 	DATABASE_EXEC_ALL_BUTTON_ID,
 	DATABASE_EXPLAIN_SQL_BUTTON_ID,
 	DATABASE_EXPLAIN_QUREY_PLAN_BUTTON_ID,
+	DATABASE_STOP_SQL_BUTTON_ID,
 	DATABASE_QUERY_BUTTON_ID,
 	DATABASE_HISTORY_BUTTON_ID,
 	// RIGHT VIEW TOOLBAR - SAVE
@@ -457,7 +458,7 @@ typedef enum {
 	MSG_QLISTVIEW_SUBITEM_CHECKBOX_CHANGE_ID, // QListViewCtrlsubItemCheckBoxıʱ򸸴ڷ͸Ϣ,wParam=iItem, lParam=iSubItem
 	MSG_QLISTVIEW_ITEM_CHECKBOX_CHANGE_ID, // QListViewCtrlitemCheckBoxıʱ򸸴ڷ͸Ϣ,wParam=iItem, lParam=iSubItem
 	MSG_QLISTVIEW_COLUMN_CLICK_ID, // QListViewCtrlColumnʱ򸸴ڷ͸Ϣ,wParam=iItem, lParam=(LPNMHEADER)lParam
-	MSG_EXEC_SQL_RESULT_MESSAGE_ID, // ִSQL󣬷صϢwParam- NULLlParam - point of adapter.runtimeResultInfo
+	MSG_EXEC_SQL_RESULT_MESSAGE_ID, // ִSQL󣬷صϢwParam- NULLִSQLQueryPage HWNDlParam - point of adapter.runtimeResultInfo
 	MSG_EXPORT_DB_AS_SQL_PROCESS_ID, // ݿΪSQLԻȵϢ,wParam״̬lParamɰٷֱ
 	MSG_IMPORT_PROCESS_ID, // SQLݿԻȵϢ,wParam״̬lParamɰٷֱ
 	MSG_MENU_ITEM_CLICK_ID, //˵ĳ˵ϢID֪ͨڣָIDĲ˵ 
@@ -535,6 +536,13 @@ typedef enum {
 	MSG_DB_PRAGMA_PARAMS_ID,  // When the tree item(iImage=9) has double clicked in the LeftNavigation, send this msg to RightAnalysisView for open DbPragmaParamsPage, wParam=userDbId, lParam = NULL
 	MSG_DB_QUICK_CONFIG_PARAMS_ID,  // When the tree item(iImage=10) has double clicked in the LeftNavigation, send this msg to RightAnalysisView for open DbQuickConfigParamsPage, wParam=userDbId, lParam = NULL
 	MSG_QPARAMELEM_VAL_CHANGE_ID, // When the QParamElem value has change, send this msg to parent window for setting data dirty. wParam=QParamElem.m_hWnd, lParam=NULL
+	MSG_RESULT_ROWS_CHANGE_ID, // When ResultListPageAdapter fetched more rows from the opened query, send this msg to ResultListPage for displaying the rows, wParam=rows, lParam=isDone(1 - all rows fetched)
+	MSG_RESULT_SORTED_ID, // When the worker thread of ResultListPageAdapter has sorted the result rows, send this msg to ResultListPage for showing the sorted rows, wParam=sortSeq, lParam=NULL
+	MSG_QUERY_EXEC_RESULT_ID, // When the worker thread of QSqlExecutor has executed a statement, send this msg to QueryPage for taking the results, wParam=execSeq, lParam=NULL
+	MSG_QUERY_EXEC_FINISHED_ID, // When the worker thread of QSqlExecutor has finished all the statements, send this msg to QueryPage, wParam=execSeq, lParam=QSqlExecStatus
+	MSG_QUERY_EXEC_STATE_ID, // When QueryPage starts or finishes executing the statements in the worker thread, send this msg to RightWorkView for enabling the stop button, wParam=QueryPage HWND, lParam=isRunning
+	MSG_RESULT_RELEASE_QUERY_ID, // Before the statements are executed by the worker connection or the DDL is executed, send this msg to ResultListPage for closing the opened query, wParam=userDbId, lParam=NULL
+	MSG_RESULT_FETCHED_ID, // When the worker thread of QSqlExecutor has fetched the rows of the opened query, send this msg to ResultListPage for taking the rows, wParam=fetchSeq, lParam=NULL
 	
 }MessageId;
 
@@ -1,6 +1,111 @@
 #include "stdafx.h"
 #include "Lang.h"
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
 #include "core/service/system/SettingService.h"
+#include "utils/PerformUtil.h"
+#include "utils/Log.h"
+
+// the key of language table is the wide chars, the lookup don't construct std::wstring
+struct LangKeyHash {
+	size_t operator()(const wchar_t * key) const
+	{
+		// FNV-1a
+		size_t hash = static_cast<size_t>(14695981039346656037ULL);
+		for (; *key; key++) {
+			hash ^= static_cast<size_t>(*key);
+			hash *= static_cast<size_t>(1099511628211ULL);
+		}
+		return hash;
+	}
+};
+
+struct LangKeyEqual {
+	bool operator()(const wchar_t * key1, const wchar_t * key2) const
+	{
+		return wcscmp(key1, key2) == 0;
+	}
+};
+
+template <typename V>
+using LangMap = std::unordered_map<const wchar_t *, V, LangKeyHash, LangKeyEqual>;
+
+struct LangTable {
+	// the interned keys, the keys of maps point to them
+	std::deque<std::wstring> keys;
+	// [STRING]
+	LangMap<std::wstring> strings;
+	// [ERROR]
+	LangMap<std::wstring> errors;
+	// [FONT]
+	LangMap<int> fontSizes;
+	std::wstring fontName;
+
+	const wchar_t * intern(const std::wstring & key)
+	{
+		keys.push_back(key);
+		return keys.back().c_str();
+	}
+};
+
+// the table is immutable after it has been built, the replaced tables are kept for the references returned by lang()
+static std::atomic<LangTable *> langTable(nullptr);
+static std::vector<std::unique_ptr<LangTable>> langTables;
+static std::mutex langMutex;
+static const std::wstring langEmpty;
+
+static const LangTable & getLangTable()
+{
+	LangTable * table = langTable.load(std::memory_order_acquire);
+	if (table) {
+		return *table;
+	}
+	Lang::load();
+	return *langTable.load(std::memory_order_acquire);
+}
+
+/**
+ * iniļ[STRING],[ERROR],[FONT]ڵ㵽ַ.
+ * ظkeyһֵ, ԭ˳ҵĽһ
+ */
+void Lang::load()
+{
+	auto _begin = PerformUtil::begin();
+	IniSetting iniSetting = SettingService::getInstance()->getAllIniSetting();
+	std::unique_ptr<LangTable> table(new LangTable());
+	for (auto & pair : iniSetting[L"STRING"]) {
+		if (table->strings.find(pair.first.c_str()) == table->strings.end()) {
+			table->strings.emplace(table->intern(pair.first), pair.second);
+		}
+	}
+	for (auto & pair : iniSetting[L"ERROR"]) {
+		if (table->errors.find(pair.first.c_str()) == table->errors.end()) {
+			table->errors.emplace(table->intern(pair.first), pair.second);
+		}
+	}
+	for (auto & pair : iniSetting[L"FONT"]) {
+		if (pair.first == L"font-name") {
+			table->fontName = pair.second;
+			continue;
+		}
+		wchar_t * endPtr = nullptr;
+		long pixel = std::wcstol(pair.second.c_str(), &endPtr, 10);
+		if (endPtr == pair.second.c_str()) {
+			continue;
+		}
+		// the last one is used, the same as the loop of font()
+		table->fontSizes[table->intern(pair.first)] = static_cast<int>(pixel);
+	}
+
+	std::lock_guard<std::mutex> lock(langMutex);
+	langTable.store(table.get(), std::memory_order_release);
+	Q_INFO(L"Lang table load time:{}, strings:{}, errors:{}, fonts:{}", 
+		PerformUtil::end(_begin), table->strings.size(), table->errors.size(), table->fontSizes.size());
+	langTables.push_back(std::move(table));
+}
 
 /**
  * iniļ[STRING]ڵеı.
@@ -8,18 +113,15 @@
  * @param key ıkey
  * @return val 
  */
-std::wstring Lang::lang(const wchar_t * key)
+const std::wstring & Lang::lang(const wchar_t * key)
 {
-	Setting langSetting = SettingService::getInstance()->getSettingBySection(std::wstring(L"STRING"));
-
-	auto iterator = std::find_if(langSetting.begin(), langSetting.end(), [&key](std::pair<std::wstring, std::wstring> & pair) {
-		return pair.first == std::wstring(key);
-	});
-	if (iterator == langSetting.end()) {
-		return L"";
+	const LangTable & table = getLangTable();
+	auto iterator = table.strings.find(key);
+	if (iterator == table.strings.end()) {
+		return langEmpty;
 	}
 
-	return (*iterator).second;
+	return iterator->second;
 }
 
 /**
@@ -28,23 +130,20 @@ std::wstring Lang::lang(const wchar_t * key)
  * @param key ıkey
  * @return val 
  */
-std::wstring Lang::error(const std::wstring & key)
+const std::wstring & Lang::error(const std::wstring & key)
 {
-	Setting langSetting = SettingService::getInstance()->getSettingBySection(std::wstring(L"ERROR"));
-
-	auto iterator = std::find_if(langSetting.begin(), langSetting.end(), [&key](std::pair<std::wstring, std::wstring> & pair) {
-		return pair.first == key;
-	});
-	if (iterator == langSetting.end()) {
-		return L"";
+	const LangTable & table = getLangTable();
+	auto iterator = table.errors.find(key.c_str());
+	if (iterator == table.errors.end()) {
+		return langEmpty;
 	}
 
-	return (*iterator).second;
+	return iterator->second;
 }
 
 std::wstring Lang::langNoTab(const std::wstring & key)
 {
-	auto str = lang(key.c_str());
+	std::wstring str = lang(key.c_str());
 	if (str.empty()) {
 		return str;
 	}
@@ -70,18 +169,8 @@ std::wstring Lang::langNoTab(const std::wstring & key)
  */
 HFONT Lang::font(const wchar_t * key, bool bold /*= false*/, int defPixed, const wchar_t * defFontName)
 {
-	Setting fontSetting = SettingService::getInstance()->getSettingBySection(std::wstring(L"FONT"));
-	int pixel = defPixed; // Ĭֵ
-	
-	std::wstring fontName = defFontName;
-	for (auto iterator = fontSetting.begin(); iterator != fontSetting.end(); iterator++) {
-		if ((*iterator).first == key) {
-			pixel = std::stoi((*iterator).second);
-		}
-		if ((*iterator).first == L"font-name") {
-			fontName = (*iterator).second;
-		}
-	}	
+	int pixel = fontSize(key, defPixed);
+	std::wstring fontName = Lang::fontName(defFontName);
 
 	LOGFONT lf; 
 	memset(&lf, 0, sizeof(LOGFONT)); // zero out structure 
@@ -106,18 +195,8 @@ HFONT Lang::font(const wchar_t * key, bool bold /*= false*/, int defPixed, const
  */
 Gdiplus::Font * Lang::gdiplusFont(const wchar_t * key, bool bold /*= false*/, int defPixed /*= 20*/, const wchar_t * defFontName /*= L"Microsoft Yahei UI"*/)
 {
-	Setting fontSetting = SettingService::getInstance()->getSettingBySection(std::wstring(L"FONT"));
-	int pixel = defPixed; // Ĭֵ
-	
-	std::wstring fontName = defFontName;
-	for (auto iterator = fontSetting.begin(); iterator != fontSetting.end(); iterator++) {
-		if ((*iterator).first == key) {
-			pixel = std::stoi((*iterator).second);
-		}
-		if ((*iterator).first == L"font-name") {
-			fontName = (*iterator).second;
-		}
-	}
+	int pixel = fontSize(key, defPixed);
+	std::wstring fontName = Lang::fontName(defFontName);
 	Gdiplus::FontFamily fontFamily(fontName.c_str());
 	Gdiplus::Font * font = new Gdiplus::Font(&fontFamily, static_cast<Gdiplus::REAL>(pixel * 1.0), 
 			(bold)?Gdiplus::FontStyleBold : Gdiplus::FontStyleRegular, Gdiplus::UnitPixel);
@@ -133,7 +212,7 @@ Gdiplus::Font * Lang::gdiplusFont(const wchar_t * key, bool bold /*= false*/, in
  */
 std::wstring Lang::fontName(const wchar_t * defFontName /*= L"Microsoft Yahei UI"*/)
 {
-	std::wstring fn = SettingService::getInstance()->getValBySectionAndKey(std::wstring(L"FONT"), std::wstring(L"font-name"));
+	const std::wstring & fn = getLangTable().fontName;
 	if (fn.empty()) {
 		return std::wstring(defFontName);
 	}
@@ -149,16 +228,11 @@ std::wstring Lang::fontName(const wchar_t * defFontName /*= L"Microsoft Yahei UI
  */
 int Lang::fontSize(const wchar_t * key, int defPixed /*= 20*/)
 {
-	Setting fontSetting = SettingService::getInstance()->getSettingBySection(std::wstring(L"FONT"));
-	int pixel = defPixed; // Ĭֵ
-	
-	
-	for (auto iterator = fontSetting.begin(); iterator != fontSetting.end(); iterator++) {
-		if ((*iterator).first == key) {
-			pixel = std::stoi((*iterator).second);
-			break;
-		}
-	}	
+	const LangTable & table = getLangTable();
+	auto iterator = table.fontSizes.find(key);
+	if (iterator == table.fontSizes.end()) {
+		return defPixed; // Ĭֵ
+	}
 
-	return pixel;
+	return iterator->second;
 }
@@ -11,8 +11,10 @@
 #include <GdiPlus.h>
 
 // ȡָԵַ
-#define S(key) Lang::lang(key)
-#define E(key) Lang::error(key)
+#define S(key) std::wstring(Lang::lang(key))
+#define E(key) std::wstring(Lang::error(key))
+// ȡָԵַ, ַ, ѭͻ
+#define SR(key) Lang::lang(key)
 #define SNT(key) Lang::langNoTab(key)
 
 // ȡָԵ
@@ -27,14 +29,19 @@
 class Lang {
 public:
 	/**
-	 * ָԵı.
+	 * ļַ, ʱлԺ.
 	 */
-	static std::wstring lang(const wchar_t * key);
+	static void load();
 
 	/**
-	 * ָԵı.
+	 * ָԵı, صڳڼһֱЧ.
+	 */
+	static const std::wstring & lang(const wchar_t * key);
+
+	/**
+	 * ָԵı, صڳڼһֱЧ.
 	 */
-	static std::wstring error(const std::wstring & key);
+	static const std::wstring & error(const std::wstring & key);
 
 	/**
 	 * ָԵı.
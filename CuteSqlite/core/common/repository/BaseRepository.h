@@ -20,6 +20,9 @@
 #include "QSqlColumn.h"
 #include "QConnect.h"
 
+// the busy timeout(ms) of the system db connect, the sql log writer writes the system db by its own connect
+#define SYS_DB_BUSY_TIMEOUT 3000
+
 //sql where条件使用的类型
 typedef std::unordered_map<std::wstring, std::wstring>  QCondition;
 //sql where 条件语句生成like keyword包含的字段
@@ -148,6 +151,8 @@ QSqlDatabase * BaseRepository<T>::getSysConnect()
 			Q_INFO(L"db connect.open Error:{}", QConnect::sysConnect->lastError());
 			setErrorMsg(QConnect::sysConnect->lastError());
 			ATLASSERT(QConnect::sysConnect->isValid() && QConnect::sysConnect->isOpen());
+		} else {
+			QConnect::sysConnect->setBusyTimeout(SYS_DB_BUSY_TIMEOUT);
 		}
 	}
 
@@ -22,6 +22,7 @@
 #include "core/entity/Entity.h"
 #include "utils/FileUtil.h"
 #include "QConnect.h"
+#include "QCatalog.h"
 
 template <typename T>
 class BaseUserRepository : public BaseRepository<T>
@@ -29,6 +30,8 @@ class BaseUserRepository : public BaseRepository<T>
 public:
 	QSqlDatabase * getUserConnect(uint64_t userDbId);
 	void closeConnect(uint64_t userDbId);
+	// the metadata cache of user db connect, throw QSqlExecuteException
+	UserCatalog & getUserCatalog(uint64_t userDbId);
 protected:
 	
 	UserDb getUserDbById(uint64_t userDbId);
@@ -38,14 +41,27 @@ protected:
 	RowItem toRowItem(QSqlStatement &query);
 };
 
+/**
+ * Convert the current row of query to RowItem, the type of column is checked once, 
+ * the INTEGER value is formatted directly and the others are converted from the UTF-8 bytes of SQLite 
+ * to the string of rowItem directly, no temporary string is allocated.
+ */
 template <typename T>
 RowItem BaseUserRepository<T>::toRowItem(QSqlStatement &query)
 {
 	RowItem rowItem;
 	int columnCount = query.getColumnCount();
+	rowItem.reserve(columnCount);
 	for (int i = 0; i < columnCount; i++) {
-		std::wstring val = query.getColumn(i).isNull() ? L"< NULL >" : query.getColumn(i).getText();
-		rowItem.push_back(val);
+		QSqlColumn column = query.getColumn(i);
+		if (column.isNull()) {
+			rowItem.push_back(L"< NULL >");
+		} else if (column.isInteger()) {
+			rowItem.push_back(std::to_wstring(column.getInt64()));
+		} else {
+			rowItem.emplace_back();
+			column.getText(rowItem.back());
+		}
 	}
 	return rowItem;
 }
@@ -103,6 +119,14 @@ void BaseUserRepository<T>::closeConnect(uint64_t userDbId)
 	}
 	// 3) erase from userConnectPool (map)
 	QConnect::userConnectPool.erase(userDbId);
+	// 4) the metadata of the connect
+	QCatalog::clearUserCatalog(userDbId);
+}
+
+template <typename T>
+UserCatalog & BaseUserRepository<T>::getUserCatalog(uint64_t userDbId)
+{
+	return QCatalog::getUserCatalog(userDbId, getUserConnect(userDbId));
 }
 
 template <typename T>
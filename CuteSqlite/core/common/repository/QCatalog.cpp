@@ -0,0 +1,81 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QCatalog.cpp
+ * @brief  QCatalog::userCatalogs - The metadata cache of user databases, one catalog per user connect.
+ * 
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QCatalog.h"
+#include "QSqlStatement.h"
+#include "QSqlColumn.h"
+#include "QSqlStatementCache.h"
+#include "utils/Log.h"
+#include "core/common/exception/QSqlExecuteException.h"
+
+// The metadata cache of user databases, key: user db id
+std::unordered_map<uint64_t, UserCatalog> QCatalog::userCatalogs;
+
+/**
+ * No SQL is run while nothing is changed: the DDL of this process (committed, rolled back or pending in the transaction)
+ * changes the schema generation, and the commits change the data version of connection, then PRAGMA schema_version
+ * tells whether the commits of the other processes have changed the schema.
+ * 
+ * @param userDbId - the user db id
+ * @param connect - the user connect
+ * @return the catalog reference, valid until clearUserCatalog() is called
+ */
+UserCatalog & QCatalog::getUserCatalog(uint64_t userDbId, QSqlDatabase * connect)
+{
+	UserCatalog & catalog = userCatalogs[userDbId];
+	uint64_t schemaGeneration = QSqlStatementCache::getSchemaGeneration();
+	unsigned int dataVersion = 0;
+	bool hasDataVersion = sqlite3_file_control(connect->getHandle(), "main", SQLITE_FCNTL_DATA_VERSION, &dataVersion) == SQLITE_OK;
+	if (catalog.schemaVersion != -1 && hasDataVersion 
+		&& catalog.schemaGeneration == schemaGeneration && catalog.dataVersion == dataVersion) {
+		return catalog;
+	}
+
+	int64_t schemaVersion = 0;
+	std::wstring sql = L"PRAGMA schema_version";
+	try {
+		QSqlStatement query(connect, sql.c_str());
+		if (query.executeStep()) {
+			schemaVersion = query.getColumn(0).getInt64();
+		}
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"query db has error:{}, msg:{}", ex.getErrorCode(), _err);
+		throw QSqlExecuteException(std::to_wstring(ex.getErrorCode()), ex.getErrorStr(), sql);
+	}
+
+	// the rollback restores the old schema version, so the catalog is cleared by the generation even if the version is same
+	if (catalog.schemaVersion != schemaVersion || catalog.schemaGeneration != schemaGeneration) {
+		catalog = UserCatalog();
+		catalog.schemaVersion = schemaVersion;
+	}
+	catalog.schemaGeneration = schemaGeneration;
+	// the data version is read after PRAGMA, the read transaction of PRAGMA has found the commits of other connections
+	sqlite3_file_control(connect->getHandle(), "main", SQLITE_FCNTL_DATA_VERSION, &catalog.dataVersion);
+	return catalog;
+}
+
+void QCatalog::clearUserCatalog(uint64_t userDbId)
+{
+	auto iter = userCatalogs.find(userDbId);
+	if (iter != userCatalogs.end()) {
+		userCatalogs.erase(iter);
+	}
+}
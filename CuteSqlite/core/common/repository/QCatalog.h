@@ -0,0 +1,62 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QCatalog.h
+ * @brief  QCatalog::userCatalogs - The metadata cache of user databases (tables, columns, indexes, 
+ *         functions and the parsed DDL), one catalog per user connect.
+ *         The catalog is cleared when the schema generation of the statement cache is changed (DDL of this process,
+ *         include the rolled back), or PRAGMA schema_version is changed after the data version of connection is changed.
+ * 
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <unordered_map>
+#include "QSqlDatabase.h"
+#include "core/entity/Entity.h"
+
+typedef struct _UserCatalog {
+	int64_t schemaVersion = -1;
+	uint64_t schemaGeneration = 0; // QSqlStatementCache::getSchemaGeneration()
+	unsigned int dataVersion = 0;  // SQLITE_FCNTL_DATA_VERSION of main database, changed by the commits
+
+	// sqlite_master of main database, key: table name
+	bool hasTables = false;
+	UserTableList tables;
+	std::unordered_map<std::wstring, UserTable> tableMap;
+	// PRAGMA table_info, key: table name
+	std::unordered_map<std::wstring, ColumnInfoList> columnsMap;
+	// indexes in sqlite_master, key: table name
+	bool hasIndexes = false;
+	UserIndexList indexes;
+	std::unordered_map<std::wstring, UserIndexList> indexesMap;
+	// PRAGMA function_list
+	Functions functions;
+
+	// parsed from the DDL of table, key: table name
+	std::unordered_map<std::wstring, ColumnInfoList> ddlColumnsMap;
+	std::unordered_map<std::wstring, IndexInfo> ddlPrimaryKeyMap;
+	std::unordered_map<std::wstring, IndexInfoList> ddlConstraintsMap;
+	std::unordered_map<std::wstring, ForeignKeyList> ddlForeignKeysMap;
+} UserCatalog;
+
+class QCatalog {
+public:
+	// Get the catalog of user db, the catalog is cleared if the schema has been changed, throw QSqlExecuteException
+	static UserCatalog & getUserCatalog(uint64_t userDbId, QSqlDatabase * connect);
+	static void clearUserCatalog(uint64_t userDbId);
+	// Only the metadata of main database is cached, the attached databases are always queried
+	static bool isCacheable(const std::wstring & schema) { return schema.empty() || schema == L"main"; }
+private:
+	static std::unordered_map<uint64_t, UserCatalog> userCatalogs;
+};
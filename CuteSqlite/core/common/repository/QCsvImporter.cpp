@@ -0,0 +1,784 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QCsvImporter.cpp
+ * @brief  Import the csv file to the table by a pipeline: the reader splits the file to the chunks of whole rows,
+ *         the workers parse the chunks in parallel and convert the fields to the typed values,
+ *         and the writer binds the values of the chunks in order to one prepared INSERT statement.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QCsvImporter.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+#include <unordered_map>
+#include <sqlite3/sqlite3.h>
+#include "core/common/Lang.h"
+#include "core/common/exception/QRuntimeException.h"
+#include "core/common/exception/QSqlExecuteException.h"
+#include "utils/Log.h"
+#include "utils/SqlUtil.h"
+#include "utils/StringUtil.h"
+
+// Whether the units at p are the same as the sequence
+template <typename T>
+static inline bool matchUnits(const T * p, const T * end, const std::basic_string<T> & seq)
+{
+	size_t n = seq.size();
+	return n && static_cast<size_t>(end - p) >= n && std::equal(seq.begin(), seq.end(), p);
+}
+
+/**
+ * Scan the units of whole rows, the enclosed char and the escape char are tracked same as CsvReader::parseRow(),
+ * so the line terminator in the enclosed field is not the end of row.
+ *
+ * @return the units before the end of the last row, 0 if no complete row
+ */
+template <typename T>
+static size_t scanRowsEnd(const T * begin, const T * end, const std::basic_string<T> & quote,
+	const std::basic_string<T> & escape, T term)
+{
+	bool isEscapeQuote = escape.empty() || escape == quote;
+	bool isInQuote = false;
+	const T * rowsEnd = begin;
+	const T * p = begin;
+	while (p < end) {
+		if (!isEscapeQuote && matchUnits(p, end, escape)) {
+			// the unit after escape char is a part of field
+			p += escape.size() + 1;
+			continue;
+		}
+		if (matchUnits(p, end, quote)) {
+			isInQuote = !isInQuote;
+			p += quote.size();
+			continue;
+		}
+		if (*p == term && !isInQuote) {
+			rowsEnd = p + 1;
+		}
+		p++;
+	}
+	return rowsEnd - begin;
+}
+
+QCsvImporter::QCsvImporter(QSqlDatabase * connect, const QCsvImportOptions & options)
+{
+	ATLASSERT(connect != nullptr);
+	this->connect = connect;
+	this->options = options;
+}
+
+QCsvImporter::~QCsvImporter()
+{
+	stop();
+	if (reader.joinable()) {
+		reader.join();
+	}
+	for (auto & worker : workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	closeFile();
+}
+
+/**
+ * Import the csv file. The reader splits the file to the chunks that end at the row terminator,
+ * the workers parse the chunks ahead of the writer, and the writer inserts the rows of chunks in order,
+ * so the rows are inserted in the same order as the file whatever the number of workers is.
+ * The rows are committed every options.batchRows rows, the rows after the last commit are rolled back if has error.
+ *
+ * @param path - the csv file
+ * @param tblName - the target table
+ * @param columns - the target columns and the indexes of the fields
+ * @param progressHandler - called every 256 rows have been inserted
+ * @param progressArg - the argument of progressHandler
+ * @return the rows have been inserted
+ */
+uint64_t QCsvImporter::import(const std::wstring & path, const std::wstring & tblName, const QCsvImportColumns & columns,
+	QCsvImportProgressHandler progressHandler, void * progressArg)
+{
+	ATLASSERT(connect->getHandle() != nullptr && !tblName.empty() && !columns.empty());
+	auto bt = std::chrono::steady_clock::now();
+	canceled.store(false);
+	this->columns = columns;
+	resolveBindTypes(path, tblName);
+
+	// INSERT INTO "tbl" ("column1", ...) VALUES (?, ...)
+	std::string sql = "INSERT INTO ";
+	appendIdentifier(sql, tblName);
+	sql.append(" (");
+	std::string params;
+	for (size_t i = 0; i < columns.size(); i++) {
+		if (i > 0) {
+			sql.push_back(',');
+			params.push_back(',');
+		}
+		appendIdentifier(sql, columns.at(i).name);
+		params.push_back('?');
+	}
+	sql.append(") VALUES (").append(params).append(")");
+
+	sqlite3 * handle = connect->getHandle();
+	sqlite3_stmt * stmt = nullptr;
+	int rc = sqlite3_prepare_v2(handle, sql.c_str(), -1, &stmt, nullptr);
+	if (rc != SQLITE_OK) {
+		throwError(rc, connect->getErrorMsg(), sql);
+	}
+	try {
+		openFile(path);
+	} catch (...) {
+		sqlite3_finalize(stmt);
+		throw;
+	}
+
+	// the writer runs in this thread, the other cores parse the chunks
+	int n = options.workers > 0 ? options.workers : static_cast<int>(std::thread::hardware_concurrency()) - 1;
+	n = (std::max)(1, (std::min)(n, QCSV_IMPORT_MAX_WORKERS));
+	chunks.clear();
+	writeSeq = 0;
+	isReadDone = false;
+	isStop = false;
+	error = nullptr;
+	maxAheadChunks = static_cast<size_t>(n) * QCSV_IMPORT_AHEAD_CHUNKS + 1;
+
+	uint64_t rows = 0;
+	try {
+		rc = sqlite3_exec(handle, "BEGIN;", nullptr, nullptr, nullptr);
+		if (rc != SQLITE_OK) {
+			throwError(rc, connect->getErrorMsg(), "BEGIN;");
+		}
+		reader = std::thread(&QCsvImporter::runReader, this);
+		for (int i = 0; i < n; i++) {
+			workers.push_back(std::thread(&QCsvImporter::runWorker, this));
+		}
+		rows = writeChunks(stmt, sql, progressHandler, progressArg);
+		bool hasError = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			hasError = error != nullptr;
+		}
+		if (!hasError) {
+			rc = sqlite3_exec(handle, "COMMIT;", nullptr, nullptr, nullptr);
+			if (rc != SQLITE_OK) {
+				throwError(rc, connect->getErrorMsg(), "COMMIT;");
+			}
+		}
+	} catch (...) {
+		setError(std::current_exception());
+	}
+	stop();
+	if (reader.joinable()) {
+		reader.join();
+	}
+	for (auto & worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+	sqlite3_finalize(stmt);
+	closeFile();
+	chunks.clear();
+	if (error) {
+		if (!sqlite3_get_autocommit(handle)) {
+			sqlite3_exec(handle, "ROLLBACK;", nullptr, nullptr, nullptr);
+		}
+		std::rethrow_exception(error);
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bt).count();
+	Q_INFO(L"import csv rows:{}, bytes:{}, workers:{}, time:{}ms, speed:{}rows/s, path:{}",
+		rows, fileSize, n, elapsed, rows * 1000 / (elapsed ? elapsed : 1), path);
+	return rows;
+}
+
+void QCsvImporter::cancel()
+{
+	canceled.store(true);
+}
+
+/**
+ * Infer the types of the fields by the sample rows, the empty and NULL fields are ignored:
+ * INTEGER - all the fields are integers, REAL - all the fields are numbers and some are not integers,
+ * BLOB - all the fields are blob literals such as X'0A1B', TEXT - the others.
+ *
+ * @param path - the csv file
+ * @param options - the csv options, the header row is skipped if options.skipHeader is true
+ * @param sampleRows - the rows sampled from the begin of file
+ * @return the types of fields, the size is options.fieldCount or the fields of the first row
+ */
+QCsvColumnTypes QCsvImporter::inferColumnTypes(const std::wstring & path, const QCsvImportOptions & options, int sampleRows)
+{
+	CsvReader reader(options.csv);
+	reader.open(path);
+
+	// the bits of the types that have been seen
+	const int SEEN_INTEGER = 1, SEEN_REAL = 2, SEEN_BLOB = 4, SEEN_TEXT = 8;
+	std::vector<int> seens(options.fieldCount, 0);
+	RowItem rowItem;
+	bool isHeader = options.skipHeader;
+	int64_t intVal = 0;
+	double realVal = 0;
+	for (int i = 0; i < sampleRows && reader.readRow(rowItem); ) {
+		if (isHeader) {
+			isHeader = false;
+			continue;
+		}
+		if (seens.empty()) {
+			seens.resize(rowItem.size(), 0);
+		}
+		if (rowItem.size() != seens.size()) {
+			continue;
+		}
+		for (size_t f = 0; f < rowItem.size(); f++) {
+			const std::wstring & text = rowItem.at(f);
+			if (text.empty() || text == CSV_NULL_FIELD) {
+				continue;
+			}
+			switch (classifyValue(text, intVal, realVal)) {
+			case QCSV_TYPE_INTEGER: seens[f] |= SEEN_INTEGER; break;
+			case QCSV_TYPE_REAL: seens[f] |= SEEN_REAL; break;
+			case QCSV_TYPE_BLOB: seens[f] |= SEEN_BLOB; break;
+			default: seens[f] |= SEEN_TEXT; break;
+			}
+		}
+		i++;
+	}
+
+	QCsvColumnTypes result;
+	for (int seen : seens) {
+		if (!seen || (seen & SEEN_TEXT) || ((seen & SEEN_BLOB) && seen != SEEN_BLOB)) {
+			result.push_back(QCSV_TYPE_TEXT);
+		} else if (seen == SEEN_BLOB) {
+			result.push_back(QCSV_TYPE_BLOB);
+		} else if (seen & SEEN_REAL) {
+			result.push_back(QCSV_TYPE_REAL);
+		} else {
+			result.push_back(QCSV_TYPE_INTEGER);
+		}
+	}
+	return result;
+}
+
+const wchar_t * QCsvImporter::getTypeName(QCsvColumnType type)
+{
+	switch (type) {
+	case QCSV_TYPE_INTEGER: return L"INTEGER";
+	case QCSV_TYPE_REAL: return L"REAL";
+	case QCSV_TYPE_NUMERIC: return L"NUMERIC";
+	case QCSV_TYPE_BLOB: return L"BLOB";
+	default: return L"TEXT";
+	}
+}
+
+QCsvColumnType QCsvImporter::getAffinity(const std::wstring & declType)
+{
+	switch (SqlUtil::getColumnAffinity(declType)) {
+	case COLUMN_AFFINITY_INTEGER: return QCSV_TYPE_INTEGER;
+	case COLUMN_AFFINITY_REAL: return QCSV_TYPE_REAL;
+	case COLUMN_AFFINITY_NUMERIC: return QCSV_TYPE_NUMERIC;
+	case COLUMN_AFFINITY_BLOB: return QCSV_TYPE_BLOB;
+	default: return QCSV_TYPE_TEXT;
+	}
+}
+
+void QCsvImporter::openFile(const std::wstring & path)
+{
+	closeFile();
+	errno_t _err;
+	wchar_t _err_buf[256] = { 0 };
+	_err = _wfopen_s(&file, path.c_str(), L"rb");
+	if (_err != 0 || file == NULL) {
+		file = nullptr;
+		_wcserror_s(_err_buf, 256, _err);
+		Q_ERROR(L"open file for reading has error:{}, path:{}", _err_buf, path);
+		throw QRuntimeException(std::to_wstring(_err), _err_buf);
+	}
+	filePath = path;
+	_fseeki64(file, 0, SEEK_END);
+	fileSize = static_cast<uint64_t>(_ftelli64(file));
+	_fseeki64(file, 0, SEEK_SET);
+}
+
+void QCsvImporter::closeFile()
+{
+	if (!file) {
+		return;
+	}
+	fclose(file);
+	file = nullptr;
+}
+
+/**
+ * Resolve the type that the fields of every column are bound as:
+ * the column of TEXT affinity - TEXT, the text is stored as it is,
+ * the column of INTEGER/REAL/NUMERIC affinity - NUMERIC, the number is bound as INTEGER/REAL without converting by SQLite,
+ * the column of no affinity - the inferred type of the field, otherwise the numbers are stored as TEXT.
+ */
+void QCsvImporter::resolveBindTypes(const std::wstring & path, const std::wstring & tblName)
+{
+	std::unordered_map<std::wstring, QCsvColumnType> affinities;
+	sqlite3_stmt * stmt = nullptr;
+	const char * sql = "SELECT name, type FROM pragma_table_info(?1)";
+	int rc = sqlite3_prepare_v2(connect->getHandle(), sql, -1, &stmt, nullptr);
+	if (rc != SQLITE_OK) {
+		throwError(rc, connect->getErrorMsg(), sql);
+	}
+	std::string name = StringUtil::unicode2Utf8(tblName);
+	sqlite3_bind_text(stmt, 1, name.c_str(), static_cast<int>(name.size()), SQLITE_TRANSIENT);
+	while (sqlite3_step(stmt) == SQLITE_ROW) {
+		const char * column = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+		const char * type = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
+		affinities[StringUtil::toupper(StringUtil::utf82Unicode(column ? column : ""))]
+			= getAffinity(StringUtil::utf82Unicode(type ? type : ""));
+	}
+	sqlite3_finalize(stmt);
+
+	QCsvColumnTypes inferredTypes = inferColumnTypes(path, options);
+	bindTypes.clear();
+	std::wstring typesLog;
+	for (auto & column : columns) {
+		auto iter = affinities.find(StringUtil::toupper(column.name));
+		QCsvColumnType affinity = iter != affinities.end() ? iter->second : QCSV_TYPE_TEXT;
+		QCsvColumnType inferred = column.fieldIndex < static_cast<int>(inferredTypes.size())
+			? inferredTypes.at(column.fieldIndex) : QCSV_TYPE_TEXT;
+		QCsvColumnType bindType = affinity;
+		if (affinity == QCSV_TYPE_INTEGER || affinity == QCSV_TYPE_REAL) {
+			bindType = QCSV_TYPE_NUMERIC;
+		} else if (affinity == QCSV_TYPE_BLOB) {
+			bindType = inferred == QCSV_TYPE_INTEGER || inferred == QCSV_TYPE_REAL ? QCSV_TYPE_NUMERIC : inferred;
+		}
+		bindTypes.push_back(bindType);
+		typesLog.append(column.name).append(L":").append(getTypeName(inferred)).append(L"/").append(getTypeName(bindType)).append(L" ");
+	}
+	Q_INFO(L"import csv to table:{}, the inferred/bind types of columns:{}", tblName, typesLog);
+}
+
+/**
+ * Read the file and split it to the chunks of whole rows, the reader waits if the chunks are too far ahead of the writer,
+ * so the memory of chunks is bounded. The row longer than the chunk makes the next read bigger.
+ */
+void QCsvImporter::runReader()
+{
+	try {
+		char bom[3] = { 0 };
+		size_t n = fread(bom, 1, 3, file);
+		size_t bomSize = CsvReader::getBomSize(bom, n, options.csv.isUtf16);
+		std::vector<char> buf(bom + bomSize, bom + n);
+		uint64_t offset = bomSize;
+		uint64_t seq = 0;
+		size_t readSize = QCSV_IMPORT_CHUNK_SIZE;
+		bool isEof = false;
+		while (!isEof) {
+			size_t len = buf.size();
+			buf.resize(len + readSize);
+			n = fread(buf.data() + len, 1, readSize, file);
+			buf.resize(len + n);
+			if (n < readSize) {
+				if (ferror(file)) {
+					Q_ERROR(L"read file has error, path:{}", filePath);
+					throw QRuntimeException(L"200102", L"read file has error");
+				}
+				isEof = true;
+			}
+			size_t end = isEof ? buf.size() : findRowsEnd(buf.data(), buf.size(), options.csv);
+			if (!end) {
+				readSize *= 2;
+				continue;
+			}
+			readSize = QCSV_IMPORT_CHUNK_SIZE;
+
+			std::unique_ptr<CsvChunk> chunk(new CsvChunk());
+			chunk->seq = seq++;
+			chunk->beginOffset = offset;
+			offset += end;
+			chunk->endOffset = offset;
+			chunk->bytes.swap(buf);
+			buf.assign(chunk->bytes.begin() + end, chunk->bytes.end());
+			chunk->bytes.resize(end);
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				chunkCond.wait(lock, [&] { return isStop || chunks.size() < maxAheadChunks; });
+				if (isStop) {
+					return;
+				}
+				chunks.push_back(std::move(chunk));
+			}
+			chunkCond.notify_all();
+		}
+	} catch (...) {
+		setError(std::current_exception());
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isReadDone = true;
+	}
+	chunkCond.notify_all();
+}
+
+/**
+ * Take the first chunk that is not parsed, the chunks are parsed out of order and written in order.
+ */
+void QCsvImporter::runWorker()
+{
+	CsvReader reader(options.csv, QCSV_IMPORT_CHUNK_SIZE);
+	std::wstring text;
+	while (true) {
+		CsvChunk * chunk = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			chunkCond.wait(lock, [&] {
+				if (isStop) {
+					return true;
+				}
+				for (auto & item : chunks) {
+					if (!item->isParsing) {
+						chunk = item.get();
+						return true;
+					}
+				}
+				return isReadDone;
+			});
+			if (isStop || !chunk) {
+				return;
+			}
+			chunk->isParsing = true;
+		}
+		try {
+			parseChunk(*chunk, reader, text);
+		} catch (...) {
+			setError(std::current_exception());
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			chunk->isParsed = true;
+		}
+		chunkCond.notify_all();
+	}
+}
+
+/**
+ * Parse the rows of chunk and convert the fields of target columns to the typed values by the bind types,
+ * the texts are converted to UTF-8 here, so the writer binds them without converting.
+ */
+void QCsvImporter::parseChunk(CsvChunk & chunk, CsvReader & reader, std::wstring & text)
+{
+	reader.open(chunk.bytes.data(), chunk.bytes.size());
+	size_t nCols = columns.size();
+	chunk.cells.reserve(chunk.bytes.size() / 8);
+	chunk.rowLines.reserve(chunk.bytes.size() / 64);
+	chunk.texts.reserve(chunk.bytes.size() + chunk.bytes.size() / 2);
+	CsvFields fields;
+	bool isHeader = options.skipHeader && chunk.seq == 0;
+	while (reader.readRow(fields)) {
+		if (isHeader) {
+			isHeader = false;
+			continue;
+		}
+		if (options.fieldCount && fields.size() != options.fieldCount) {
+			chunk.skippedRows++;
+			continue;
+		}
+		for (size_t i = 0; i < nCols; i++) {
+			CsvCell cell;
+			int fieldIndex = columns[i].fieldIndex;
+			if (fieldIndex < 0 || fieldIndex >= static_cast<int>(fields.size())) {
+				cell.type = SQLITE_NULL;
+				chunk.cells.push_back(cell);
+				continue;
+			}
+			reader.toString(fields[fieldIndex], text);
+			if (text == CSV_NULL_FIELD) {
+				cell.type = SQLITE_NULL;
+				chunk.cells.push_back(cell);
+				continue;
+			}
+			QCsvColumnType bindType = bindTypes[i];
+			QCsvColumnType valueType = bindType == QCSV_TYPE_TEXT ? QCSV_TYPE_TEXT
+				: classifyValue(text, cell.intVal, cell.realVal);
+			if (bindType == QCSV_TYPE_NUMERIC && valueType == QCSV_TYPE_INTEGER) {
+				cell.type = SQLITE_INTEGER;
+			} else if (bindType == QCSV_TYPE_NUMERIC && valueType == QCSV_TYPE_REAL) {
+				cell.type = SQLITE_FLOAT;
+			} else if (bindType == QCSV_TYPE_BLOB && valueType == QCSV_TYPE_BLOB) {
+				// X'0A1B'
+				cell.type = SQLITE_BLOB;
+				cell.offset = chunk.texts.size();
+				for (size_t k = 2; k + 2 < text.size(); k += 2) {
+					chunk.texts.push_back(static_cast<char>(std::stoi(text.substr(k, 2), nullptr, 16)));
+				}
+				cell.len = chunk.texts.size() - cell.offset;
+			} else {
+				cell.type = SQLITE_TEXT;
+				cell.offset = chunk.texts.size();
+				appendUtf8(chunk.texts, text);
+				cell.len = chunk.texts.size() - cell.offset;
+			}
+			chunk.cells.push_back(cell);
+		}
+		chunk.rowLines.push_back(static_cast<uint32_t>(reader.getRowLine()));
+		chunk.rows++;
+	}
+	chunk.lines = reader.getReadLines();
+	reader.close();
+	std::vector<char>().swap(chunk.bytes);
+}
+
+/**
+ * Insert the rows of the parsed chunks in order, commit every options.batchRows rows.
+ *
+ * @return the rows have been inserted
+ */
+uint64_t QCsvImporter::writeChunks(sqlite3_stmt * stmt, const std::string & sql, QCsvImportProgressHandler progressHandler, void * progressArg)
+{
+	sqlite3 * handle = connect->getHandle();
+	int nCols = static_cast<int>(columns.size());
+	QCsvImportProgress progress;
+	progress.totalBytes = fileSize;
+	uint64_t skippedRows = 0;
+	// the lines of the written chunks, the error row is the line of file
+	uint64_t chunkLine = 0;
+	while (true) {
+		std::unique_ptr<CsvChunk> chunk;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			chunkCond.wait(lock, [&] { return isStop || (!chunks.empty() && chunks.front()->isParsed) || (chunks.empty() && isReadDone); });
+			if (isStop || chunks.empty()) {
+				break;
+			}
+			chunk = std::move(chunks.front());
+			chunks.pop_front();
+			writeSeq++;
+		}
+		chunkCond.notify_all();
+
+		skippedRows += chunk->skippedRows;
+		const char * texts = chunk->texts.data();
+		for (size_t r = 0; r < chunk->rows; r++) {
+			if (canceled.load()) {
+				throwError(SQLITE_INTERRUPT, S(L"execute-sql-canceled"), sql, chunkLine + chunk->rowLines[r]);
+			}
+			const CsvCell * cells = chunk->cells.data() + r * nCols;
+			for (int i = 0; i < nCols; i++) {
+				const CsvCell & cell = cells[i];
+				switch (cell.type) {
+				case SQLITE_INTEGER:
+					sqlite3_bind_int64(stmt, i + 1, cell.intVal);
+					break;
+				case SQLITE_FLOAT:
+					sqlite3_bind_double(stmt, i + 1, cell.realVal);
+					break;
+				case SQLITE_TEXT:
+					sqlite3_bind_text(stmt, i + 1, texts + cell.offset, static_cast<int>(cell.len), SQLITE_STATIC);
+					break;
+				case SQLITE_BLOB:
+					sqlite3_bind_blob(stmt, i + 1, texts + cell.offset, static_cast<int>(cell.len), SQLITE_STATIC);
+					break;
+				default:
+					sqlite3_bind_null(stmt, i + 1);
+					break;
+				}
+			}
+			int rc = sqlite3_step(stmt);
+			if (rc != SQLITE_DONE) {
+				std::wstring msg = connect->getErrorMsg();
+				rc = sqlite3_extended_errcode(handle);
+				sqlite3_reset(stmt);
+				throwError(rc, msg, sql, chunkLine + chunk->rowLines[r]);
+			}
+			sqlite3_reset(stmt);
+			progress.rows++;
+
+			if (options.batchRows > 0 && progress.rows % options.batchRows == 0) {
+				rc = sqlite3_exec(handle, "COMMIT;BEGIN;", nullptr, nullptr, nullptr);
+				if (rc != SQLITE_OK) {
+					throwError(rc, connect->getErrorMsg(), "COMMIT;BEGIN;", chunkLine + chunk->rowLines[r]);
+				}
+			}
+			if ((progress.rows & 0xff) == 0 && progressHandler) {
+				// the bytes of the inserted rows are estimated in the bytes of the chunk
+				progress.doneBytes = chunk->beginOffset + (chunk->endOffset - chunk->beginOffset) * (r + 1) / chunk->rows;
+				if (progressHandler(progress, progressArg)) {
+					canceled.store(true);
+				}
+			}
+		}
+		chunkLine += chunk->lines;
+	}
+	if (skippedRows) {
+		Q_WARN(L"import csv skipped rows:{}, the count of fields is not {}, path:{}", skippedRows, options.fieldCount, filePath);
+	}
+	return progress.rows;
+}
+
+void QCsvImporter::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStop = true;
+	}
+	chunkCond.notify_all();
+}
+
+void QCsvImporter::setError(std::exception_ptr ex)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!error) {
+			error = ex;
+		}
+		isStop = true;
+	}
+	chunkCond.notify_all();
+}
+
+/**
+ * The end of the last complete row in the bytes, the bytes of UTF-8 are scanned directly,
+ * because the line terminator is ASCII and the enclosed/escape chars are matched by their UTF-8 bytes.
+ *
+ * @return the bytes before the end of the last row, 0 if no complete row
+ */
+size_t QCsvImporter::findRowsEnd(const char * data, size_t len, const CsvOptions & options)
+{
+	std::wstring quote, escape;
+	if (options.enclosedBy) {
+		quote.push_back(options.enclosedBy);
+		if (options.escapedBy) {
+			escape.push_back(options.escapedBy);
+		}
+	}
+	if (options.isUtf16) {
+		const wchar_t * begin = reinterpret_cast<const wchar_t *>(data);
+		return scanRowsEnd(begin, begin + len / 2, quote, escape, options.lineTerminatedBy) * 2;
+	}
+	const char * end = data + len;
+	return scanRowsEnd(data, end, StringUtil::unicode2Utf8(quote), StringUtil::unicode2Utf8(escape),
+		static_cast<char>(options.lineTerminatedBy));
+}
+
+/**
+ * The type of the text, the number must be the same as the text after converted back,
+ * such as "007", "+1", "1." and "-0" are TEXT, so they are stored as they are in the column of no affinity.
+ *
+ * @param text - the field
+ * @param intVal - [out] the value if INTEGER
+ * @param realVal - [out] the value if REAL
+ * @return QCSV_TYPE_INTEGER, QCSV_TYPE_REAL, QCSV_TYPE_BLOB or QCSV_TYPE_TEXT
+ */
+QCsvColumnType QCsvImporter::classifyValue(const std::wstring & text, int64_t & intVal, double & realVal)
+{
+	size_t n = text.size();
+	if (!n) {
+		return QCSV_TYPE_TEXT;
+	}
+	const wchar_t * s = text.c_str();
+	// X'0A1B'
+	if ((s[0] == L'X' || s[0] == L'x') && n >= 3 && s[1] == L'\'' && s[n - 1] == L'\'' && n % 2 == 1) {
+		for (size_t i = 2; i < n - 1; i++) {
+			if (!iswxdigit(s[i])) {
+				return QCSV_TYPE_TEXT;
+			}
+		}
+		return QCSV_TYPE_BLOB;
+	}
+
+	// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+	size_t i = s[0] == L'-' ? 1 : 0;
+	size_t intBegin = i;
+	while (i < n && s[i] >= L'0' && s[i] <= L'9') {
+		i++;
+	}
+	size_t intLen = i - intBegin;
+	if (!intLen || (intLen > 1 && s[intBegin] == L'0')) {
+		return QCSV_TYPE_TEXT;
+	}
+	bool isReal = false;
+	if (i < n && s[i] == L'.') {
+		size_t fracBegin = ++i;
+		while (i < n && s[i] >= L'0' && s[i] <= L'9') {
+			i++;
+		}
+		if (i == fracBegin) {
+			return QCSV_TYPE_TEXT;
+		}
+		isReal = true;
+	}
+	if (i < n && (s[i] == L'e' || s[i] == L'E')) {
+		i++;
+		if (i < n && (s[i] == L'+' || s[i] == L'-')) {
+			i++;
+		}
+		size_t expBegin = i;
+		while (i < n && s[i] >= L'0' && s[i] <= L'9') {
+			i++;
+		}
+		if (i == expBegin) {
+			return QCSV_TYPE_TEXT;
+		}
+		isReal = true;
+	}
+	if (i != n) {
+		return QCSV_TYPE_TEXT;
+	}
+
+	wchar_t * end = nullptr;
+	errno = 0;
+	if (!isReal) {
+		if (intBegin == 1 && intLen == 1 && s[1] == L'0') {
+			return QCSV_TYPE_TEXT; // -0
+		}
+		intVal = _wcstoi64(s, &end, 10);
+		return errno == 0 ? QCSV_TYPE_INTEGER : QCSV_TYPE_TEXT;
+	}
+	realVal = wcstod(s, &end);
+	return errno == 0 && std::isfinite(realVal) ? QCSV_TYPE_REAL : QCSV_TYPE_TEXT;
+}
+
+void QCsvImporter::appendUtf8(std::string & out, const std::wstring & text)
+{
+	if (text.empty()) {
+		return;
+	}
+	// the UTF-8 bytes are never more than 3 times of the UTF-16 chars
+	size_t len = out.size();
+	out.resize(len + text.size() * 3);
+	out.resize(len + StringUtil::utf16ToUtf8(text.c_str(), text.size(), &out[len]));
+}
+
+void QCsvImporter::appendIdentifier(std::string & out, const std::wstring & name)
+{
+	out.push_back('"');
+	for (char c : StringUtil::unicode2Utf8(name)) {
+		if (c == '"') {
+			out.push_back('"');
+		}
+		out.push_back(c);
+	}
+	out.push_back('"');
+}
+
+void QCsvImporter::throwError(int code, const std::wstring & msg, const std::string & sql, uint64_t row)
+{
+	Q_ERROR(L"import csv has error:{}, msg:{}, row:{}", code, msg, row);
+	QSqlExecuteException ex(std::to_wstring(code), msg, StringUtil::utf82Unicode(sql));
+	ex.setErrRow(static_cast<uint32_t>(row));
+	throw ex;
+}
@@ -0,0 +1,172 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QCsvImporter.h
+ * @brief  Import the csv file to the table by a pipeline: the reader splits the file to the chunks of whole rows,
+ *         the workers parse the chunks in parallel and convert the fields to the typed values,
+ *         and the writer binds the values of the chunks in order to one prepared INSERT statement.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "QSqlDatabase.h"
+#include "utils/CsvReader.h"
+
+// the bytes of the rows that a worker parses once
+#define QCSV_IMPORT_CHUNK_SIZE (1024 * 1024)
+// the max workers that parse the chunks
+#define QCSV_IMPORT_MAX_WORKERS 8
+// the chunks of every worker that are read ahead of the writer, the reader waits if the queue is full
+#define QCSV_IMPORT_AHEAD_CHUNKS 2
+// the rows sampled to infer the types of fields
+#define QCSV_IMPORT_SAMPLE_ROWS 1000
+// the rows are committed every QCSV_IMPORT_BATCH_ROWS rows by default
+#define QCSV_IMPORT_BATCH_ROWS 10000
+
+// the inferred type of field, or the affinity of the declared type of column
+typedef enum {
+	QCSV_TYPE_TEXT = 0,
+	QCSV_TYPE_INTEGER,
+	QCSV_TYPE_REAL,
+	QCSV_TYPE_NUMERIC, // the affinity of column only
+	QCSV_TYPE_BLOB     // the field is a blob literal such as X'0A1B', or the column has no affinity
+} QCsvColumnType;
+
+typedef std::vector<QCsvColumnType> QCsvColumnTypes;
+
+// the target column and the index of csv field that is inserted to it
+typedef struct _QCsvImportColumn {
+	std::wstring name;
+	int fieldIndex = 0;
+} QCsvImportColumn;
+
+typedef std::vector<QCsvImportColumn> QCsvImportColumns;
+
+typedef struct _QCsvImportOptions {
+	CsvOptions csv;
+	bool skipHeader = false;    // the first row is the column names
+	size_t fieldCount = 0;      // the rows that have the other count of fields are skipped
+	int batchRows = QCSV_IMPORT_BATCH_ROWS; // the rows committed in one transaction, 0 - one transaction for all rows
+	int workers = 0;            // the workers that parse the chunks, 0 - by the cpu cores
+} QCsvImportOptions;
+
+typedef struct _QCsvImportProgress {
+	uint64_t totalBytes = 0;  // the size of the file
+	uint64_t doneBytes = 0;   // the bytes of the inserted rows
+	uint64_t rows = 0;        // the inserted rows
+} QCsvImportProgress;
+
+// Called every 256 rows have been inserted, return non-zero to stop the import
+typedef int (*QCsvImportProgressHandler)(const QCsvImportProgress & progress, void * arg);
+
+class QCsvImporter
+{
+public:
+	QCsvImporter(QSqlDatabase * connect, const QCsvImportOptions & options);
+	~QCsvImporter();
+
+	// Import the csv file to the columns of table, throw QSqlExecuteException with the error row or QRuntimeException, return the rows
+	uint64_t import(const std::wstring & path, const std::wstring & tblName, const QCsvImportColumns & columns,
+		QCsvImportProgressHandler progressHandler = nullptr, void * progressArg = nullptr);
+	// Stop the import, can be called by the other thread
+	void cancel();
+
+	// Propose the types of the fields by the first sampleRows rows of file, such as the column types of new table
+	static QCsvColumnTypes inferColumnTypes(const std::wstring & path, const QCsvImportOptions & options, int sampleRows = QCSV_IMPORT_SAMPLE_ROWS);
+	static const wchar_t * getTypeName(QCsvColumnType type);
+	// The affinity of the declared type of column by SqlUtil::getColumnAffinity()
+	static QCsvColumnType getAffinity(const std::wstring & declType);
+private:
+	// the typed value of field, the text and blob are in CsvChunk::texts
+	typedef struct _CsvCell {
+		int type = 0;          // SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT, SQLITE_BLOB or SQLITE_NULL
+		int64_t intVal = 0;
+		double realVal = 0;
+		size_t offset = 0;
+		size_t len = 0;
+	} CsvCell;
+
+	// the whole rows of the file between beginOffset and endOffset
+	typedef struct _CsvChunk {
+		uint64_t seq = 0;
+		uint64_t beginOffset = 0;
+		uint64_t endOffset = 0;
+		std::vector<char> bytes;   // released after parsed
+
+		// the parsed rows, the cells of row are continuous
+		std::vector<CsvCell> cells;
+		std::string texts;         // the UTF-8 texts and the blobs of cells
+		size_t rows = 0;
+		size_t skippedRows = 0;
+		// the line of every parsed row in the chunk (from 1), and the lines of the chunk, for the error row of file
+		std::vector<uint32_t> rowLines;
+		uint64_t lines = 0;
+
+		// protected by QCsvImporter::mutex
+		bool isParsing = false;
+		bool isParsed = false;
+	} CsvChunk;
+
+	QSqlDatabase * connect = nullptr;
+	QCsvImportOptions options;
+	std::atomic<bool> canceled{ false };
+
+	FILE * file = nullptr;
+	std::wstring filePath;
+	uint64_t fileSize = 0;
+
+	// the bind types of target columns, resolved by the inferred types and the affinities of columns
+	QCsvImportColumns columns;
+	QCsvColumnTypes bindTypes;
+
+	std::thread reader;
+	std::vector<std::thread> workers;
+	size_t maxAheadChunks = 0;
+
+	// protects the chunks, writeSeq, isReadDone, isStop and error
+	std::mutex mutex;
+	std::condition_variable chunkCond;
+	std::deque<std::unique_ptr<CsvChunk>> chunks; // chunks.front() is the chunk of writeSeq
+	uint64_t writeSeq = 0;
+	bool isReadDone = false;
+	bool isStop = false;
+	std::exception_ptr error;
+
+	void openFile(const std::wstring & path);
+	void closeFile();
+	void resolveBindTypes(const std::wstring & path, const std::wstring & tblName);
+	void runReader();
+	void runWorker();
+	void parseChunk(CsvChunk & chunk, CsvReader & reader, std::wstring & text);
+	uint64_t writeChunks(sqlite3_stmt * stmt, const std::string & sql, QCsvImportProgressHandler progressHandler, void * progressArg);
+	void stop();
+	void setError(std::exception_ptr ex);
+
+	static size_t findRowsEnd(const char * data, size_t len, const CsvOptions & options);
+	static QCsvColumnType classifyValue(const std::wstring & text, int64_t & intVal, double & realVal);
+	static void appendUtf8(std::string & out, const std::wstring & text);
+	static void appendIdentifier(std::string & out, const std::wstring & name);
+	static void throwError(int code, const std::wstring & msg, const std::string & sql, uint64_t row = 0);
+};
@@ -0,0 +1,55 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultCursor.cpp
+ * @brief  Forward-only cursor that reads the UTF-8 text of the result rows.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QResultCursor.h"
+#include <cstring>
+#include <sqlite3/sqlite3.h>
+#include "QSqlColumn.h"
+
+#define QRESULT_CURSOR_NULL_TEXT "< NULL >"
+
+const char * QResultSetCursor::getUtf8Text(int col, uint32_t & len)
+{
+	QResultType type = resultSet.getType(row, col);
+	if (type == QRESULT_NULL) {
+		len = static_cast<uint32_t>(strlen(QRESULT_CURSOR_NULL_TEXT));
+		return QRESULT_CURSOR_NULL_TEXT;
+	} else if (type == QRESULT_INTEGER || type == QRESULT_FLOAT) {
+		const QResultCell & cell = resultSet.getColumnCells(col)[resultSet.getRowIndexes()[row - resultSet.getFirstRow()]];
+		len = static_cast<uint32_t>(resultSet.formatNumber(cell, num, sizeof(num)));
+		return num;
+	}
+	return resultSet.getUtf8(row, col, len);
+}
+
+/**
+ * The text of the column is converted by SQLite, the numbers are formatted as the same text as QResultSet.
+ */
+const char * QSqlStatementCursor::getUtf8Text(int col, uint32_t & len)
+{
+	QSqlColumn column = query.getColumn(col);
+	if (column.getType() == SQLITE_NULL) {
+		len = static_cast<uint32_t>(strlen(QRESULT_CURSOR_NULL_TEXT));
+		return QRESULT_CURSOR_NULL_TEXT;
+	}
+	QSqlColumnView text = column.getUtf8View();
+	len = static_cast<uint32_t>(text.size);
+	return text.data;
+}
@@ -0,0 +1,60 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultCursor.h
+ * @brief  Forward-only cursor that reads the UTF-8 text of the result rows,
+ *         the rows come from the QResultSet in memory or straight from the executing QSqlStatement.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include "QResultSet.h"
+#include "QSqlStatement.h"
+
+class QResultCursor
+{
+public:
+	virtual ~QResultCursor() = default;
+
+	// move to the next row, return false if there is no more row
+	virtual bool next() = 0;
+	// the UTF-8 text of the cell in the current row, NULL value is "< NULL >", the text is valid until next() is called
+	virtual const char * getUtf8Text(int col, uint32_t & len) = 0;
+};
+
+class QResultSetCursor : public QResultCursor
+{
+public:
+	QResultSetCursor(const QResultSet & resultSet) : resultSet(resultSet), row(resultSet.getFirstRow() - 1) {}
+
+	bool next() override { return ++row < resultSet.size(); }
+	const char * getUtf8Text(int col, uint32_t & len) override;
+private:
+	const QResultSet & resultSet;
+	int row;
+	char num[64];
+};
+
+class QSqlStatementCursor : public QResultCursor
+{
+public:
+	// the query must be executed and not stepped yet
+	QSqlStatementCursor(QSqlStatement & query) : query(query) {}
+
+	bool next() override { return query.executeStep(); }
+	const char * getUtf8Text(int col, uint32_t & len) override;
+private:
+	QSqlStatement & query;
+};
@@ -0,0 +1,451 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultSet.cpp
+ * @brief  Random-access columnar container of a query result.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QResultSet.h"
+#include <cstring>
+#include <cstdlib>
+#include <sqlite3/sqlite3.h>
+#include "QSqlColumn.h"
+#include "utils/StringUtil.h"
+
+#define QRESULT_NULL_TEXT L"< NULL >"
+
+QResultSet::QResultSet()
+{
+}
+
+/**
+ * Build the result set from the data list, the "< NULL >" value of the data list is stored as NULL cell.
+ * 
+ * @param dataList
+ */
+QResultSet::QResultSet(const DataList & dataList)
+{
+	if (dataList.empty()) {
+		return;
+	}
+	setColumnCount(static_cast<int>(dataList.begin()->size()));
+	reserve(static_cast<int>(dataList.size()));
+	for (auto & rowItem : dataList) {
+		appendRow(rowItem);
+	}
+}
+
+void QResultSet::clear()
+{
+	columns.clear();
+	rowIndexes.clear();
+	arena.clear();
+	firstRow = 0;
+}
+
+void QResultSet::reserve(int rows)
+{
+	if (rows <= 0) {
+		return;
+	}
+	for (auto & cells : columns) {
+		cells.reserve(rows);
+	}
+	rowIndexes.reserve(rows);
+}
+
+void QResultSet::setColumnCount(int nColumns)
+{
+	ATLASSERT(rowIndexes.empty() && !firstRow);
+	columns.resize(nColumns);
+}
+
+/**
+ * Append the current row of the query, the values are stored with their SQLite types, 
+ * the text is copied to the arena as UTF-8 bytes without any conversion.
+ *
+ * @param query - The query that executeStep() has returned true
+ * @return the row index in the view order
+ */
+int QResultSet::appendRow(QSqlStatement & query)
+{
+	int n = getColumnCount();
+	for (int i = 0; i < n; i++) {
+		QSqlColumn column = query.getColumn(i);
+		QResultCell cell = {};
+		switch (column.getType()) {
+		case SQLITE_INTEGER:
+			cell.type = QRESULT_INTEGER;
+			cell.intVal = column.getInt64();
+			break;
+		case SQLITE_FLOAT:
+			cell.type = QRESULT_FLOAT;
+			cell.floatVal = column.getDouble();
+			break;
+		case SQLITE_TEXT: {
+			QSqlColumnView text = column.getUtf8View();
+			cell = appendBytes(text.data, text.size, QRESULT_TEXT);
+			break;
+		}
+		case SQLITE_BLOB: {
+			QSqlColumnView blob = column.getBlobView();
+			cell = appendBytes(blob.data, blob.size, QRESULT_BLOB);
+			break;
+		}
+		default:
+			cell.type = QRESULT_NULL;
+			break;
+		}
+		columns[i].push_back(cell);
+	}
+	uint32_t physicalRow = static_cast<uint32_t>(rowIndexes.size());
+	if (n > 0) {
+		physicalRow = static_cast<uint32_t>(columns[0].size() - 1);
+	}
+	rowIndexes.push_back(physicalRow);
+	return size() - 1;
+}
+
+int QResultSet::appendRow(const RowItem & rowItem)
+{
+	if (columns.empty() && empty()) {
+		setColumnCount(static_cast<int>(rowItem.size()));
+	}
+	int n = getColumnCount();
+	int nVals = static_cast<int>(rowItem.size());
+	for (int i = 0; i < n; i++) {
+		if (i < nVals) {
+			columns[i].push_back(toCell(rowItem.at(i)));
+		} else {
+			columns[i].push_back(appendBytes("", 0, QRESULT_TEXT));
+		}
+	}
+	uint32_t physicalRow = n > 0 ? static_cast<uint32_t>(columns[0].size() - 1)
+		: static_cast<uint32_t>(rowIndexes.size());
+	rowIndexes.push_back(physicalRow);
+	return size() - 1;
+}
+
+/**
+ * Remove the row from the view order, the cells of the row are left in the column storage.
+ *
+ * @param row - the row index in the view order
+ */
+/**
+ * Append the rows of the other result set, such as the rows fetched by the worker thread, 
+ * the cells and the arena are copied in bulk, the offsets of the text/blob cells are moved to the end of this arena.
+ *
+ * @param other - the result set that has the same columns
+ */
+void QResultSet::appendRows(const QResultSet & other)
+{
+	int n = getColumnCount();
+	ATLASSERT(n == other.getColumnCount());
+	uint64_t arenaBase = arena.size();
+	uint32_t physicalBase = n > 0 ? static_cast<uint32_t>(columns[0].size()) : static_cast<uint32_t>(rowIndexes.size());
+	arena.insert(arena.end(), other.arena.begin(), other.arena.end());
+	for (int i = 0; i < n; i++) {
+		QResultCells & cells = columns[i];
+		for (QResultCell cell : other.columns[i]) {
+			if (cell.type == QRESULT_TEXT || cell.type == QRESULT_BLOB) {
+				cell.offset += arenaBase;
+			}
+			cells.push_back(cell);
+		}
+	}
+	for (uint32_t physicalRow : other.rowIndexes) {
+		rowIndexes.push_back(physicalBase + physicalRow);
+	}
+}
+
+void QResultSet::eraseRow(int row)
+{
+	ATLASSERT(isLoaded(row));
+	rowIndexes.erase(rowIndexes.begin() + (row - firstRow));
+}
+
+/**
+ * Evict the first rows in memory to bound the memory of a large result, the view rows of the others are not changed.
+ * The cells of the remain rows are moved to the front, the arena is cut before the first byte the remain rows use,
+ * the capacity is kept for the next pages, so the memory is bounded by the largest window.
+ * The rows must be in the fetched order (not sorted or erased), so the physical rows are the same as the view rows.
+ *
+ * @param nRows - the rows to evict
+ * @return true if the rows have been evicted, false if the rows are not in the fetched order
+ */
+bool QResultSet::evictRows(int nRows)
+{
+	int nLoaded = static_cast<int>(rowIndexes.size());
+	if (nRows <= 0 || nLoaded == 0) {
+		return false;
+	}
+	for (int i = 0; i < nLoaded; i++) {
+		if (rowIndexes[i] != static_cast<uint32_t>(i)) {
+			return false;
+		}
+	}
+	nRows = nRows < nLoaded ? nRows : nLoaded;
+
+	// the edited cells are appended to the end of arena, so the bytes before the minimum offset are not used
+	uint64_t cut = arena.size();
+	for (auto & cells : columns) {
+		for (auto iter = cells.begin() + nRows; iter != cells.end(); ++iter) {
+			if ((iter->type == QRESULT_TEXT || iter->type == QRESULT_BLOB) && iter->offset < cut) {
+				cut = iter->offset;
+			}
+		}
+	}
+	for (auto & cells : columns) {
+		cells.erase(cells.begin(), cells.begin() + nRows);
+		for (auto & cell : cells) {
+			if (cell.type == QRESULT_TEXT || cell.type == QRESULT_BLOB) {
+				cell.offset -= cut;
+			}
+		}
+	}
+	arena.erase(arena.begin(), arena.begin() + cut);
+	rowIndexes.resize(nLoaded - nRows);
+	for (int i = 0; i < nLoaded - nRows; i++) {
+		rowIndexes[i] = static_cast<uint32_t>(i);
+	}
+	firstRow += nRows;
+	return true;
+}
+
+int64_t QResultSet::getInt64(int row, int col) const
+{
+	const QResultCell & cell = getCell(row, col);
+	if (cell.type == QRESULT_INTEGER) {
+		return cell.intVal;
+	} else if (cell.type == QRESULT_FLOAT) {
+		return static_cast<int64_t>(cell.floatVal);
+	} else if (cell.type == QRESULT_TEXT) {
+		return std::strtoll(arena.data() + cell.offset, nullptr, 10);
+	}
+	return 0;
+}
+
+double QResultSet::getDouble(int row, int col) const
+{
+	const QResultCell & cell = getCell(row, col);
+	if (cell.type == QRESULT_FLOAT) {
+		return cell.floatVal;
+	} else if (cell.type == QRESULT_INTEGER) {
+		return static_cast<double>(cell.intVal);
+	} else if (cell.type == QRESULT_TEXT) {
+		return std::strtod(arena.data() + cell.offset, nullptr);
+	}
+	return 0.0;
+}
+
+const char * QResultSet::getUtf8(int row, int col, uint32_t & len) const
+{
+	const QResultCell & cell = getCell(row, col);
+	if (cell.type != QRESULT_TEXT && cell.type != QRESULT_BLOB) {
+		len = 0;
+		return nullptr;
+	}
+	len = cell.length;
+	return arena.data() + cell.offset;
+}
+
+/**
+ * Convert the display text of the cell to the buffer, the text will be truncated if the buffer is too small.
+ * 
+ * @param row - the row index in the view order
+ * @param col - the column index
+ * @param buf - [out] the buffer, such as the pszText of LVITEM
+ * @param cchBuf - the size of buffer in characters
+ * @return the characters written to the buffer (not include the terminated '\0')
+ */
+int QResultSet::copyText(int row, int col, wchar_t * buf, int cchBuf) const
+{
+	if (!buf || cchBuf <= 0) {
+		return 0;
+	}
+	const QResultCell & cell = getCell(row, col);
+	int n = 0;
+	if (cell.type == QRESULT_NULL) {
+		n = static_cast<int>(wcslen(QRESULT_NULL_TEXT));
+		n = n < cchBuf - 1 ? n : cchBuf - 1;
+		wmemcpy(buf, QRESULT_NULL_TEXT, n);
+	} else if (cell.type == QRESULT_INTEGER || cell.type == QRESULT_FLOAT) {
+		char num[64];
+		int len = formatNumber(cell, num, sizeof(num));
+		for (; n < len && n < cchBuf - 1; n++) {
+			buf[n] = static_cast<wchar_t>(num[n]);
+		}
+	} else if (cell.length) {
+		// one UTF-8 byte never produces more than one UTF-16 char, so the prefix of cchBuf - 1 bytes always fits the buffer,
+		// the prefix must not end in the middle of a multi-byte sequence
+		const char * bytes = arena.data() + cell.offset;
+		int len = static_cast<int>(cell.length);
+		if (len > cchBuf - 1) {
+			len = cchBuf - 1;
+			while (len > 0 && (static_cast<unsigned char>(bytes[len]) & 0xC0) == 0x80) {
+				len--;
+			}
+		}
+		n = static_cast<int>(StringUtil::utf8ToUtf16(bytes, static_cast<size_t>(len), buf));
+	}
+	buf[n] = L'\0';
+	return n;
+}
+
+std::wstring QResultSet::getString(int row, int col) const
+{
+	return getCellString(getCell(row, col));
+}
+
+std::wstring & QResultSet::getString(int row, int col, std::wstring & buffer) const
+{
+	return getCellString(getCell(row, col), buffer);
+}
+
+/**
+ * Change the text of the cell, the new text is appended to the arena.
+ *
+ * @param row - the row index in the view order
+ * @param col - the column index
+ * @param val - new text
+ */
+void QResultSet::setString(int row, int col, const std::wstring & val)
+{
+	ATLASSERT(isLoaded(row) && col >= 0 && col < getColumnCount());
+	uint32_t physicalRow = rowIndexes.at(row - firstRow);
+	columns[col][physicalRow] = toCell(val);
+}
+
+RowItem QResultSet::getRowItem(int row) const
+{
+	RowItem rowItem;
+	int n = getColumnCount();
+	rowItem.reserve(n);
+	for (int i = 0; i < n; i++) {
+		rowItem.emplace_back();
+		getString(row, i, rowItem.back());
+	}
+	return rowItem;
+}
+
+DataList QResultSet::toDataList() const
+{
+	DataList result;
+	int n = size();
+	for (int i = 0; i < n; i++) {
+		result.push_back(getRowItem(i));
+	}
+	return result;
+}
+
+void QResultSet::setRowIndexes(std::vector<uint32_t> & indexes)
+{
+	ATLASSERT(indexes.size() == rowIndexes.size() && !firstRow);
+	rowIndexes.swap(indexes);
+}
+
+/**
+ * The display text of the cell, the NULL cell is "< NULL >" that the DataList used.
+ * 
+ * @param cell
+ * @return 
+ */
+std::wstring QResultSet::getCellString(const QResultCell & cell) const
+{
+	std::wstring result;
+	getCellString(cell, result);
+	return result;
+}
+
+/**
+ * Convert the display text of the cell to the buffer, the capacity of the buffer is reused.
+ * 
+ * @param cell
+ * @param buffer - [out] the display text
+ * @return buffer
+ */
+std::wstring & QResultSet::getCellString(const QResultCell & cell, std::wstring & buffer) const
+{
+	if (cell.type == QRESULT_NULL) {
+		buffer.assign(QRESULT_NULL_TEXT);
+	} else if (cell.type == QRESULT_INTEGER || cell.type == QRESULT_FLOAT) {
+		char num[64];
+		int len = formatNumber(cell, num, sizeof(num));
+		buffer.assign(num, num + len);
+	} else {
+		StringUtil::utf82Unicode(arena.data() + cell.offset, cell.length, buffer);
+	}
+	return buffer;
+}
+
+QResultCell QResultSet::appendBytes(const char * bytes, size_t len, QResultType type)
+{
+	QResultCell cell = {};
+	cell.offset = static_cast<uint64_t>(arena.size());
+	cell.length = static_cast<uint32_t>(len);
+	cell.type = type;
+	if (len) {
+		arena.insert(arena.end(), bytes, bytes + len);
+	}
+	arena.push_back('\0');
+	return cell;
+}
+
+/**
+ * Convert the text of DataList/list view to the cell, "< NULL >" is the NULL value of the DataList.
+ * 
+ * @param val - the text
+ * @return the cell
+ */
+QResultCell QResultSet::toCell(const std::wstring & val)
+{
+	if (val == QRESULT_NULL_TEXT) {
+		QResultCell cell = {};
+		cell.type = QRESULT_NULL;
+		return cell;
+	}
+	std::string utf8 = StringUtil::unicode2Utf8(val);
+	return appendBytes(utf8.data(), utf8.size(), QRESULT_TEXT);
+}
+
+const QResultCell & QResultSet::getCell(int row, int col) const
+{
+	ATLASSERT(row >= 0 && row < size() && col >= 0 && col < getColumnCount());
+	if (row < firstRow) {
+		// the evicted row
+		static const QResultCell nullCell = {};
+		return nullCell;
+	}
+	return columns[col][rowIndexes[row - firstRow]];
+}
+
+/**
+ * Format the INTEGER/FLOAT cell as the same text as SQLite converts.
+ * 
+ * @param cell - the INTEGER/FLOAT cell
+ * @param buf - [out] the buffer
+ * @param bufLen - the size of buffer
+ * @return the length of the text
+ */
+int QResultSet::formatNumber(const QResultCell & cell, char * buf, int bufLen) const
+{
+	if (cell.type == QRESULT_INTEGER) {
+		sqlite3_snprintf(bufLen, buf, "%lld", static_cast<sqlite3_int64>(cell.intVal));
+	} else {
+		sqlite3_snprintf(bufLen, buf, "%!.15g", cell.floatVal);
+	}
+	return static_cast<int>(strlen(buf));
+}
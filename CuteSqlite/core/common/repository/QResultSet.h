@@ -0,0 +1,121 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultSet.h
+ * @brief  Random-access columnar container of a query result.
+ *         The cells of one column are stored contiguously with their SQLite type, the texts live in one 
+ *         shared UTF-8 arena and are only converted to wide chars when they are shown, 
+ *         so a row lookup is O(1) and no std::wstring is allocated per cell.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "core/entity/Entity.h"
+#include "QSqlStatement.h"
+
+// The type of cell value, same as the fundamental datatypes of SQLite
+typedef enum {
+	QRESULT_NULL = 0,
+	QRESULT_INTEGER,
+	QRESULT_FLOAT,
+	QRESULT_TEXT, // UTF-8 text in the arena
+	QRESULT_BLOB, // bytes in the arena
+} QResultType;
+
+// One cell of the result set, the integer/float value is stored in the cell, 
+// the text/blob value is stored in the arena of QResultSet
+typedef struct _QResultCell {
+	union {
+		int64_t intVal;   // QRESULT_INTEGER
+		double floatVal;  // QRESULT_FLOAT
+		uint64_t offset;  // QRESULT_TEXT/QRESULT_BLOB, offset of the bytes in the arena
+	};
+	uint32_t length;  // QRESULT_TEXT/QRESULT_BLOB, bytes of the value (not include the terminated '\0')
+	uint8_t type;     // QResultType
+} QResultCell;
+typedef std::vector<QResultCell> QResultCells;
+
+class QResultSet
+{
+public:
+	QResultSet();
+	QResultSet(const DataList & dataList);
+	~QResultSet() = default;
+
+	void clear();
+	void reserve(int rows);
+
+	int getColumnCount() const { return static_cast<int>(columns.size()); }
+	void setColumnCount(int nColumns);
+
+	// row count in the view order, include the evicted rows before getFirstRow()
+	int size() const { return firstRow + static_cast<int>(rowIndexes.size()); }
+	bool empty() const { return size() == 0; }
+
+	// the view row of the first row in memory, the rows before it have been evicted and are read as NULL
+	int getFirstRow() const { return firstRow; }
+	void setFirstRow(int row) { firstRow = row; }
+	bool isLoaded(int row) const { return row >= firstRow && row < size(); }
+	// evict the first rows in memory, the rows must be in the fetched order
+	bool evictRows(int nRows);
+
+	// append the current row of query (after executeStep() returned true), return the row index
+	int appendRow(QSqlStatement & query);
+	int appendRow(const RowItem & rowItem);
+	// append the rows of the other result set that has the same columns, in the view order of other
+	void appendRows(const QResultSet & other);
+	// remove the row in the view order
+	void eraseRow(int row);
+
+	QResultType getType(int row, int col) const { return static_cast<QResultType>(getCell(row, col).type); }
+	bool isNull(int row, int col) const { return getCell(row, col).type == QRESULT_NULL; }
+	int64_t getInt64(int row, int col) const;
+	double getDouble(int row, int col) const;
+	// The UTF-8 bytes of the TEXT/BLOB cell, valid until the next append/set operation, nullptr for the other types
+	const char * getUtf8(int row, int col, uint32_t & len) const;
+
+	// Convert the display text of the cell to the buffer, only the cells to show need to be converted
+	int copyText(int row, int col, wchar_t * buf, int cchBuf) const;
+	// The display text of the cell, NULL value is "< NULL >"
+	std::wstring getString(int row, int col) const;
+	// Convert the display text of the cell to the buffer, call it with the same buffer for every cell to avoid the allocations
+	std::wstring & getString(int row, int col, std::wstring & buffer) const;
+	void setString(int row, int col, const std::wstring & val);
+
+	RowItem getRowItem(int row) const;
+	DataList toDataList() const;
+
+	// physical row index of the row in the view order (begin from getFirstRow()), sort() only rearranges these indexes
+	const std::vector<uint32_t> & getRowIndexes() const { return rowIndexes; }
+	void setRowIndexes(std::vector<uint32_t> & indexes);
+	const QResultCells & getColumnCells(int col) const { return columns.at(col); }
+	std::wstring getCellString(const QResultCell & cell) const;
+	std::wstring & getCellString(const QResultCell & cell, std::wstring & buffer) const;
+	// The bytes of the TEXT/BLOB cell in the arena
+	const char * getCellBytes(const QResultCell & cell) const { return arena.data() + cell.offset; }
+	// Format the INTEGER/FLOAT cell to the buffer, return the length of the text
+	int formatNumber(const QResultCell & cell, char * buf, int bufLen) const;
+private:
+	std::vector<QResultCells> columns; // per column storage, columns[col][physical row]
+	std::vector<uint32_t> rowIndexes;  // view row -> physical row
+	std::vector<char> arena;           // shared UTF-8 text/blob arena, every value is terminated by '\0'
+	int firstRow = 0;                  // the view row of rowIndexes[0]
+
+	QResultCell appendBytes(const char * bytes, size_t len, QResultType type);
+	QResultCell toCell(const std::wstring & val);
+	const QResultCell & getCell(int row, int col) const;
+};
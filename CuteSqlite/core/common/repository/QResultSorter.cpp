@@ -0,0 +1,232 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultSorter.cpp
+ * @brief  Sort the row indexes of QResultSet by one column.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QResultSorter.h"
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+
+/**
+ * Classify the column and precompute the sort keys of the rows.
+ * If all the values of column are numbers (or empty), the column is sorted by the numbers, otherwise by the texts.
+ *
+ * @param resultSet - the result set
+ * @param col - the column index to sort
+ */
+QResultSorter::QResultSorter(const QResultSet & resultSet, int col)
+{
+	const QResultCells & cells = resultSet.getColumnCells(col);
+	rowIndexes = resultSet.getRowIndexes();
+	keys.resize(cells.size());
+
+	// 1.compute the numbers, stop if the column has a value is not a number
+	for (uint32_t row : rowIndexes) {
+		const QResultCell & cell = cells[row];
+		QResultSortKey & key = keys[row];
+		if (cell.type == QRESULT_NULL) {
+			key.rank = 0;
+		} else if (cell.type == QRESULT_INTEGER) {
+			key.rank = 1;
+			key.number = static_cast<double>(cell.intVal);
+		} else if (cell.type == QRESULT_FLOAT) {
+			key.rank = 1;
+			key.number = cell.floatVal;
+		} else {
+			const char * bytes = resultSet.getCellBytes(cell);
+			if (isEmptyText(bytes, cell.length)) {
+				key.rank = 0;
+			} else if (cell.type == QRESULT_TEXT && isNumberText(bytes, cell.length, key.number)) {
+				key.rank = 1;
+			} else {
+				numeric = false;
+				break;
+			}
+		}
+	}
+	if (numeric) {
+		return;
+	}
+
+	// 2.copy the texts of the cells, the keys don't refer to the arena of resultSet
+	char num[64];
+	for (uint32_t row : rowIndexes) {
+		const QResultCell & cell = cells[row];
+		QResultSortKey & key = keys[row];
+		key.offset = static_cast<uint64_t>(texts.size());
+		key.length = 0;
+		key.rank = 0;
+		const char * bytes = nullptr;
+		uint32_t len = 0;
+		if (cell.type == QRESULT_INTEGER || cell.type == QRESULT_FLOAT) {
+			len = static_cast<uint32_t>(resultSet.formatNumber(cell, num, sizeof(num)));
+			bytes = num;
+		} else if (cell.type == QRESULT_TEXT || cell.type == QRESULT_BLOB) {
+			bytes = resultSet.getCellBytes(cell);
+			len = cell.length;
+		}
+		if (!bytes || isEmptyText(bytes, len)) {
+			continue;
+		}
+		texts.insert(texts.end(), bytes, bytes + len);
+		key.length = len;
+		key.rank = 1;
+	}
+}
+
+/**
+ * Sort the row indexes, if the rows is more than RESULT_PARALLEL_SORT_ROWS,
+ * the row indexes are split into the chunks and sorted in the threads, then the chunks are merged level by level.
+ *
+ * @param isDown - true is descending, false is ascending
+ */
+void QResultSorter::sort(bool isDown)
+{
+	size_t n = rowIndexes.size();
+	unsigned nThreads = std::thread::hardware_concurrency();
+	if (n < RESULT_PARALLEL_SORT_ROWS || nThreads < 2) {
+		sortRange(0, n, isDown);
+		return;
+	}
+	nThreads = nThreads > 8 ? 8 : nThreads;
+
+	// 1.sort the chunks in parallel
+	size_t chunk = (n + nThreads - 1) / nThreads;
+	std::vector<size_t> bounds;
+	for (size_t begin = 0; begin < n; begin += chunk) {
+		bounds.push_back(begin);
+	}
+	bounds.push_back(n);
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i + 1 < bounds.size(); i++) {
+		threads.emplace_back(&QResultSorter::sortRange, this, bounds[i], bounds[i + 1], isDown);
+	}
+	for (auto & thread : threads) {
+		thread.join();
+	}
+
+	// 2.merge the neighbour chunks, the merges of one level run in parallel
+	auto comp = [this, isDown](uint32_t row1, uint32_t row2) {
+		return isDown ? less(row2, row1) : less(row1, row2);
+	};
+	while (bounds.size() > 2) {
+		size_t nChunks = bounds.size() - 1;
+		std::vector<size_t> nextBounds;
+		threads.clear();
+		for (size_t i = 0; i < nChunks; i += 2) {
+			nextBounds.push_back(bounds[i]);
+			if (i + 1 < nChunks) {
+				auto first = rowIndexes.begin() + bounds[i];
+				auto middle = rowIndexes.begin() + bounds[i + 1];
+				auto last = rowIndexes.begin() + bounds[i + 2];
+				threads.emplace_back([first, middle, last, &comp]() {
+					std::inplace_merge(first, middle, last, comp);
+				});
+			}
+		}
+		nextBounds.push_back(n);
+		for (auto & thread : threads) {
+			thread.join();
+		}
+		bounds.swap(nextBounds);
+	}
+}
+
+/**
+ * Check the UTF-8 text is a number, such as "12", "-3.5", "1e10".
+ *
+ * @param bytes - the UTF-8 text
+ * @param len - bytes of text
+ * @param number - [out] the number of text
+ * @return
+ */
+bool QResultSorter::isNumberText(const char * bytes, uint32_t len, double & number)
+{
+	uint32_t i = 0;
+	if (i < len && (bytes[i] == '-' || bytes[i] == '+')) {
+		i++;
+	}
+	uint32_t digits = 0;
+	while (i < len && bytes[i] >= '0' && bytes[i] <= '9') {
+		i++, digits++;
+	}
+	if (i < len && bytes[i] == '.') {
+		i++;
+		while (i < len && bytes[i] >= '0' && bytes[i] <= '9') {
+			i++, digits++;
+		}
+	}
+	if (!digits) {
+		return false;
+	}
+	if (i < len && (bytes[i] == 'e' || bytes[i] == 'E')) {
+		i++;
+		if (i < len && (bytes[i] == '-' || bytes[i] == '+')) {
+			i++;
+		}
+		uint32_t expDigits = 0;
+		while (i < len && bytes[i] >= '0' && bytes[i] <= '9') {
+			i++, expDigits++;
+		}
+		if (!expDigits) {
+			return false;
+		}
+	}
+	if (i != len) {
+		return false;
+	}
+	// the text in the arena is terminated by '\0'
+	number = std::strtod(bytes, nullptr);
+	return true;
+}
+
+/**
+ * The empty text and the "< AUTO >" of the new row are sorted as empty value.
+ */
+bool QResultSorter::isEmptyText(const char * bytes, uint32_t len)
+{
+	return len == 0 || (len == 8 && std::memcmp(bytes, "< AUTO >", 8) == 0);
+}
+
+bool QResultSorter::less(uint32_t row1, uint32_t row2) const
+{
+	const QResultSortKey & key1 = keys[row1];
+	const QResultSortKey & key2 = keys[row2];
+	if (key1.rank != key2.rank) {
+		return key1.rank < key2.rank;
+	}
+	if (numeric) {
+		return key1.number < key2.number;
+	}
+	uint32_t len = key1.length < key2.length ? key1.length : key2.length;
+	int ret = len ? std::memcmp(texts.data() + key1.offset, texts.data() + key2.offset, len) : 0;
+	if (ret != 0) {
+		return ret < 0;
+	}
+	return key1.length < key2.length;
+}
+
+void QResultSorter::sortRange(size_t begin, size_t end, bool isDown)
+{
+	std::stable_sort(rowIndexes.begin() + begin, rowIndexes.begin() + end, [this, isDown](uint32_t row1, uint32_t row2) {
+		return isDown ? less(row2, row1) : less(row1, row2);
+	});
+}
@@ -0,0 +1,59 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QResultSorter.h
+ * @brief  Sort the row indexes of QResultSet by one column.
+ *         The column is classified once and the sort keys are precomputed in the constructor,
+ *         sort() only uses the keys, so it can run in the worker threads while QResultSet is changed.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "QResultSet.h"
+
+// the rows of the result set that sort() will split into the chunks and sort them in parallel
+#define RESULT_PARALLEL_SORT_ROWS 100000
+
+// Sort key of one physical row
+typedef struct _QResultSortKey {
+	double number = 0;   // numeric column, the value of the cell
+	uint64_t offset = 0; // text column, offset of the text in the sorter texts
+	uint32_t length = 0; // text column, bytes of the text
+	uint8_t rank = 0;    // 0 - empty value (NULL, '', < AUTO >), 1 - has value, the empty values are sorted before the others
+} QResultSortKey;
+
+class QResultSorter
+{
+public:
+	QResultSorter(const QResultSet & resultSet, int col);
+	~QResultSorter() = default;
+
+	// sort the row indexes, the ties keep the order of the view
+	void sort(bool isDown);
+
+	bool isNumeric() const { return numeric; }
+	std::vector<uint32_t> & getRowIndexes() { return rowIndexes; }
+private:
+	bool numeric = true; // all the values of the column are numbers
+	std::vector<QResultSortKey> keys; // keys[physical row]
+	std::vector<char> texts;          // UTF-8 texts of the keys for text column
+	std::vector<uint32_t> rowIndexes; // the row indexes to sort, copied from QResultSet in the view order
+
+	bool isNumberText(const char * bytes, uint32_t len, double & number);
+	bool isEmptyText(const char * bytes, uint32_t len);
+	bool less(uint32_t row1, uint32_t row2) const;
+	void sortRange(size_t begin, size_t end, bool isDown);
+};
@@ -76,9 +76,17 @@ double QSqlColumn::getDouble() const noexcept
 // Return a pointer to the text value (NULL terminated string) of the column specified by its index starting at 0
 const std::wstring QSqlColumn::getText(const wchar_t* apDefaultValue /* = "" */) const noexcept
 {
-    auto pText = reinterpret_cast<const char*>(sqlite3_column_text(mStmtPtr.get(), mIndex));
-	std::wstring unicode = StringUtil::utf82Unicode(pText);
-    return (!unicode.empty() ? unicode : apDefaultValue);
+    std::wstring unicode;
+    try {
+        getText(unicode);
+    } catch (std::exception &) {
+        unicode.clear();
+    }
+    // not the ?: operator, its std::wstring result would be one more copy of the text
+    if (unicode.empty()) {
+        unicode = apDefaultValue;
+    }
+    return unicode;
 }
 
 // Return a pointer to the blob value (*not* NULL terminated) of the column specified by its index starting at 0
@@ -95,15 +103,65 @@ std::wstring QSqlColumn::getString() const
     //   however, we need to call sqlite3_column_bytes() to ensure correct format. It's a noop on a BLOB
     //   or a TEXT value with the correct encoding (UTF-8). Otherwise it'll do a conversion to TEXT (UTF-8).
     (void)sqlite3_column_bytes(mStmtPtr.get(), mIndex);
-    auto data = static_cast<const char *>(sqlite3_column_blob(mStmtPtr.get(), mIndex));
+    QSqlColumnView view = getBlobView();
 
-    // SQLite docs: "The safest policy is to invoke sqlite3_column_blob() followed by sqlite3_column_bytes()"
-    // Note: std::string is ok to pass nullptr as first arg, if length is 0
-	std::string utf8str(data, sqlite3_column_bytes(mStmtPtr.get(), mIndex));
-	std::wstring unicode = StringUtil::utf82Unicode(utf8str);
+    // the bytes are converted directly, the embedded '\0' is kept
+    std::wstring unicode;
+    StringUtil::utf82Unicode(view.data, view.size, unicode);
     return unicode;
 }
 
+// Return a pointer to the UTF-8 text value of the column, no conversion is needed for the UTF-8 database
+const char* QSqlColumn::getUtf8Text() const noexcept
+{
+    auto pText = reinterpret_cast<const char*>(sqlite3_column_text(mStmtPtr.get(), mIndex));
+    return pText != nullptr ? pText : "";
+}
+
+// Return a pointer to the UTF-16 text value of the column, the conversion is done by SQLite
+const wchar_t* QSqlColumn::getText16() const noexcept
+{
+    auto pText = static_cast<const wchar_t*>(sqlite3_column_text16(mStmtPtr.get(), mIndex));
+    return pText != nullptr ? pText : L"";
+}
+
+// Return the number of bytes used by the UTF-16 text value of the column
+int QSqlColumn::getBytes16() const noexcept
+{
+    return sqlite3_column_bytes16(mStmtPtr.get(), mIndex);
+}
+
+// Return the UTF-8 text value of the column and its size, sqlite3_column_bytes() is called after sqlite3_column_text()
+QSqlColumnView QSqlColumn::getUtf8View() const noexcept
+{
+    QSqlColumnView view;
+    auto pText = reinterpret_cast<const char*>(sqlite3_column_text(mStmtPtr.get(), mIndex));
+    if (pText != nullptr) {
+        view.data = pText;
+        view.size = static_cast<size_t>(sqlite3_column_bytes(mStmtPtr.get(), mIndex));
+    }
+    return view;
+}
+
+// Return the bytes of the blob value of the column and its size, sqlite3_column_bytes() is called after sqlite3_column_blob()
+QSqlColumnView QSqlColumn::getBlobView() const noexcept
+{
+    QSqlColumnView view;
+    auto pBlob = static_cast<const char*>(sqlite3_column_blob(mStmtPtr.get(), mIndex));
+    if (pBlob != nullptr) {
+        view.data = pBlob;
+        view.size = static_cast<size_t>(sqlite3_column_bytes(mStmtPtr.get(), mIndex));
+    }
+    return view;
+}
+
+// Convert the UTF-8 text value of the column to the buffer by one pass, no temporary string is allocated
+std::wstring & QSqlColumn::getText(std::wstring & buffer) const
+{
+    QSqlColumnView view = getUtf8View();
+    return StringUtil::utf82Unicode(view.data, view.size, buffer);
+}
+
 // Return the type of the value of the column
 int QSqlColumn::getType() const noexcept
 {
@@ -120,7 +178,7 @@ int QSqlColumn::getBytes() const noexcept
 std::wostream& operator<<(std::wostream& aStream, const QSqlColumn& aColumn)
 {
 	std::wstring str = aColumn.getText();
-    aStream.write(str.c_str(), aColumn.getBytes());
+    aStream.write(str.c_str(), str.size());
     return aStream;
 }
 
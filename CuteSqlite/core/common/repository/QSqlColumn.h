@@ -35,6 +35,16 @@ namespace SQLite
 	 */
 }
 
+/**
+ * @brief The bytes of the UTF-8 text or blob value of a column, points to the buffer of SQLite without copy.
+ *
+ * @warning The bytes are only valid until the next step of the statement or the next type conversion of the column.
+ */
+typedef struct _QSqlColumnView {
+	const char * data = "";
+	size_t size = 0;
+} QSqlColumnView;
+
 /**
  * @brief Encapsulation of a Column in a row of the result pointed by the prepared Statement.
  *
@@ -114,6 +124,42 @@ public:
      * Note this correctly handles strings that contain null bytes.
      */
     std::wstring getString() const;
+    /**
+     * @brief Return a pointer to the UTF-8 text value (NULL terminated string) of the column, without any conversion.
+     *
+     * No std::wstring is allocated, use getBytes() for the size in bytes.
+     * @warning The value pointed at is only valid until the next step of the statement.
+     */
+    const char* getUtf8Text() const noexcept;
+    /**
+     * @brief Return a pointer to the UTF-16 text value (NULL terminated string) of the column, converted by SQLite itself.
+     *
+     * No std::wstring is allocated, use getBytes16() for the size in bytes.
+     * @warning The value pointed at is only valid until the next step of the statement.
+     */
+    const wchar_t* getText16() const noexcept;
+    /// Return the number of bytes used by the UTF-16 text returned by getText16() without the '\0' terminator
+    int getBytes16() const noexcept;
+    /**
+     * @brief Return the UTF-8 text value of the column and its size in bytes, without any copy.
+     *
+     * The NULL value is an empty view, the numbers are converted to the text by SQLite.
+     * @warning The value pointed at is only valid until the next step of the statement.
+     */
+    QSqlColumnView getUtf8View() const noexcept;
+    /**
+     * @brief Return the bytes of the blob value of the column and its size, without any copy.
+     *
+     * @warning The value pointed at is only valid until the next step of the statement.
+     */
+    QSqlColumnView getBlobView() const noexcept;
+    /**
+     * @brief Convert the text value of the column to the buffer, the capacity of the buffer is reused.
+     *
+     * Call it with the same buffer for every row, so no allocation is needed after the buffer is big enough.
+     * @return buffer
+     */
+    std::wstring & getText(std::wstring & buffer) const;
 
     /**
      * @brief Return the type of the value of the column using sqlite3_column_type()
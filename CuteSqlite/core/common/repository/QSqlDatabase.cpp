@@ -27,6 +27,7 @@ QSqlDatabase::QSqlDatabase()
 QSqlDatabase::QSqlDatabase(QSqlDatabase & database)
 {
 	this->handle = database.getHandle();
+	this->statementCache = database.getStatementCache();
 	this->activeName = database.getActiveName();
 	this->databaseName = database.getDatabaseName();
 	this->hostName = database.getHostName();
@@ -45,6 +46,7 @@ QSqlDatabase::~QSqlDatabase()
 QSqlDatabase & QSqlDatabase::operator=(QSqlDatabase & database)
 {
 	this->handle = database.getHandle();
+	this->statementCache = database.getStatementCache();
 	this->activeName = database.getActiveName();
 	this->databaseName = database.getDatabaseName();
 	this->hostName = database.getHostName();
@@ -113,6 +115,7 @@ bool QSqlDatabase::open()
 	std::string u_databaseName = StringUtil::unicode2Utf8(databaseName);
 	int ret =  sqlite3_open_v2(u_databaseName.c_str(), &handle, SQLITE_OPEN_READWRITE, nullptr);
 	isOpenFlag = (SQLITE_OK == ret);
+	statementCache->setHandle(isOpenFlag ? handle : nullptr);
 	if (SQLITE_OK != ret) {
 		setErrorMsg(L"Open sqlite db raise error. path:" + databaseName);
 		Q_ERROR(L"Open sqlite db raise error. path:{}", databaseName);
@@ -129,6 +132,9 @@ bool QSqlDatabase::close()
 		return true;
 	}
 
+	// finalize the idle statements, otherwise sqlite3_close_v2 only marks the connection as zombie
+	Q_INFO(L"Statement cache of sqlite, hits:{}, misses:{}, path:{}", statementCache->getHits(), statementCache->getMisses(), databaseName);
+	statementCache->setHandle(nullptr);
 	int ret = sqlite3_close_v2(handle);
 	if (SQLITE_OK != ret) {
 		Q_ERROR("Close the sqlite3 raise error");
@@ -6,6 +6,7 @@
 #include "utils/ThreadUtil.h"
 #include <sqlite3/sqlite3.h>
 #include "QSqlStatement.h"
+#include "QSqlStatementCache.h"
 //#include "QSqlColumn.h"
 #include "QSqlException.h"
 
@@ -124,6 +125,11 @@ public:
 
 	void setBusyTimeout(const int aBusyTimeoutMs);
 
+	// The prepared statements cache shared by the copies of this connection
+	const std::shared_ptr<QSqlStatementCache> & getStatementCache() const noexcept { return statementCache; }
+	uint64_t getStatementCacheHits() const { return statementCache->getHits(); }
+	uint64_t getStatementCacheMisses() const { return statementCache->getMisses(); }
+
 	int exec(const wchar_t * apQueries);
 
 	int tryExec(const wchar_t* apQueries) noexcept;
@@ -196,5 +202,7 @@ private:
 	std::unordered_map<unsigned long , std::wstring> errorMsgMap;
 
 	bool isOpenFlag = false;
+
+	std::shared_ptr<QSqlStatementCache> statementCache = std::make_shared<QSqlStatementCache>();
 	
 };
@@ -0,0 +1,520 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlDumper.cpp
+ * @brief  Dump the rows of tables as typed INSERT statements.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QSqlDumper.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <sqlite3/sqlite3.h>
+#include "core/common/exception/QRuntimeException.h"
+#include "core/common/exception/QSqlExecuteException.h"
+#include "utils/Log.h"
+#include "utils/SqlUtil.h"
+#include "utils/StringUtil.h"
+
+QSqlDumper::QSqlDumper(const std::wstring & dbPath, const QSqlDumpOptions & options)
+{
+	ATLASSERT(!dbPath.empty());
+	this->dbPath = dbPath;
+	this->options = options;
+}
+
+QSqlDumper::~QSqlDumper()
+{
+	stop();
+	for (auto & worker : workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	closeConnects();
+}
+
+/**
+ * Dump the tables. The worker connections read the tasks (the tables or the rowid ranges of big table) ahead of the writer,
+ * the rows are formatted as typed literals to the chunks, and the writer writes the chunks of tasks in order,
+ * so the output is the same whatever the number of workers is.
+ *
+ * @param writer - the opened writer of sql file
+ * @param tables - the tables to dump
+ * @param progressHandler - called after all the rows of a table have been written
+ * @param progressArg - the argument of progressHandler
+ * @return the rows have been dumped
+ */
+uint64_t QSqlDumper::dump(Utf8FileWriter & writer, const QSqlDumpTables & tables,
+	QSqlDumpProgressHandler progressHandler, void * progressArg)
+{
+	auto bt = std::chrono::steady_clock::now();
+	uint64_t beginBytes = writer.getWrittenBytes();
+	int n = options.workers > 0 ? options.workers : static_cast<int>(std::thread::hardware_concurrency());
+	n = (std::max)(1, (std::min)(n, QSQL_DUMP_MAX_WORKERS));
+
+	rows.store(0);
+	nextTask = writeTask = 0;
+	isStop = false;
+	error = nullptr;
+	openConnects(tables, n);
+	maxAheadTasks = connects.size() * 2;
+	for (auto & connect : connects) {
+		workers.push_back(std::thread(&QSqlDumper::runWorker, this, connect.get()));
+	}
+
+	int doneTables = 0;
+	int totalTables = static_cast<int>(tables.size());
+	bool isStopped = false;
+	try {
+		for (size_t i = 0; i < tasks.size() && !isStopped; i++) {
+			DumpTask & task = *tasks.at(i);
+			if (i == 0 || tasks.at(i - 1)->tableIndex != task.tableIndex) {
+				writer.write(tables.at(task.tableIndex).prologue);
+			}
+			while (true) {
+				std::string chunk;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					taskCond.wait(lock, [&] { return isStop || !task.chunks.empty() || task.isDone; });
+					isStopped = isStop;
+					if (isStopped || task.chunks.empty()) {
+						break;
+					}
+					chunk = std::move(task.chunks.front());
+					task.chunks.pop_front();
+				}
+				taskCond.notify_all();
+				writer.write(chunk.data(), chunk.size());
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				writeTask = i + 1;
+			}
+			taskCond.notify_all();
+			if (task.isLastOfTable && !isStopped) {
+				doneTables++;
+				if (progressHandler) {
+					progressHandler(doneTables, totalTables, progressArg);
+				}
+			}
+		}
+	} catch (...) {
+		// the writer has error, such as the disk is full
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!error) {
+			error = std::current_exception();
+		}
+		isStop = true;
+	}
+	stop();
+	for (auto & worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+	closeConnects();
+	tasks.clear();
+	if (error) {
+		std::rethrow_exception(error);
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bt).count();
+	uint64_t bytes = writer.getWrittenBytes() - beginBytes;
+	Q_INFO(L"dump tables:{}, rows:{}, bytes:{}, workers:{}, time:{}ms, speed:{}MB/min",
+		totalTables, rows.load(), bytes, n, elapsed, bytes * 60000 / (1024 * 1024) / (elapsed ? elapsed : 1));
+	return rows.load();
+}
+
+std::unique_ptr<QSqlDatabase> QSqlDumper::openConnect(const std::wstring & name)
+{
+	std::unique_ptr<QSqlDatabase> connect(new QSqlDatabase(name));
+	connect->setDatabaseName(dbPath);
+	if (!connect->open()) {
+		throw QSqlExecuteException(std::to_wstring(SQLITE_CANTOPEN), connect->lastError());
+	}
+	connect->setBusyTimeout(QSQL_DUMP_BUSY_TIMEOUT);
+	return connect;
+}
+
+/**
+ * Open the worker connections at the same snapshot. The coordinator connection holds the write lock (BEGIN IMMEDIATE),
+ * so no one can commit until all the workers have begun their read transactions,
+ * both in WAL mode and rollback journal mode. The tasks are planned by the coordinator at the same snapshot.
+ *
+ * @param tables - the tables to dump
+ * @param n - the max workers
+ */
+void QSqlDumper::openConnects(const QSqlDumpTables & tables, int n)
+{
+	std::unique_ptr<QSqlDatabase> coordinator = openConnect(L"sqlite3_dump_lock_db");
+	bool isLocked = coordinator->tryExec(L"BEGIN IMMEDIATE;") == SQLITE_OK;
+	if (!isLocked) {
+		// the read-only db, or the other connection is writing for a long time
+		Q_WARN(L"lock db for the snapshot of dump has error:{}, the workers may read the different snapshots, path:{}",
+			coordinator->getErrorMsg(), dbPath);
+		coordinator->tryExec(L"BEGIN;");
+	}
+	try {
+		planTasks(coordinator.get(), tables);
+		size_t dataTasks = std::count_if(tasks.begin(), tasks.end(), [](const std::unique_ptr<DumpTask> & task) {
+			return !task->isDone;
+		});
+		size_t nWorkers = (std::min)(static_cast<size_t>(n), dataTasks);
+		for (size_t i = 0; i < nWorkers; i++) {
+			std::unique_ptr<QSqlDatabase> connect = openConnect(L"sqlite3_dump_db_" + std::to_wstring(i));
+			// the read transaction begins at the first read, not at BEGIN
+			const char * sql = "BEGIN; SELECT 1 FROM sqlite_master LIMIT 1;";
+			int rc = sqlite3_exec(connect->getHandle(), sql, nullptr, nullptr, nullptr);
+			if (rc != SQLITE_OK) {
+				throwError(rc, connect->getErrorMsg(), sql);
+			}
+			connects.push_back(std::move(connect));
+		}
+	} catch (...) {
+		coordinator->tryExec(L"ROLLBACK;");
+		coordinator->close();
+		closeConnects();
+		tasks.clear();
+		throw;
+	}
+	coordinator->tryExec(L"ROLLBACK;");
+	coordinator->close();
+}
+
+void QSqlDumper::closeConnects()
+{
+	for (auto & connect : connects) {
+		connect->tryExec(L"ROLLBACK;");
+		connect->close();
+	}
+	connects.clear();
+}
+
+/**
+ * Plan the tasks of tables, the table with rowid is split to the rowid ranges by QSQL_DUMP_RANGE_ROWIDS,
+ * the ranges only depend on the min and max rowid, so the output is deterministic.
+ * The generated columns are not dumped, because they can't be inserted.
+ */
+void QSqlDumper::planTasks(QSqlDatabase * connect, const QSqlDumpTables & tables)
+{
+	tasks.clear();
+	sqlite3 * handle = connect->getHandle();
+	int nTables = static_cast<int>(tables.size());
+	for (int t = 0; t < nTables; t++) {
+		const QSqlDumpTable & table = tables.at(t);
+		std::unique_ptr<DumpTask> task(new DumpTask());
+		task->tableIndex = t;
+		std::string name = StringUtil::unicode2Utf8(table.name);
+
+		// 1.the columns can be inserted, the hidden is 2 or 3 for the generated column
+		std::vector<std::string> columns;
+		Columns columnNames; // all the columns include the hidden, for the name of rowid isn't shadowed
+		bool hasHidden = false;
+		if (table.withData) {
+			sqlite3_stmt * stmt = nullptr;
+			const char * sql = "SELECT name, hidden FROM pragma_table_xinfo(?1)";
+			int rc = sqlite3_prepare_v2(handle, sql, -1, &stmt, nullptr);
+			if (rc != SQLITE_OK) {
+				throwError(rc, connect->getErrorMsg(), sql);
+			}
+			sqlite3_bind_text(stmt, 1, name.c_str(), static_cast<int>(name.size()), SQLITE_TRANSIENT);
+			while (sqlite3_step(stmt) == SQLITE_ROW) {
+				const char * column = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+				columnNames.push_back(StringUtil::utf82Unicode(column ? column : ""));
+				if (sqlite3_column_int(stmt, 1) != 0) {
+					hasHidden = true;
+					continue;
+				}
+				columns.push_back(column ? column : "");
+			}
+			sqlite3_finalize(stmt);
+		}
+		if (columns.empty()) {
+			task->isDone = true;
+			tasks.push_back(std::move(task));
+			continue;
+		}
+
+		// 2.INSERT INTO "tbl" ("column1", ...) and SELECT "column1", ... FROM "tbl"
+		std::string columnClause;
+		for (auto & column : columns) {
+			if (!columnClause.empty()) {
+				columnClause.push_back(',');
+			}
+			appendIdentifier(columnClause, column);
+		}
+		task->insertPrefix = "INSERT INTO ";
+		appendIdentifier(task->insertPrefix, name);
+		if (options.retainColumn || hasHidden) {
+			task->insertPrefix.append(" (").append(columnClause).append(")");
+		}
+		std::string selectSql = "SELECT ";
+		selectSql.append(columnClause).append(" FROM ");
+		appendIdentifier(selectSql, name);
+
+		// 3.the rowid ranges, WITHOUT ROWID table has no rowid and is read in the order of primary key,
+		// the table is dumped as one task if all the names of rowid are shadowed by the columns
+		std::string rowid = StringUtil::unicode2Utf8(SqlUtil::getRowIdAlias(columnNames));
+		sqlite3_stmt * stmt = nullptr;
+		bool hasRowid = false;
+		int64_t minRowid = 0, maxRowid = 0;
+		// two subqueries are two b-tree lookups, min and max in one SELECT scan the whole table
+		std::string rangeSql = "SELECT (SELECT min(" + rowid + ") FROM ";
+		appendIdentifier(rangeSql, name);
+		rangeSql.append("), (SELECT max(").append(rowid).append(") FROM ");
+		appendIdentifier(rangeSql, name);
+		rangeSql.append(")");
+		if (!rowid.empty() && sqlite3_prepare_v2(handle, rangeSql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+			hasRowid = true;
+			if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+				minRowid = sqlite3_column_int64(stmt, 0);
+				maxRowid = sqlite3_column_int64(stmt, 1);
+			}
+		}
+		sqlite3_finalize(stmt);
+
+		uint64_t span = static_cast<uint64_t>(maxRowid) - static_cast<uint64_t>(minRowid);
+		uint64_t nRanges = hasRowid ? (std::min)(span / QSQL_DUMP_RANGE_ROWIDS + 1, static_cast<uint64_t>(QSQL_DUMP_MAX_RANGES)) : 1;
+		if (nRanges <= 1) {
+			task->selectSql = hasRowid ? selectSql + " ORDER BY " + rowid : selectSql;
+			tasks.push_back(std::move(task));
+			continue;
+		}
+		uint64_t step = span / nRanges + 1;
+		std::string insertPrefix = task->insertPrefix;
+		selectSql.append(" WHERE ").append(rowid).append(" >= ?1 AND ").append(rowid).append(" <= ?2 ORDER BY ").append(rowid);
+		for (uint64_t i = 0; i < nRanges; i++) {
+			std::unique_ptr<DumpTask> rangeTask(new DumpTask());
+			rangeTask->tableIndex = t;
+			rangeTask->isLastOfTable = i == nRanges - 1;
+			rangeTask->selectSql = selectSql;
+			rangeTask->insertPrefix = insertPrefix;
+			rangeTask->hasRange = true;
+			rangeTask->minRowid = static_cast<int64_t>(static_cast<uint64_t>(minRowid) + i * step);
+			rangeTask->maxRowid = rangeTask->isLastOfTable ? maxRowid
+				: static_cast<int64_t>(static_cast<uint64_t>(minRowid) + (i + 1) * step - 1);
+			tasks.push_back(std::move(rangeTask));
+		}
+	}
+}
+
+/**
+ * Take the tasks in order, the worker waits if it is too far ahead of the writer, so the memory of chunks is bounded.
+ */
+void QSqlDumper::runWorker(QSqlDatabase * connect)
+{
+	while (true) {
+		DumpTask * task = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			taskCond.wait(lock, [&] { return isStop || nextTask >= tasks.size() || nextTask < writeTask + maxAheadTasks; });
+			if (isStop || nextTask >= tasks.size()) {
+				return;
+			}
+			task = tasks.at(nextTask++).get();
+			if (task->isDone) {
+				continue;
+			}
+		}
+		try {
+			dumpTask(connect, *task);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!error) {
+				error = std::current_exception();
+			}
+			isStop = true;
+			taskCond.notify_all();
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			task->isDone = true;
+		}
+		taskCond.notify_all();
+	}
+}
+
+/**
+ * Read the rows of task and format them as INSERT statements.
+ */
+void QSqlDumper::dumpTask(QSqlDatabase * connect, DumpTask & task)
+{
+	sqlite3 * handle = connect->getHandle();
+	sqlite3_stmt * stmt = nullptr;
+	int rc = sqlite3_prepare_v2(handle, task.selectSql.c_str(), -1, &stmt, nullptr);
+	if (rc != SQLITE_OK) {
+		throwError(rc, connect->getErrorMsg(), task.selectSql);
+	}
+	if (task.hasRange) {
+		sqlite3_bind_int64(stmt, 1, task.minRowid);
+		sqlite3_bind_int64(stmt, 2, task.maxRowid);
+	}
+
+	std::string chunk;
+	chunk.reserve(QSQL_DUMP_CHUNK_SIZE + QSQL_DUMP_CHUNK_SIZE / 8);
+	int nCols = sqlite3_column_count(stmt);
+	int rowsPerInsert = (std::max)(1, options.rowsPerInsert);
+	int rowsInInsert = 0;
+	uint64_t n = 0;
+	while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+		// if enabled multiRows, such as "INSERT INTO tbl VALUES (v1, v2, ...),\r\n(vv1, vv2, ...);"
+		if (!options.multiRows || rowsInInsert == 0) {
+			chunk.append(task.insertPrefix).append(" VALUES (");
+		} else {
+			chunk.append(",\r\n(");
+		}
+		for (int i = 0; i < nCols; i++) {
+			if (i > 0) {
+				chunk.push_back(',');
+			}
+			appendValue(chunk, stmt, i);
+		}
+		if (!options.multiRows) {
+			chunk.append(");\r\n");
+		} else if (++rowsInInsert == rowsPerInsert) {
+			chunk.append(");\r\n");
+			rowsInInsert = 0;
+		} else {
+			chunk.push_back(')');
+		}
+		n++;
+		if (chunk.size() >= QSQL_DUMP_CHUNK_SIZE && !pushChunk(task, chunk)) {
+			break;
+		}
+	}
+	if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+		std::wstring msg = connect->getErrorMsg();
+		rc = sqlite3_extended_errcode(handle);
+		sqlite3_finalize(stmt);
+		throwError(rc, msg, task.selectSql);
+	}
+	sqlite3_finalize(stmt);
+	rows += n;
+	if (rowsInInsert > 0) {
+		chunk.append(";\r\n");
+	}
+	if (!chunk.empty()) {
+		pushChunk(task, chunk);
+	}
+}
+
+/**
+ * Send the chunk to the writer, wait if the queue of task is full.
+ *
+ * @return false if the dump has been stopped
+ */
+bool QSqlDumper::pushChunk(DumpTask & task, std::string & chunk)
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		taskCond.wait(lock, [&] { return isStop || task.chunks.size() < QSQL_DUMP_QUEUE_CHUNKS; });
+		if (isStop) {
+			return false;
+		}
+		task.chunks.push_back(std::move(chunk));
+	}
+	taskCond.notify_all();
+	chunk = std::string();
+	chunk.reserve(QSQL_DUMP_CHUNK_SIZE + QSQL_DUMP_CHUNK_SIZE / 8);
+	return true;
+}
+
+void QSqlDumper::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStop = true;
+	}
+	taskCond.notify_all();
+}
+
+void QSqlDumper::appendIdentifier(std::string & out, const std::string & name)
+{
+	out.push_back('"');
+	for (char ch : name) {
+		if (ch == '"') {
+			out.push_back('"');
+		}
+		out.push_back(ch);
+	}
+	out.push_back('"');
+}
+
+/**
+ * Append the typed literal of the column: NULL, the bare integer and real, X'..' blob, and the quoted text.
+ */
+void QSqlDumper::appendValue(std::string & out, sqlite3_stmt * stmt, int col)
+{
+	static const char hex[] = "0123456789ABCDEF";
+	char num[64];
+	switch (sqlite3_column_type(stmt, col)) {
+	case SQLITE_NULL:
+		out.append("NULL");
+		break;
+	case SQLITE_INTEGER:
+		sqlite3_snprintf(sizeof(num), num, "%lld", sqlite3_column_int64(stmt, col));
+		out.append(num);
+		break;
+	case SQLITE_FLOAT: {
+		double val = sqlite3_column_double(stmt, col);
+		if (std::isinf(val)) {
+			// the same as the .dump of sqlite3 shell
+			out.append(val > 0 ? "1e999" : "-1e999");
+		} else {
+			// 17 significant digits round-trip the double, '!' keeps the decimal point so the value is still REAL
+			sqlite3_snprintf(sizeof(num), num, "%!.17g", val);
+			out.append(num);
+		}
+		break;
+	}
+	case SQLITE_BLOB: {
+		const unsigned char * bytes = static_cast<const unsigned char *>(sqlite3_column_blob(stmt, col));
+		int len = sqlite3_column_bytes(stmt, col);
+		out.append("X'");
+		for (int i = 0; i < len; i++) {
+			out.push_back(hex[bytes[i] >> 4]);
+			out.push_back(hex[bytes[i] & 0x0F]);
+		}
+		out.push_back('\'');
+		break;
+	}
+	default: {
+		const char * text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, col));
+		const char * end = text + sqlite3_column_bytes(stmt, col);
+		out.push_back('\'');
+		while (text < end) {
+			const char * quote = static_cast<const char *>(memchr(text, '\'', end - text));
+			if (!quote) {
+				out.append(text, end - text);
+				break;
+			}
+			out.append(text, quote - text + 1);
+			out.push_back('\'');
+			text = quote + 1;
+		}
+		out.push_back('\'');
+		break;
+	}
+	}
+}
+
+void QSqlDumper::throwError(int code, const std::wstring & msg, const std::string & sql)
+{
+	Q_ERROR(L"dump tables has error:{}, msg:{}", code, msg);
+	throw QSqlExecuteException(std::to_wstring(code), msg, StringUtil::utf82Unicode(sql));
+}
@@ -0,0 +1,120 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlDumper.h
+ * @brief  Dump the rows of tables as typed INSERT statements, the tables are read in parallel
+ *         by the worker connections that share one snapshot, and written in the order of tables.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "QSqlDatabase.h"
+#include "utils/Utf8FileWriter.h"
+
+// the max worker connections that read the tables
+#define QSQL_DUMP_MAX_WORKERS 4
+// the bytes of the chunk that a worker sends to the writer
+#define QSQL_DUMP_CHUNK_SIZE (1024 * 1024)
+// the chunks of a task that are not written yet, the worker waits if the queue is full
+#define QSQL_DUMP_QUEUE_CHUNKS 8
+// the rowids of a task, the big table is split to the rowid ranges
+#define QSQL_DUMP_RANGE_ROWIDS (1 << 20)
+// the max tasks of a table
+#define QSQL_DUMP_MAX_RANGES 256
+// the busy timeout(ms) of the dump connections
+#define QSQL_DUMP_BUSY_TIMEOUT 5000
+
+typedef struct _QSqlDumpTable {
+	std::wstring name;
+	std::wstring prologue;  // the statements written before the rows, such as DROP TABLE, CREATE TABLE, CREATE INDEX
+	bool withData = true;   // dump the rows of table
+} QSqlDumpTable;
+
+typedef std::vector<QSqlDumpTable> QSqlDumpTables;
+
+typedef struct _QSqlDumpOptions {
+	bool retainColumn = false; // INSERT INTO tbl (column1, column2, ...) VALUES (...)
+	bool multiRows = false;    // INSERT INTO tbl VALUES (...),(...)
+	int rowsPerInsert = 100;   // the rows of one INSERT statement if multiRows is true
+	int workers = 0;           // the worker connections, 0 - by the cpu cores
+} QSqlDumpOptions;
+
+// Called after all the rows of a table have been written
+typedef void (*QSqlDumpProgressHandler)(int doneTables, int totalTables, void * arg);
+
+class QSqlDumper
+{
+public:
+	QSqlDumper(const std::wstring & dbPath, const QSqlDumpOptions & options);
+	~QSqlDumper();
+
+	// Write the prologue and rows of tables to writer, throw QSqlExecuteException or QRuntimeException, return the rows
+	uint64_t dump(Utf8FileWriter & writer, const QSqlDumpTables & tables,
+		QSqlDumpProgressHandler progressHandler = nullptr, void * progressArg = nullptr);
+private:
+	// the rows of a table, or a rowid range of the table
+	typedef struct _DumpTask {
+		int tableIndex = 0;
+		bool isLastOfTable = true;
+		std::string selectSql;   // empty if the table has no data to dump
+		std::string insertPrefix; // INSERT INTO "tbl" ("column1", ...)
+		bool hasRange = false;
+		int64_t minRowid = 0;
+		int64_t maxRowid = 0;
+
+		// protected by QSqlDumper::mutex
+		std::deque<std::string> chunks;
+		bool isDone = false;
+	} DumpTask;
+
+	std::wstring dbPath;
+	QSqlDumpOptions options;
+
+	std::vector<std::unique_ptr<QSqlDatabase>> connects;
+	std::vector<std::thread> workers;
+	std::vector<std::unique_ptr<DumpTask>> tasks;
+	size_t maxAheadTasks = 0; // the tasks that the workers can read ahead of the writer
+
+	// protects the tasks, nextTask, writeTask, isStop and error
+	std::mutex mutex;
+	std::condition_variable taskCond;
+	size_t nextTask = 0;  // the next task that a worker takes
+	size_t writeTask = 0; // the task that the writer is writing
+	bool isStop = false;
+	std::exception_ptr error;
+	std::atomic<uint64_t> rows{ 0 };
+
+	std::unique_ptr<QSqlDatabase> openConnect(const std::wstring & name);
+	void openConnects(const QSqlDumpTables & tables, int n);
+	void closeConnects();
+	void planTasks(QSqlDatabase * connect, const QSqlDumpTables & tables);
+	void runWorker(QSqlDatabase * connect);
+	void dumpTask(QSqlDatabase * connect, DumpTask & task);
+	bool pushChunk(DumpTask & task, std::string & chunk);
+	void stop();
+
+	static void appendIdentifier(std::string & out, const std::string & name);
+	static void appendValue(std::string & out, sqlite3_stmt * stmt, int col);
+	static void throwError(int code, const std::wstring & msg, const std::string & sql);
+};
@@ -0,0 +1,469 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlExecutor.cpp
+ * @brief  Execute the statements of query page in a worker thread with its own connection.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QSqlExecutor.h"
+#include <sqlite3/sqlite3.h>
+#include "QSqlStatement.h"
+#include "common/Config.h"
+#include "core/common/Lang.h"
+#include "utils/Log.h"
+#include "utils/PerformUtil.h"
+
+QSqlExecutor::~QSqlExecutor()
+{
+	cancel();
+	join();
+	closeConnect();
+}
+
+/**
+ * Execute the statements in the worker thread, the window receives the messages:
+ * MSG_QUERY_EXEC_RESULT_ID - call takeResults() to take the executed results,
+ * MSG_QUERY_EXEC_FINISHED_ID - all the statements have been executed, lParam is QSqlExecStatus.
+ *
+ * @param hwnd - the window that receives the messages
+ * @param userDbId - the user db id
+ * @param dbPath - the path of user db file
+ * @param statements - the statements, moved to the worker thread
+ * @param isBegin - BEGIN a transaction before the statements if no transaction is opened
+ * @param isCommit - COMMIT the opened transaction after all the statements have been executed
+ * @return the execSeq, 0 if the previous statements are running
+ */
+uint32_t QSqlExecutor::execute(HWND hwnd, uint64_t userDbId, const std::wstring & dbPath,
+	std::vector<QSqlExecStatement> & statements, bool isBegin, bool isCommit)
+{
+	if (running.load()) {
+		return 0;
+	}
+	// the statements go first, the interrupted fetch will be fetched again
+	if (fetching.load()) {
+		cancel();
+	}
+	join();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		results.clear();
+		fetchResults.clear();
+	}
+	// the opened queries of the previous execution would block the DDL, they are executed again when they are fetched
+	closeCursors();
+	canceled.store(false);
+	running.store(true);
+	uint32_t seq = ++execSeq;
+	worker = std::thread(&QSqlExecutor::run, this, hwnd, seq, userDbId, dbPath, std::move(statements), isBegin, isCommit);
+	return seq;
+}
+
+/**
+ * Interrupt the running statement or fetch by sqlite3_interrupt, the statements after it are not executed.
+ */
+void QSqlExecutor::cancel()
+{
+	if (!running.load() && !fetching.load()) {
+		return;
+	}
+	canceled.store(true);
+	std::lock_guard<std::mutex> lock(mutex);
+	if (handle) {
+		sqlite3_interrupt(handle);
+	}
+}
+
+QSqlExecResults QSqlExecutor::takeResults()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	QSqlExecResults taken = std::move(results);
+	results.clear();
+	return taken;
+}
+
+/**
+ * Fetch the next rows of the opened query in the worker thread, so the window keeps responsive and the rows are read 
+ * by the worker connection that has executed the query, such as the TEMP tables, the attached databases and the rows of 
+ * the opened transaction. The window receives MSG_RESULT_FETCHED_ID and calls takeFetchResult() to take the rows.
+ * If the cursor has been closed, the sql is executed again by the worker connection and the fetched rows are skipped.
+ *
+ * @param hwnd - the window that receives the message
+ * @param userDbId - the user db id
+ * @param dbPath - the path of user db file
+ * @param cursorId - the opened query of QSqlExecResult::cursorId, 0 to execute the sql
+ * @param sql - the sql of the query
+ * @param skipRows - the rows have been fetched, skipped if the sql is executed again
+ * @param nRows - the max rows to fetch, -1 means fetch all the remain rows
+ * @return the fetchSeq, 0 if the statements or the other fetch are running
+ */
+uint32_t QSqlExecutor::fetch(HWND hwnd, uint64_t userDbId, const std::wstring & dbPath, uint32_t cursorId,
+	const std::wstring & sql, int skipRows, int nRows)
+{
+	if (running.load() || fetching.load()) {
+		return 0;
+	}
+	join();
+	canceled.store(false);
+	fetching.store(true);
+	uint32_t seq = ++fetchSeq;
+	worker = std::thread(&QSqlExecutor::runFetch, this, hwnd, seq, userDbId, dbPath, cursorId, sql, skipRows, nRows);
+	return seq;
+}
+
+void QSqlExecutor::waitFetch()
+{
+	if (fetching.load()) {
+		join();
+	}
+}
+
+std::unique_ptr<QSqlExecResult> QSqlExecutor::takeFetchResult(uint32_t seq)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto iter = fetchResults.find(seq);
+	if (iter == fetchResults.end()) {
+		return nullptr;
+	}
+	std::unique_ptr<QSqlExecResult> result = std::move(iter->second);
+	fetchResults.erase(iter);
+	return result;
+}
+
+/**
+ * Close the opened query, if the worker thread is using the connection, 
+ * the query is finalized by the worker thread when it has done, so the window is not blocked by the connection mutex.
+ *
+ * @param cursorId - the opened query of QSqlExecResult::cursorId
+ */
+void QSqlExecutor::closeCursor(uint32_t cursorId)
+{
+	if (!cursorId) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	if (fetching.load() && fetchCursorId == cursorId) {
+		isFetchCursorClosed = true;
+		return;
+	}
+	auto iter = cursors.find(cursorId);
+	if (iter == cursors.end()) {
+		return;
+	}
+	if (running.load() || fetching.load()) {
+		closedCursors.push_back(std::move(iter->second));
+	}
+	cursors.erase(iter);
+}
+
+void QSqlExecutor::run(HWND hwnd, uint32_t seq, uint64_t userDbId, std::wstring dbPath,
+	std::vector<QSqlExecStatement> statements, bool isBegin, bool isCommit)
+{
+	QSqlExecStatus status = QSQL_EXEC_DONE;
+	if (!openConnect(userDbId, dbPath)) {
+		std::unique_ptr<QSqlExecResult> result(new QSqlExecResult());
+		result->resultInfo.userDbId = userDbId;
+		result->resultInfo.code = SQLITE_CANTOPEN;
+		result->resultInfo.msg = connect ? connect->lastError() : dbPath;
+		sendResult(hwnd, seq, std::move(result));
+		running.store(false);
+		::PostMessage(hwnd, Config::MSG_QUERY_EXEC_FINISHED_ID, WPARAM(seq), LPARAM(QSQL_EXEC_ERROR));
+		return;
+	}
+
+	// the transaction began by user in the previous execution is kept, don't BEGIN again
+	bool isBeginTransaction = isBegin && sqlite3_get_autocommit(connect->getHandle());
+	bool isCommitTransaction = false;
+	int n = static_cast<int>(statements.size());
+	try {
+		if (isBeginTransaction) {
+			connect->exec(L"BEGIN;");
+		}
+		for (int i = 0; i < n; i++) {
+			if (canceled.load()) {
+				status = QSQL_EXEC_CANCELED;
+				break;
+			}
+			QSqlExecStatement & statement = statements.at(i);
+			std::unique_ptr<QSqlExecResult> result(new QSqlExecResult());
+			result->index = i;
+			result->tabNo = statement.tabNo;
+			result->isQuery = statement.isQuery;
+			result->originSql = statement.originSql;
+			result->resultInfo.userDbId = userDbId;
+			result->resultInfo.sql = statement.sql;
+
+			auto bt = PerformUtil::begin();
+			try {
+				if (statement.isQuery) {
+					executeQuery(statement, *result);
+				} else {
+					// the opened queries of the previous statements would block the DDL (SQLITE_LOCKED)
+					closeCursors();
+					result->resultInfo.effectRows = connect->exec(statement.sql.c_str());
+					result->resultInfo.execTime = PerformUtil::end(bt);
+					result->resultInfo.transferTime = result->resultInfo.execTime;
+					result->resultInfo.msg = S(L"execute-sql-success");
+				}
+				result->resultInfo.totalTime = PerformUtil::end(bt);
+			} catch (SQLite::QSqlException &ex) {
+				std::wstring _err = ex.getErrorStr();
+				Q_ERROR(L"execute sql has error:{}, msg:{}", ex.getErrorCode(), _err);
+				result->resultInfo.code = ex.getErrorCode();
+				result->resultInfo.msg = _err;
+				result->resultInfo.effectRows = 0;
+				result->resultInfo.execTime = PerformUtil::end(bt);
+				result->resultInfo.transferTime = result->resultInfo.execTime;
+				result->resultInfo.totalTime = result->resultInfo.execTime;
+				if (canceled.load() || (ex.getErrorCode() & 0xff) == SQLITE_INTERRUPT) {
+					result->isCanceled = true;
+					result->resultInfo.msg = S(L"execute-sql-canceled");
+					status = QSQL_EXEC_CANCELED;
+				} else if (!statement.isQuery) {
+					// the error of query is shown in its result list page, the error of others stops the execution
+					status = QSQL_EXEC_ERROR;
+				}
+			}
+			sendResult(hwnd, seq, std::move(result));
+			if (status != QSQL_EXEC_DONE) {
+				break;
+			}
+		}
+
+		if (status == QSQL_EXEC_DONE && isCommit && !sqlite3_get_autocommit(connect->getHandle())) {
+			isCommitTransaction = true;
+			connect->exec(L"COMMIT;");
+		}
+	} catch (SQLite::QSqlException &ex) {
+		// BEGIN or COMMIT has error
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"execute sql has error:{}, msg:{}", ex.getErrorCode(), _err);
+		std::unique_ptr<QSqlExecResult> result(new QSqlExecResult());
+		result->index = n;
+		result->resultInfo.userDbId = userDbId;
+		result->resultInfo.sql = isCommitTransaction ? L"COMMIT;" : L"BEGIN;";
+		result->resultInfo.code = ex.getErrorCode();
+		result->resultInfo.msg = _err;
+		sendResult(hwnd, seq, std::move(result));
+		status = QSQL_EXEC_ERROR;
+	}
+
+	if (status != QSQL_EXEC_DONE && !sqlite3_get_autocommit(connect->getHandle())) {
+		closeCursors();
+		connect->tryExec(L"ROLLBACK;");
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		closedCursors.clear();
+		running.store(false);
+	}
+	::PostMessage(hwnd, Config::MSG_QUERY_EXEC_FINISHED_ID, WPARAM(seq), LPARAM(status));
+}
+
+void QSqlExecutor::runFetch(HWND hwnd, uint32_t seq, uint64_t userDbId, std::wstring dbPath, uint32_t cursorId,
+	std::wstring sql, int skipRows, int nRows)
+{
+	std::unique_ptr<QSqlExecResult> result(new QSqlExecResult());
+	result->isQuery = true;
+	result->executor = this;
+	result->resultInfo.userDbId = userDbId;
+	result->resultInfo.sql = sql;
+
+	QSqlExecCursor cursor;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto iter = cursors.find(cursorId);
+		if (iter != cursors.end()) {
+			cursor = std::move(iter->second);
+			cursors.erase(iter);
+		}
+		fetchCursorId = cursorId;
+		isFetchCursorClosed = false;
+	}
+
+	auto bt = PerformUtil::begin();
+	try {
+		if (!cursor.query) {
+			// the cursor has been closed, don't switch the connection that has the transaction of user
+			if (connect && connect->isOpen() && connectPath != dbPath && !sqlite3_get_autocommit(connect->getHandle())) {
+				throw SQLite::QSqlException(L"database is locked", SQLITE_BUSY);
+			}
+			if (!openConnect(userDbId, dbPath)) {
+				throw SQLite::QSqlException(connect ? connect->lastError() : dbPath, SQLITE_CANTOPEN);
+			}
+			cursorId = 0;
+			cursor.query.reset(new QSqlStatement(connect.get(), sql.c_str()));
+			cursor.hasRow = cursor.query->executeStep();
+			for (int i = 0; i < skipRows && cursor.hasRow; i++) {
+				cursor.hasRow = cursor.query->executeStep();
+			}
+		}
+		int nCols = cursor.query->getColumnCount();
+		for (int i = 0; i < nCols; i++) {
+			result->columns.push_back(cursor.query->getColumnName(i));
+		}
+		result->resultInfo.execTime = PerformUtil::end(bt);
+		fetchRows(cursor, nRows, *result);
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"fetch the query rows has error:{}, msg:{}", ex.getErrorCode(), _err);
+		result->resultInfo.code = ex.getErrorCode();
+		result->resultInfo.msg = _err;
+		result->resultInfo.execTime = PerformUtil::end(bt);
+		// the interrupted query has more rows, it will be executed again by the next fetch
+		result->isCanceled = canceled.load() || (ex.getErrorCode() & 0xff) == SQLITE_INTERRUPT;
+		result->hasMore = result->isCanceled;
+		cursor.query.reset();
+	}
+	result->resultInfo.totalTime = PerformUtil::end(bt);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (cursor.query && result->hasMore && !isFetchCursorClosed) {
+			if (!cursorId) {
+				cursorId = ++cursorSeq;
+			}
+			cursors[cursorId] = std::move(cursor);
+			result->cursorId = cursorId;
+		}
+		cursor.query.reset();
+		closedCursors.clear();
+		fetchCursorId = 0;
+		fetchResults[seq] = std::move(result);
+		fetching.store(false);
+	}
+	::PostMessage(hwnd, Config::MSG_RESULT_FETCHED_ID, WPARAM(seq), NULL);
+}
+
+/**
+ * Open the connection of user db in the worker thread, the opened connection is reused if the path is not changed.
+ */
+bool QSqlExecutor::openConnect(uint64_t userDbId, const std::wstring & dbPath)
+{
+	if (connect && connect->isOpen() && connectPath == dbPath) {
+		return true;
+	}
+	closeConnect();
+	connect.reset(new QSqlDatabase(L"sqlite3_exec_db_" + std::to_wstring(userDbId)));
+	connect->setDatabaseName(dbPath);
+	if (!connect->open()) {
+		return false;
+	}
+	connect->setBusyTimeout(QSQL_EXEC_BUSY_TIMEOUT);
+	connectPath = dbPath;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	handle = connect->getHandle();
+	return true;
+}
+
+void QSqlExecutor::closeConnect()
+{
+	if (!connect) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		handle = nullptr;
+		cursors.clear();
+		closedCursors.clear();
+	}
+	connect->close();
+	connect.reset();
+	connectPath.clear();
+}
+
+/**
+ * Fetch the first page of the query, the worker thread does not buffer the remain rows, 
+ * if the query has more rows, it is kept opened as result.cursorId, the window fetches the remain rows 
+ * page by page by fetch() when they are shown.
+ */
+void QSqlExecutor::executeQuery(QSqlExecStatement & statement, QSqlExecResult & result)
+{
+	auto bt = PerformUtil::begin();
+	QSqlExecCursor cursor;
+	cursor.query.reset(new QSqlStatement(connect.get(), statement.sql.c_str()));
+	int nCols = cursor.query->getColumnCount();
+	for (int i = 0; i < nCols; i++) {
+		result.columns.push_back(cursor.query->getColumnName(i));
+	}
+	cursor.hasRow = cursor.query->executeStep();
+	result.resultInfo.execTime = PerformUtil::end(bt);
+	fetchRows(cursor, QSQL_EXEC_FIRST_PAGE_ROWS, result);
+	result.executor = this;
+	if (result.hasMore) {
+		result.cursorId = keepCursor(cursor, 0);
+	}
+}
+
+/**
+ * Fetch the rows of the cursor to result.datas, result.hasMore is set if the cursor has more rows.
+ *
+ * @param cursor - the opened query
+ * @param nRows - the max rows to fetch, -1 means fetch all the remain rows
+ * @param result - [out] the fetched rows
+ */
+void QSqlExecutor::fetchRows(QSqlExecCursor & cursor, int nRows, QSqlExecResult & result)
+{
+	auto bt = PerformUtil::begin();
+	result.datas.setColumnCount(cursor.query->getColumnCount());
+	result.datas.reserve(nRows < 0 ? QSQL_EXEC_FIRST_PAGE_ROWS : nRows);
+
+	int n = 0;
+	while (cursor.hasRow && (nRows < 0 || n < nRows)) {
+		if (canceled.load()) {
+			throw SQLite::QSqlException(L"interrupted", SQLITE_INTERRUPT);
+		}
+		result.datas.appendRow(*cursor.query);
+		n++;
+		cursor.hasRow = cursor.query->executeStep();
+	}
+	result.hasMore = cursor.hasRow;
+	result.resultInfo.effectRows = n;
+	result.resultInfo.transferTime = PerformUtil::end(bt);
+}
+
+uint32_t QSqlExecutor::keepCursor(QSqlExecCursor & cursor, uint32_t cursorId)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!cursorId) {
+		cursorId = ++cursorSeq;
+	}
+	cursors[cursorId] = std::move(cursor);
+	return cursorId;
+}
+
+void QSqlExecutor::closeCursors()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	cursors.clear();
+	closedCursors.clear();
+}
+
+void QSqlExecutor::sendResult(HWND hwnd, uint32_t seq, std::unique_ptr<QSqlExecResult> result)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		results.push_back(std::move(result));
+	}
+	::PostMessage(hwnd, Config::MSG_QUERY_EXEC_RESULT_ID, WPARAM(seq), NULL);
+}
+
+void QSqlExecutor::join()
+{
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
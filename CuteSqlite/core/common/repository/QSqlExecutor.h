@@ -0,0 +1,139 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlExecutor.h
+ * @brief  Execute the statements of query page in a worker thread with its own connection,
+ *         the results are sent back to the window by messages and the running statement can be interrupted.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "QResultSet.h"
+#include "QSqlDatabase.h"
+#include "QSqlStatement.h"
+#include "core/entity/Entity.h"
+
+// the rows of a query fetched by the worker thread, the remain rows are fetched by QSqlExecutor::fetch() on demand
+#define QSQL_EXEC_FIRST_PAGE_ROWS 500
+// the busy timeout(ms) of the worker connection
+#define QSQL_EXEC_BUSY_TIMEOUT 5000
+
+typedef enum {
+	QSQL_EXEC_DONE = 0,
+	QSQL_EXEC_ERROR,
+	QSQL_EXEC_CANCELED
+} QSqlExecStatus;
+
+// The statement executed by the worker thread
+typedef struct _QSqlExecStatement {
+	std::wstring originSql; // the sql in the editor
+	std::wstring sql;       // the sql to execute, the query may be appended the LIMIT clause
+	bool isQuery = false;   // SELECT or PRAGMA, the first page of rows is fetched to QSqlExecResult::datas
+	int tabNo = 0;          // the tab no of the result list page for the query
+} QSqlExecStatement;
+
+class QSqlExecutor;
+
+// The result of one statement, or the rows fetched from the opened query by QSqlExecutor::fetch()
+typedef struct _QSqlExecResult {
+	int index = 0;          // the index of the statement
+	int tabNo = 0;
+	bool isQuery = false;
+	bool hasMore = false;   // the query has more rows than the fetched rows
+	uint32_t cursorId = 0;  // the opened query kept by the worker connection for fetching the remain rows, 0 if it has been closed
+	QSqlExecutor * executor = nullptr; // the executor that has executed the query
+	bool isCanceled = false; // the statement has been interrupted by cancel()
+	std::wstring originSql;
+	Columns columns;
+	QResultSet datas;
+	ResultInfo resultInfo;  // resultInfo.sql is the executed sql, resultInfo.code is not 0 if has error
+} QSqlExecResult;
+
+typedef std::vector<std::unique_ptr<QSqlExecResult>> QSqlExecResults;
+
+// The query opened by the worker connection that has more rows to fetch
+typedef struct _QSqlExecCursor {
+	std::unique_ptr<QSqlStatement> query;
+	bool hasRow = false;    // query has stepped to a row that has not been fetched
+} QSqlExecCursor;
+
+class QSqlExecutor
+{
+public:
+	QSqlExecutor() = default;
+	~QSqlExecutor();
+
+	// Execute the statements in the worker thread, return the execSeq, return 0 if the previous statements are running
+	uint32_t execute(HWND hwnd, uint64_t userDbId, const std::wstring & dbPath,
+		std::vector<QSqlExecStatement> & statements, bool isBegin, bool isCommit);
+	// Interrupt the running statement or fetch, the transaction is rolled back
+	void cancel();
+	bool isRunning() const { return running.load(); }
+	uint32_t getExecSeq() const { return execSeq; }
+	// Take the results that the worker thread has sent, called by the window when it receives MSG_QUERY_EXEC_RESULT_ID
+	QSqlExecResults takeResults();
+
+	// Fetch the next rows of the opened query in the worker thread, return the fetchSeq, return 0 if the worker thread is busy
+	uint32_t fetch(HWND hwnd, uint64_t userDbId, const std::wstring & dbPath, uint32_t cursorId,
+		const std::wstring & sql, int skipRows, int nRows);
+	bool isFetching() const { return fetching.load(); }
+	// Wait for the running fetch, then the result can be taken by takeFetchResult()
+	void waitFetch();
+	// Take the fetched rows, called by the window when it receives MSG_RESULT_FETCHED_ID, nullptr if they have been taken
+	std::unique_ptr<QSqlExecResult> takeFetchResult(uint32_t seq);
+	// Close the opened query, so it doesn't hold the SHARED lock of the worker connection
+	void closeCursor(uint32_t cursorId);
+private:
+	std::thread worker;
+	std::atomic<bool> running{ false };
+	std::atomic<bool> fetching{ false };
+	std::atomic<bool> canceled{ false };
+	uint32_t execSeq = 0;
+	uint32_t fetchSeq = 0;
+
+	// the connection is kept between the executions, so the transaction began by user is kept as before
+	std::unique_ptr<QSqlDatabase> connect;
+	std::wstring connectPath;
+
+	// protects results, handle and the cursors
+	std::mutex mutex;
+	QSqlExecResults results;
+	sqlite3 * handle = nullptr;
+	std::unordered_map<uint32_t, std::unique_ptr<QSqlExecResult>> fetchResults;
+	std::unordered_map<uint32_t, QSqlExecCursor> cursors;
+	std::vector<QSqlExecCursor> closedCursors; // closed by the window while the worker thread uses the connection, finalized by the worker thread
+	uint32_t cursorSeq = 0;
+	uint32_t fetchCursorId = 0;   // the cursor that the worker thread is fetching
+	bool isFetchCursorClosed = false;
+
+	void run(HWND hwnd, uint32_t seq, uint64_t userDbId, std::wstring dbPath,
+		std::vector<QSqlExecStatement> statements, bool isBegin, bool isCommit);
+	void runFetch(HWND hwnd, uint32_t seq, uint64_t userDbId, std::wstring dbPath, uint32_t cursorId,
+		std::wstring sql, int skipRows, int nRows);
+	bool openConnect(uint64_t userDbId, const std::wstring & dbPath);
+	void closeConnect();
+	void executeQuery(QSqlExecStatement & statement, QSqlExecResult & result);
+	void fetchRows(QSqlExecCursor & cursor, int nRows, QSqlExecResult & result);
+	uint32_t keepCursor(QSqlExecCursor & cursor, uint32_t cursorId);
+	void closeCursors();
+	void sendResult(HWND hwnd, uint32_t seq, std::unique_ptr<QSqlExecResult> result);
+	void join();
+};
@@ -0,0 +1,407 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlScriptImporter.cpp
+ * @brief  Execute the statements of the UTF-8 sql script file one by one.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QSqlScriptImporter.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <sqlite3/sqlite3.h>
+#include "core/common/Lang.h"
+#include "core/common/exception/QRuntimeException.h"
+#include "core/common/exception/QSqlExecuteException.h"
+#include "utils/Log.h"
+#include "utils/StringUtil.h"
+
+// the max bytes of the error statement in the exception, the statement of the dump may be very large
+#define QSQL_SCRIPT_ERROR_SQL_LEN 1024
+
+QSqlScriptImporter::QSqlScriptImporter(QSqlDatabase * connect, int batchStatements)
+{
+	ATLASSERT(connect != nullptr);
+	this->connect = connect;
+	this->batchStatements = batchStatements > 0 ? batchStatements : QSQL_SCRIPT_BATCH_STATEMENTS;
+}
+
+QSqlScriptImporter::~QSqlScriptImporter()
+{
+	closeFile();
+}
+
+/**
+ * Import the sql file. The statements are split at the ';' that completes the statement (sqlite3_complete),
+ * then prepared one by one with the tail of sqlite3_prepare_v2 and stepped until done.
+ * The statements are committed every batchStatements statements, unless the script begins the transaction itself.
+ * The import stops at the first error and the opened transaction is rolled back,
+ * the batches committed before the error are kept.
+ *
+ * @param path - the UTF-8 sql file, the BOM is skipped
+ * @param progressHandler - called after every statement, return non-zero to stop the import
+ * @param progressArg - the argument of progressHandler
+ * @return the executed statements
+ */
+uint64_t QSqlScriptImporter::import(const std::wstring & path, QSqlScriptProgressHandler progressHandler, void * progressArg)
+{
+	ATLASSERT(connect->getHandle() != nullptr);
+	canceled.store(false);
+	openFile(path);
+	try {
+		size_t stmtEnd = 0;
+		while (nextStatement(stmtEnd)) {
+			if (canceled.load()) {
+				throwError(SQLITE_INTERRUPT, S(L"execute-sql-canceled"), buffer.data() + stmtBegin, stmtEnd - stmtBegin, stmtLine);
+			}
+			progress.statements += executeStatement(buffer.data() + stmtBegin, stmtEnd - stmtBegin, stmtLine);
+			stmtBegin = stmtEnd;
+			stmtLine = scanLine;
+			progress.doneBytes = bufferOffset + stmtEnd;
+			if (progressHandler && progressHandler(progress, progressArg)) {
+				canceled.store(true);
+			}
+		}
+		// the text after the last ';' at the end of file, such as comments or the statement without ';'
+		if (stmtBegin < dataLen) {
+			progress.statements += executeStatement(buffer.data() + stmtBegin, dataLen - stmtBegin, stmtLine);
+			stmtBegin = dataLen;
+		}
+		if (isBatchBegan) {
+			execOrThrow("COMMIT;", scanLine);
+			isBatchBegan = false;
+		}
+	} catch (QSqlExecuteException &ex) {
+		Q_ERROR(L"import sql file has error:{}, msg:{}, line:{}", ex.getCode(), ex.getMsg(), ex.getErrRow());
+		if (!sqlite3_get_autocommit(connect->getHandle())) {
+			connect->tryExec(L"ROLLBACK;");
+		}
+		isBatchBegan = false;
+		closeFile();
+		throw;
+	}
+	if (!sqlite3_get_autocommit(connect->getHandle())) {
+		// the same as sqlite3 .read, the transaction that the script does not end is rolled back
+		Q_WARN(L"the transaction of sql file is not committed, rollback it, path:{}", filePath);
+		connect->tryExec(L"ROLLBACK;");
+	}
+	progress.doneBytes = progress.totalBytes;
+	closeFile();
+	return progress.statements;
+}
+
+void QSqlScriptImporter::cancel()
+{
+	canceled.store(true);
+	if (connect->getHandle()) {
+		sqlite3_interrupt(connect->getHandle());
+	}
+}
+
+void QSqlScriptImporter::openFile(const std::wstring & path)
+{
+	closeFile();
+	errno_t _err;
+	wchar_t _err_buf[256] = { 0 };
+	_err = _wfopen_s(&file, path.c_str(), L"rb");
+	if (_err != 0 || file == NULL) {
+		file = nullptr;
+		_wcserror_s(_err_buf, 256, _err);
+		Q_ERROR(L"open file for reading has error:{}, path:{}", _err_buf, path);
+		throw QRuntimeException(std::to_wstring(_err), _err_buf);
+	}
+	filePath = path;
+	progress = QSqlScriptProgress();
+	_fseeki64(file, 0, SEEK_END);
+	progress.totalBytes = static_cast<uint64_t>(_ftelli64(file));
+
+	// skip the UTF-8 BOM
+	unsigned char bom[3] = { 0 };
+	bufferOffset = 0;
+	_fseeki64(file, 0, SEEK_SET);
+	if (fread(bom, 1, 3, file) == 3 && bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF) {
+		bufferOffset = 3;
+	}
+	_fseeki64(file, static_cast<__int64>(bufferOffset), SEEK_SET);
+
+	isEof = false;
+	dataLen = scanPos = stmtBegin = 0;
+	scanState = SCAN_NORMAL;
+	stmtLine = scanLine = 1;
+	isBatchBegan = false;
+	batchCount = 0;
+}
+
+void QSqlScriptImporter::closeFile()
+{
+	if (!file) {
+		return;
+	}
+	fclose(file);
+	file = nullptr;
+	std::vector<char>().swap(buffer);
+}
+
+/**
+ * Move the bytes that are not executed to the begin of buffer, then append the next chunk of file.
+ *
+ * @return false if the end of file has been reached before
+ */
+bool QSqlScriptImporter::readChunk()
+{
+	if (isEof) {
+		return false;
+	}
+	if (stmtBegin > 0) {
+		memmove(buffer.data(), buffer.data() + stmtBegin, dataLen - stmtBegin);
+		bufferOffset += stmtBegin;
+		dataLen -= stmtBegin;
+		scanPos -= stmtBegin;
+		stmtBegin = 0;
+	}
+	// one more byte for the '\0' of sqlite3_complete
+	if (buffer.size() < dataLen + QSQL_SCRIPT_CHUNK_SIZE + 1) {
+		buffer.resize(dataLen + QSQL_SCRIPT_CHUNK_SIZE + 1);
+	}
+	size_t n = fread(buffer.data() + dataLen, 1, QSQL_SCRIPT_CHUNK_SIZE, file);
+	if (n < QSQL_SCRIPT_CHUNK_SIZE) {
+		if (ferror(file)) {
+			Q_ERROR(L"read file has error, path:{}", filePath);
+			throw QRuntimeException(L"200102", L"read file has error");
+		}
+		isEof = true;
+	}
+	dataLen += n;
+	return true;
+}
+
+/**
+ * Scan the bytes from scanPos to the ';' that completes the statement, the quotes and comments are skipped,
+ * and the state of scanning is kept between the chunks.
+ *
+ * @param stmtEnd - the end of statement (after ';')
+ * @return false if the end of file has been reached and no more complete statement
+ */
+bool QSqlScriptImporter::nextStatement(size_t & stmtEnd)
+{
+	while (true) {
+		while (scanPos < dataLen) {
+			char c = buffer[scanPos];
+			// "--", "/*" and "*/" need the next byte, read the next chunk first
+			bool hasNext = scanPos + 1 < dataLen;
+			if (!hasNext && !isEof && (c == '-' || c == '/' || c == '*')) {
+				break;
+			}
+			char next = hasNext ? buffer[scanPos + 1] : '\0';
+			if (scanState == SCAN_NORMAL) {
+				if (c == '\'') {
+					scanState = SCAN_SINGLE_QUOTE;
+				} else if (c == '"') {
+					scanState = SCAN_DOUBLE_QUOTE;
+				} else if (c == '`') {
+					scanState = SCAN_BACKTICK;
+				} else if (c == '[') {
+					scanState = SCAN_BRACKET;
+				} else if (c == '-' && next == '-') {
+					scanState = SCAN_LINE_COMMENT;
+					scanPos++;
+				} else if (c == '/' && next == '*') {
+					scanState = SCAN_BLOCK_COMMENT;
+					scanPos++;
+				} else if (c == ';' && isComplete(scanPos + 1)) {
+					// the ';' in the body of CREATE TRIGGER does not complete the statement
+					scanPos++;
+					stmtEnd = scanPos;
+					return true;
+				}
+			} else if ((scanState == SCAN_SINGLE_QUOTE && c == '\'')
+				|| (scanState == SCAN_DOUBLE_QUOTE && c == '"')
+				|| (scanState == SCAN_BACKTICK && c == '`')
+				|| (scanState == SCAN_BRACKET && c == ']')
+				|| (scanState == SCAN_LINE_COMMENT && c == '\n')) {
+				// the escaped quote '' is scanned as the end and the begin of the quote
+				scanState = SCAN_NORMAL;
+			} else if (scanState == SCAN_BLOCK_COMMENT && c == '*' && next == '/') {
+				scanState = SCAN_NORMAL;
+				scanPos++;
+			}
+			if (c == '\n') {
+				scanLine++;
+			}
+			scanPos++;
+		}
+		if (!readChunk()) {
+			stmtEnd = dataLen;
+			return false;
+		}
+	}
+}
+
+/**
+ * Whether the text from stmtBegin to end is a complete statement.
+ */
+bool QSqlScriptImporter::isComplete(size_t end)
+{
+	char c = buffer[end];
+	buffer[end] = '\0';
+	bool result = sqlite3_complete(buffer.data() + stmtBegin) != 0;
+	buffer[end] = c;
+	return result;
+}
+
+/**
+ * Prepare and step the statement(s) in the sql text.
+ *
+ * @param sql - the UTF-8 sql text, not end with '\0'
+ * @param len - the bytes of sql
+ * @param line - the line of the begin of sql
+ * @return the executed statements
+ */
+int QSqlScriptImporter::executeStatement(const char * sql, size_t len, uint64_t line)
+{
+	int n = 0;
+	sqlite3 * handle = connect->getHandle();
+	const char * tail = sql;
+	const char * end = sql + len;
+	while (tail < end) {
+		// the line of error is the line of the first non-space byte
+		while (tail < end && isspace(static_cast<unsigned char>(*tail))) {
+			if (*tail == '\n') {
+				line++;
+			}
+			tail++;
+		}
+		if (tail == end) {
+			break;
+		}
+		size_t bytes = end - tail;
+		if (isOutsideBatchStatement(tail, bytes)) {
+			// the transaction statements of the script, VACUUM, ATTACH and PRAGMA run outside of the batch
+			if (isBatchBegan) {
+				execOrThrow("COMMIT;", line);
+				isBatchBegan = false;
+			}
+		} else if (!isBatchBegan && sqlite3_get_autocommit(handle)) {
+			execOrThrow("BEGIN;", line);
+			isBatchBegan = true;
+			batchCount = 0;
+		}
+
+		sqlite3_stmt * stmt = nullptr;
+		const char * next = nullptr;
+		int rc = sqlite3_prepare_v2(handle, tail, static_cast<int>(bytes), &stmt, &next);
+		if (rc != SQLITE_OK) {
+			throwError(rc, static_cast<const wchar_t *>(sqlite3_errmsg16(handle)), tail, bytes, line);
+		}
+		if (!next || next > end) {
+			next = end;
+		}
+		if (stmt) {
+			do {
+				rc = sqlite3_step(stmt);
+			} while (rc == SQLITE_ROW);
+			if (rc != SQLITE_DONE) {
+				std::wstring msg = static_cast<const wchar_t *>(sqlite3_errmsg16(handle));
+				rc = sqlite3_extended_errcode(handle);
+				sqlite3_finalize(stmt);
+				throwError(rc, msg, tail, next - tail, line);
+			}
+			sqlite3_finalize(stmt);
+			n++;
+			if (isBatchBegan && ++batchCount >= batchStatements) {
+				execOrThrow("COMMIT;", line);
+				isBatchBegan = false;
+			}
+		}
+		line += countLines(tail, next);
+		tail = next;
+	}
+	return n;
+}
+
+void QSqlScriptImporter::execOrThrow(const char * sql, uint64_t line)
+{
+	sqlite3 * handle = connect->getHandle();
+	int rc = sqlite3_exec(handle, sql, nullptr, nullptr, nullptr);
+	if (rc != SQLITE_OK) {
+		throwError(rc, static_cast<const wchar_t *>(sqlite3_errmsg16(handle)), sql, strlen(sql), line);
+	}
+}
+
+/**
+ * Throw QSqlExecuteException, the row of exception is the line of the error statement in the file.
+ */
+void QSqlScriptImporter::throwError(int code, const std::wstring & msg, const char * sql, size_t len, uint64_t line)
+{
+	size_t n = (std::min)(len, static_cast<size_t>(QSQL_SCRIPT_ERROR_SQL_LEN));
+	// don't cut the UTF-8 character
+	while (n < len && n > 0 && (static_cast<unsigned char>(sql[n]) & 0xC0) == 0x80) {
+		n--;
+	}
+	std::wstring errSql = StringUtil::utf82Unicode(std::string(sql, n));
+	if (n < len) {
+		errSql.append(L"...");
+	}
+	QSqlExecuteException ex(std::to_wstring(code), msg, errSql);
+	ex.setErrRow(static_cast<uint32_t>(line));
+	ex.setRollBack(true);
+	throw ex;
+}
+
+/**
+ * Whether the statement must run outside of the batch transaction, the statements are:
+ * BEGIN, COMMIT, END, ROLLBACK, SAVEPOINT, RELEASE, VACUUM, ATTACH, DETACH, PRAGMA.
+ */
+bool QSqlScriptImporter::isOutsideBatchStatement(const char * sql, size_t len)
+{
+	static const char * keywords[] = { "BEGIN", "COMMIT", "END", "ROLLBACK", "SAVEPOINT", "RELEASE",
+		"VACUUM", "ATTACH", "DETACH", "PRAGMA" };
+	const char * p = sql;
+	const char * end = sql + len;
+	// skip the spaces and comments before the first keyword
+	while (p < end) {
+		if (isspace(static_cast<unsigned char>(*p))) {
+			p++;
+		} else if (*p == '-' && p + 1 < end && p[1] == '-') {
+			while (p < end && *p != '\n') p++;
+		} else if (*p == '/' && p + 1 < end && p[1] == '*') {
+			p += 2;
+			while (p + 1 < end && !(p[0] == '*' && p[1] == '/')) p++;
+			p += 2;
+		} else {
+			break;
+		}
+	}
+	char word[16] = { 0 };
+	size_t n = 0;
+	while (p < end && n < sizeof(word) - 1 && isalpha(static_cast<unsigned char>(*p))) {
+		word[n++] = static_cast<char>(toupper(static_cast<unsigned char>(*p++)));
+	}
+	if (!n) {
+		return false;
+	}
+	for (auto keyword : keywords) {
+		if (strcmp(word, keyword) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+uint64_t QSqlScriptImporter::countLines(const char * begin, const char * end)
+{
+	return static_cast<uint64_t>(std::count(begin, end, '\n'));
+}
@@ -0,0 +1,99 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlScriptImporter.h
+ * @brief  Execute the statements of the UTF-8 sql script file one by one, the file is read by chunks,
+ *         so the memory is constant whatever the size of the file is.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "QSqlDatabase.h"
+
+// the bytes read from the sql file once
+#define QSQL_SCRIPT_CHUNK_SIZE (1024 * 1024)
+// the statements are committed every QSQL_SCRIPT_BATCH_STATEMENTS statements if the script does not begin a transaction
+#define QSQL_SCRIPT_BATCH_STATEMENTS 10000
+
+typedef struct _QSqlScriptProgress {
+	uint64_t totalBytes = 0;  // the size of the file
+	uint64_t doneBytes = 0;   // the bytes of the executed statements
+	uint64_t statements = 0;  // the executed statements
+} QSqlScriptProgress;
+
+// Called after every statement has been executed, return non-zero to stop the import
+typedef int (*QSqlScriptProgressHandler)(const QSqlScriptProgress & progress, void * arg);
+
+class QSqlScriptImporter
+{
+public:
+	QSqlScriptImporter(QSqlDatabase * connect, int batchStatements = QSQL_SCRIPT_BATCH_STATEMENTS);
+	~QSqlScriptImporter();
+
+	// Import the sql file, throw QSqlExecuteException with the line of the error statement, return the executed statements
+	uint64_t import(const std::wstring & path, QSqlScriptProgressHandler progressHandler = nullptr, void * progressArg = nullptr);
+	// Interrupt the running statement, can be called by the other thread
+	void cancel();
+	const QSqlScriptProgress & getProgress() const { return progress; }
+private:
+	typedef enum {
+		SCAN_NORMAL = 0,
+		SCAN_SINGLE_QUOTE,   // 'string'
+		SCAN_DOUBLE_QUOTE,   // "identifier"
+		SCAN_BACKTICK,       // `identifier`
+		SCAN_BRACKET,        // [identifier]
+		SCAN_LINE_COMMENT,   // -- comment
+		SCAN_BLOCK_COMMENT   /* comment */
+	} ScanState;
+
+	QSqlDatabase * connect = nullptr;
+	int batchStatements = QSQL_SCRIPT_BATCH_STATEMENTS;
+	std::atomic<bool> canceled{ false };
+
+	FILE * file = nullptr;
+	std::wstring filePath;
+	bool isEof = false;
+	QSqlScriptProgress progress;
+
+	// the bytes have been read but not executed yet
+	std::vector<char> buffer;
+	size_t dataLen = 0;
+	size_t scanPos = 0;     // the bytes before scanPos have been scanned
+	size_t stmtBegin = 0;   // the begin of the statement that is not executed yet
+	ScanState scanState = SCAN_NORMAL;
+	uint64_t bufferOffset = 0; // the file offset of buffer[0]
+	uint64_t stmtLine = 1;  // the line of stmtBegin
+	uint64_t scanLine = 1;  // the line of scanPos
+
+	// the transaction began by importer
+	bool isBatchBegan = false;
+	int batchCount = 0;
+
+	void openFile(const std::wstring & path);
+	void closeFile();
+	bool readChunk();
+	bool nextStatement(size_t & stmtEnd);
+	bool isComplete(size_t end);
+	int executeStatement(const char * sql, size_t len, uint64_t line);
+	void execOrThrow(const char * sql, uint64_t line);
+	void throwError(int code, const std::wstring & msg, const char * sql, size_t len, uint64_t line);
+
+	static bool isOutsideBatchStatement(const char * sql, size_t len);
+	static uint64_t countLines(const char * begin, const char * end);
+};
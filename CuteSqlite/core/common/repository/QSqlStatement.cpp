@@ -17,7 +17,7 @@ namespace SQLite
 QSqlStatement::QSqlStatement(const QSqlDatabase* aDatabase, const wchar_t* apQuery) :
     mQuery(apQuery),
     mpSQLite(aDatabase->getHandle()),
-    mpPreparedStatement(prepareStatement()) // prepare the SQL query (needs Database friendship)
+    mpPreparedStatement(prepareStatement(aDatabase->getStatementCache().get())) // prepare the SQL query (needs Database friendship)
 {
     mColumnCount = sqlite3_column_count(mpPreparedStatement.get());
 }
@@ -212,7 +212,15 @@ int QSqlStatement::tryExecuteStep() noexcept
         return SQLITE_MISUSE; // Statement needs to be reseted !
     }
 
+    const bool isFirstStep = !mbHasRow;
     const int ret = sqlite3_step(mpPreparedStatement.get());
+    // SQLite reprepares the statement at the first step if the schema has been changed since it was prepared,
+    // such as DDL by the other connection, so the column count and names read before the step may be stale
+    if (isFirstStep)
+    {
+        mColumnCount = sqlite3_column_count(mpPreparedStatement.get());
+        mColumnNames.clear();
+    }
     if (SQLITE_ROW == ret) // one row is ready : call getColumn(N) to access it
     {
         mbHasRow = true;
@@ -358,10 +366,16 @@ std::wstring QSqlStatement::getExpandedSQL() const {
 }
 
 // Prepare SQLite statement object and return shared pointer to this object
-QSqlStatement::TStatementPtr QSqlStatement::prepareStatement()
+QSqlStatement::TStatementPtr QSqlStatement::prepareStatement(QSqlStatementCache * apCache)
 {
     sqlite3_stmt* statement;
 	std::string ssql = StringUtil::unicode2Utf8(mQuery);	
+	if (apCache) {
+		TStatementPtr cached = apCache->acquire(ssql);
+		if (cached) {
+			return cached;
+		}
+	}
     const int ret = sqlite3_prepare_v2(mpSQLite, ssql.c_str(), static_cast<int>(ssql.size()), &statement, nullptr);
 	
     if (SQLITE_OK != ret)
@@ -373,6 +387,9 @@ QSqlStatement::TStatementPtr QSqlStatement::prepareStatement()
         throw SQLite::QSqlException(mpSQLite, ret);
     }
 	//free(ssql);
+	if (apCache) {
+		return apCache->wrap(statement, ssql);
+	}
     return QSqlStatement::TStatementPtr(statement, [](sqlite3_stmt* stmt)
         {
             sqlite3_finalize(stmt);
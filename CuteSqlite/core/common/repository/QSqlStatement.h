@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include "QSqlDatabase.h"
+#include "QSqlStatementCache.h"
 #include "QSqlUtil.h"
 #include "QSqlException.h"
 // Forward declarations to avoid inclusion of <sqlite3.h> in a header
@@ -674,11 +675,12 @@ private:
 	}
 
 	/**
-		* @brief Prepare statement object.
+		* @brief Prepare statement object, or take the idle one of the same sql from the statement cache of the connection.
 		*
+		* @param[in] apCache the statement cache of the connection, the statement is put back to it when released
 		* @return Shared pointer to prepared statement object
 		*/
-	TStatementPtr prepareStatement();
+	TStatementPtr prepareStatement(QSqlStatementCache * apCache);
 
 	/**
 		* @brief Return a prepared statement object.
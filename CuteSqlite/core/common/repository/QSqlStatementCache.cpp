@@ -0,0 +1,265 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlStatementCache.cpp
+ * @brief  LRU cache of the prepared statements of one connection, keyed by the SQL text.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "QSqlStatementCache.h"
+#include <cctype>
+#include <cstring>
+#include "utils/Log.h"
+
+std::atomic<uint64_t> QSqlStatementCache::schemaGeneration{ 0 };
+
+QSqlStatementCache::~QSqlStatementCache()
+{
+	setHandle(nullptr);
+}
+
+/**
+ * Set the handle when the connection is opened or closed(nullptr), the statements of the previous handle
+ * are finalized instead of putting back, so the closed connection can be released by sqlite3_close_v2.
+ * The hooks of the schema changes are installed on the opened handle.
+ */
+void QSqlStatementCache::setHandle(sqlite3 * handle)
+{
+	sqlite3 * oldHandle = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		oldHandle = this->handle;
+		this->handle = handle;
+		generation = schemaGeneration.load();
+		isDisabled = false;
+	}
+	if (oldHandle && oldHandle != handle) {
+		uninstallHooks(oldHandle);
+	}
+	clear();
+	if (handle) {
+		installHooks(handle);
+	}
+}
+
+/**
+ * Take the idle statement out of the cache, so the same sql used by the nested queries gets different statements.
+ * SQLite reprepares the statement of the old schema at its next step only, so the column count and names 
+ * of the idle statements are stale after DDL (by this or any other connection of this process), 
+ * all of them are finalized when the schema generation has been changed.
+ * 
+ * @param sql - the UTF-8 sql
+ * @return the reset statement with cleared bindings, nullptr if the sql is not cached
+ */
+QSqlStatementCache::TStatementPtr QSqlStatementCache::acquire(const std::string & sql)
+{
+	if (sql.size() > QSQL_STATEMENT_CACHE_MAX_SQL_BYTES) {
+		return nullptr;
+	}
+	sqlite3_stmt * stmt = nullptr;
+	IdleList finalizeIdles;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		uint64_t current = schemaGeneration.load();
+		if (current != generation) {
+			finalizeIdles.swap(idles);
+			idleIndexes.clear();
+			generation = current;
+		}
+		auto iter = idleIndexes.find(sql);
+		if (iter != idleIndexes.end()) {
+			stmt = iter->second->second;
+			idles.erase(iter->second);
+			idleIndexes.erase(iter);
+		}
+	}
+	for (auto & idle : finalizeIdles) {
+		sqlite3_finalize(idle.second);
+	}
+	if (!stmt) {
+		misses++;
+		return nullptr;
+	}
+	hits++;
+	return wrap(stmt, sql);
+}
+
+QSqlStatementCache::TStatementPtr QSqlStatementCache::wrap(sqlite3_stmt * stmt, const std::string & sql)
+{
+	// the DDL is not cached, the authorizer is only called when it is prepared
+	if (sql.size() > QSQL_STATEMENT_CACHE_MAX_SQL_BYTES || isSchemaSql(sql)) {
+		return makeFinalizePtr(stmt);
+	}
+	// the schema generation that the statement is prepared with, the statement is not put back if the schema has been changed
+	uint64_t version = 0;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (isDisabled) {
+			return makeFinalizePtr(stmt);
+		}
+		version = generation;
+	}
+	// the statement may be released after the connection and its cache have been destroyed
+	std::weak_ptr<QSqlStatementCache> weakCache = shared_from_this();
+	return TStatementPtr(stmt, [weakCache, sql, version](sqlite3_stmt * stmt) {
+		auto cache = weakCache.lock();
+		if (cache) {
+			cache->release(stmt, sql, version);
+		} else {
+			sqlite3_finalize(stmt);
+		}
+	});
+}
+
+void QSqlStatementCache::clear()
+{
+	IdleList finalizeIdles;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		finalizeIdles.swap(idles);
+		idleIndexes.clear();
+	}
+	for (auto & idle : finalizeIdles) {
+		sqlite3_finalize(idle.second);
+	}
+}
+
+size_t QSqlStatementCache::size()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return idles.size();
+}
+
+/**
+ * Put the released statement back to the cache, the least recently used statement is finalized if the cache is full.
+ */
+void QSqlStatementCache::release(sqlite3_stmt * stmt, const std::string & sql, uint64_t version)
+{
+	sqlite3_reset(stmt);
+	sqlite3_clear_bindings(stmt);
+
+	sqlite3_stmt * finalizeStmt = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (sqlite3_db_handle(stmt) != handle || version != generation || version != schemaGeneration.load() || idleIndexes.count(sql)) {
+			// the connection has been closed, the schema has been changed since the statement was prepared,
+			// or the nested query of the same sql has put back one idle statement
+			finalizeStmt = stmt;
+		} else {
+			idles.emplace_front(sql, stmt);
+			idleIndexes[sql] = idles.begin();
+			if (idles.size() > capacity) {
+				finalizeStmt = idles.back().second;
+				idleIndexes.erase(idles.back().first);
+				idles.pop_back();
+			}
+		}
+	}
+	if (finalizeStmt) {
+		sqlite3_finalize(finalizeStmt);
+	}
+}
+
+/**
+ * The authorizer finds the DDL of this connection when it is prepared, the commit and rollback hooks 
+ * increase the generation again when the transaction with DDL ends, because the rollback restores the old schema.
+ * The cache is disabled if the authorizer can't be installed, the schema changes can't be found without it.
+ */
+void QSqlStatementCache::installHooks(sqlite3 * handle)
+{
+	int rc = sqlite3_set_authorizer(handle, &QSqlStatementCache::onAuthorize, this);
+	if (rc != SQLITE_OK) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			isDisabled = true;
+		}
+		Q_WARN(L"The statement cache is disabled, the authorizer can't be installed, code:{}", rc);
+		return;
+	}
+	sqlite3_commit_hook(handle, &QSqlStatementCache::onCommit, this);
+	sqlite3_rollback_hook(handle, &QSqlStatementCache::onRollback, this);
+}
+
+void QSqlStatementCache::uninstallHooks(sqlite3 * handle)
+{
+	sqlite3_set_authorizer(handle, nullptr, nullptr);
+	sqlite3_commit_hook(handle, nullptr, nullptr);
+	sqlite3_rollback_hook(handle, nullptr, nullptr);
+}
+
+/**
+ * Whether the sql changes the schema by its first keyword, such statements are not cached, 
+ * because the authorizer is only called when they are prepared.
+ */
+bool QSqlStatementCache::isSchemaSql(const std::string & sql)
+{
+	size_t start = sql.find_first_not_of(" \t\r\n");
+	if (start == std::string::npos) {
+		return false;
+	}
+	for (auto keyword : { "CREATE", "DROP", "ALTER", "ATTACH", "DETACH" }) {
+		size_t len = std::strlen(keyword);
+		if (sql.size() - start < len) {
+			continue;
+		}
+		size_t i = 0;
+		while (i < len && std::toupper(static_cast<unsigned char>(sql[start + i])) == keyword[i]) {
+			i++;
+		}
+		if (i == len) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int QSqlStatementCache::onAuthorize(void * cache, int action, const char *, const char *, const char *, const char *)
+{
+	switch (action) {
+	case SQLITE_CREATE_INDEX: case SQLITE_CREATE_TABLE: case SQLITE_CREATE_TEMP_INDEX: case SQLITE_CREATE_TEMP_TABLE:
+	case SQLITE_CREATE_TEMP_TRIGGER: case SQLITE_CREATE_TEMP_VIEW: case SQLITE_CREATE_TRIGGER: case SQLITE_CREATE_VIEW:
+	case SQLITE_DROP_INDEX: case SQLITE_DROP_TABLE: case SQLITE_DROP_TEMP_INDEX: case SQLITE_DROP_TEMP_TABLE:
+	case SQLITE_DROP_TEMP_TRIGGER: case SQLITE_DROP_TEMP_VIEW: case SQLITE_DROP_TRIGGER: case SQLITE_DROP_VIEW:
+	case SQLITE_ALTER_TABLE: case SQLITE_CREATE_VTABLE: case SQLITE_DROP_VTABLE: case SQLITE_ATTACH: case SQLITE_DETACH:
+		static_cast<QSqlStatementCache *>(cache)->hasDdl = true;
+		schemaGeneration++;
+		break;
+	default:
+		break;
+	}
+	return SQLITE_OK;
+}
+
+int QSqlStatementCache::onCommit(void * cache)
+{
+	if (static_cast<QSqlStatementCache *>(cache)->hasDdl.exchange(false)) {
+		schemaGeneration++;
+	}
+	return 0; // the commit goes on
+}
+
+void QSqlStatementCache::onRollback(void * cache)
+{
+	if (static_cast<QSqlStatementCache *>(cache)->hasDdl.exchange(false)) {
+		schemaGeneration++;
+	}
+}
+
+QSqlStatementCache::TStatementPtr QSqlStatementCache::makeFinalizePtr(sqlite3_stmt * stmt)
+{
+	return TStatementPtr(stmt, [](sqlite3_stmt* stmt) {
+		sqlite3_finalize(stmt);
+	});
+}
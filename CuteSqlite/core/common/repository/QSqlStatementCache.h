@@ -0,0 +1,90 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   QSqlStatementCache.h
+ * @brief  LRU cache of the prepared statements of one connection, keyed by the SQL text.
+ *         The statement is taken out of the cache while it is used, and put back 
+ *         (reset and bindings cleared) when the last QSqlStatement/QSqlColumn referencing it is released.
+ *         The cache is flushed when the schema generation changes, it is increased by the authorizer (DDL is prepared)
+ *         and the commit/rollback hooks (the transaction with DDL ends) of all the connections of this process,
+ *         so no SQL is run to check the schema. The DDL by the other processes is found by SQLite at the next step.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <sqlite3/sqlite3.h>
+
+// the max idle statements kept in the cache of one connection
+#define QSQL_STATEMENT_CACHE_CAPACITY 64
+// the longer sql is not cached, such as the INSERT statement with literal values
+#define QSQL_STATEMENT_CACHE_MAX_SQL_BYTES 4096
+
+class QSqlStatementCache : public std::enable_shared_from_this<QSqlStatementCache>
+{
+public:
+	using TStatementPtr = std::shared_ptr<sqlite3_stmt>;
+
+	QSqlStatementCache(size_t capacity = QSQL_STATEMENT_CACHE_CAPACITY) : capacity(capacity) {}
+	~QSqlStatementCache();
+
+	// Set the opened connection handle, the idle statements of the previous handle are finalized
+	void setHandle(sqlite3 * handle);
+	// Take the idle statement of sql out of the cache, return nullptr if not cached or the schema has been changed
+	TStatementPtr acquire(const std::string & sql);
+	// Wrap the new prepared statement, it is put back to the cache instead of finalizing when the last reference is released
+	TStatementPtr wrap(sqlite3_stmt * stmt, const std::string & sql);
+	// Finalize all the idle statements
+	void clear();
+
+	size_t size();
+	uint64_t getHits() const { return hits.load(); }
+	uint64_t getMisses() const { return misses.load(); }
+
+	// Increased when DDL is prepared or a transaction with DDL ends (commit or rollback) on any connection of this process
+	static uint64_t getSchemaGeneration() { return schemaGeneration.load(); }
+private:
+	typedef std::list<std::pair<std::string, sqlite3_stmt *>> IdleList;
+
+	size_t capacity;
+	std::atomic<uint64_t> hits{ 0 };
+	std::atomic<uint64_t> misses{ 0 };
+
+	static std::atomic<uint64_t> schemaGeneration;
+	// DDL has been prepared in the current transaction of this connection
+	std::atomic<bool> hasDdl{ false };
+
+	// protects handle, generation, idles and idleIndexes, the statements may be released by other threads
+	std::mutex mutex;
+	sqlite3 * handle = nullptr;
+	// the idle statements are prepared with the schema of this generation
+	uint64_t generation = 0;
+	bool isDisabled = false;
+	IdleList idles; // the front is the most recently used
+	std::unordered_map<std::string, IdleList::iterator> idleIndexes;
+
+	void release(sqlite3_stmt * stmt, const std::string & sql, uint64_t version);
+	void installHooks(sqlite3 * handle);
+	static void uninstallHooks(sqlite3 * handle);
+	static bool isSchemaSql(const std::string & sql);
+	static int onAuthorize(void * cache, int action, const char *, const char *, const char *, const char *);
+	static int onCommit(void * cache);
+	static void onRollback(void * cache);
+	static TStatementPtr makeFinalizePtr(sqlite3_stmt * stmt);
+};
@@ -149,6 +149,26 @@ typedef std::vector<std::wstring> RowItem, Columns, Functions, UserTableStrings,
 // data items list
 typedef std::list<RowItem> DataList;
 
+// The keyset of table scan, the next page reads the rows whose key is greater than the key of last row,
+// so walking the whole table is linear in its size (the OFFSET of LIMIT clause rescans all the skipped rows)
+// The typed value of a key column, it is bound back to the statement by its storage class,
+// so a REAL key is not rounded and a INTEGER key is not compared as text
+typedef struct _TableKeyValue {
+	int type = 0;            // SQLite::INTEGER, SQLite::FLOAT, SQLite::TEXT, SQLite::BLOB or SQLite::Null
+	int64_t intVal = 0;
+	double floatVal = 0;
+	std::wstring text;
+	std::string blob;
+} TableKeyValue;
+typedef std::vector<TableKeyValue> TableKeyValues;
+
+typedef struct _TableKeyset {
+	Columns keyColumns; // the rowid of rowid table or the primary key columns of WITHOUT ROWID table
+	bool isRowId = false;
+	TableKeyValues lastKeys; // the key values of the last row has been read, empty before reading the first page
+	bool isEnd = false; // all the rows have been read
+} TableKeyset;
+
 //select sql - limit clause params
 typedef struct _LimitParams {
 	bool checked = false;
@@ -164,6 +184,54 @@ typedef struct {
 } SubItemValue;
 typedef std::vector<SubItemValue> SubItemValues;
 
+// The type affinity of column, see the rules of "Determination Of Column Affinity" of SQLite
+typedef enum {
+	COLUMN_AFFINITY_TEXT = 0,
+	COLUMN_AFFINITY_INTEGER,
+	COLUMN_AFFINITY_REAL,
+	COLUMN_AFFINITY_NUMERIC,
+	COLUMN_AFFINITY_BLOB // the declared type is empty or has "BLOB", the values are stored as they are
+} ColumnAffinity;
+
+// The value of column in the row change, bound to the prepared statement by its type
+typedef enum {
+	ROW_VALUE_TEXT = 0,
+	ROW_VALUE_INTEGER,
+	ROW_VALUE_FLOAT,
+	ROW_VALUE_NULL
+} RowValueType;
+
+typedef struct _RowChangeValue {
+	std::wstring column;
+	std::wstring val;
+	RowValueType type = ROW_VALUE_TEXT;
+} RowChangeValue;
+typedef std::vector<RowChangeValue> RowChangeValues;
+
+typedef enum {
+	ROW_CHANGE_UPDATE = 0,
+	ROW_CHANGE_INSERT,
+	ROW_CHANGE_DELETE
+} RowChangeType;
+
+// The changes of one row in the table, applied by TableService::applyRowChanges()
+typedef struct _RowChange {
+	RowChangeType type = ROW_CHANGE_UPDATE;
+	int iItem = -1;         // the row index of list view, for reporting the failed row
+	RowChangeValues values; // UPDATE - the changed columns, INSERT - the inserted columns
+	RowChangeValues keys;   // UPDATE/DELETE - the columns of WHERE clause, "ROWID" for the rowid table
+} RowChange;
+typedef std::vector<RowChange> RowChanges;
+
+// The failed row of the row changes
+typedef struct _RowChangeError {
+	int iItem = -1;
+	int code = 0;
+	std::wstring msg;
+	std::wstring sql;
+} RowChangeError;
+typedef std::vector<RowChangeError> RowChangeErrors;
+
 //Insert statement params for export as sql 
 typedef struct _InsertStatementParams {
 	bool retainColumn = false;
@@ -352,6 +420,22 @@ typedef struct _TblIdxSpaceUsed {
 	uint64_t cnt = 0;				// Total record count : count(*) as cnt
 } TblIdxSpaceUsed;
 typedef std::list<TblIdxSpaceUsed> TblIdxSpaceUsedList;
+// template params: first(std::wstring) - name of table or index, second(TblIdxSpaceUsed) - the space used
+typedef std::unordered_map<std::wstring, TblIdxSpaceUsed> TblIdxSpaceUsedMap;
+
+// The counters of database changes, if any one is changed, the cached analysis of database is stale.
+typedef struct _DbChangeCounter {
+	uint32_t fileChangeCounter = 0; // The file change counter in the database header (offset 24), not changed by WAL commits
+	int64_t dataVersion = 0;		// PRAGMA data_version, changed by the commits of other connections (include WAL commits)
+	int64_t schemaVersion = 0;		// PRAGMA schema_version, changed by DDL
+	int64_t totalChanges = 0;		// The rows changed by this connection
+
+	bool operator==(const _DbChangeCounter & other) const {
+		return fileChangeCounter == other.fileChangeCounter && dataVersion == other.dataVersion
+			&& schemaVersion == other.schemaVersion && totalChanges == other.totalChanges;
+	}
+	bool operator!=(const _DbChangeCounter & other) const { return !(*this == other); }
+} DbChangeCounter;
 
 
 typedef struct _DbSpaceUsed {
@@ -47,8 +47,13 @@ int SqlLogRepository::remove(uint64_t id)
 		return false;
 	}
 	//sql
+	initBodyTable();
 	std::wstring sql = L"DELETE FROM sql_log WHERE id=:id ";
 	try {
+		QSqlStatement bodyQuery(getSysConnect(), L"DELETE FROM sql_log_body WHERE sql_log_id=:id");
+		bodyQuery.bind(L":id", id);
+		bodyQuery.exec();
+
 		QSqlStatement query(getSysConnect(), sql.c_str());
 		query.bind(L":id", id);
 
@@ -68,7 +73,9 @@ SqlLog SqlLogRepository::getById(uint64_t id)
 		return SqlLog();
 	}
 
-	std::wstring sql = L"SELECT * FROM sql_log WHERE id=:id";
+	initBodyTable();
+	// the whole sql of the truncated sql is kept in sql_log_body
+	std::wstring sql = L"SELECT l.*, b.sql AS body_sql FROM sql_log l LEFT JOIN sql_log_body b ON b.sql_log_id=l.id WHERE l.id=:id";
 
 	try {
 		QSqlStatement query(getSysConnect(), sql.c_str());
@@ -81,6 +88,9 @@ SqlLog SqlLogRepository::getById(uint64_t id)
 
 		Q_DEBUG(L"Get sql_log detail success");
 		SqlLog item = toSqlLog(query);
+		if (!query.getColumn(L"body_sql").isNull()) {
+			item.sql = query.getColumn(L"body_sql").getText();
+		}
 		return item;
 	} catch (SQLite::QSqlException &e) {
 		std::wstring _err = e.getErrorStr();
@@ -176,8 +186,13 @@ int SqlLogRepository::removeByBiggerId(uint64_t id)
 		return 0;
 	}
 	//sql
+	initBodyTable();
 	std::wstring sql = L"DELETE FROM sql_log WHERE id>:id ";
 	try {
+		QSqlStatement bodyQuery(getSysConnect(), L"DELETE FROM sql_log_body WHERE sql_log_id>:id");
+		bodyQuery.bind(L":id", id);
+		bodyQuery.exec();
+
 		QSqlStatement query(getSysConnect(), sql.c_str());
 		query.bind(L":id", id);
 
@@ -353,6 +368,25 @@ uint64_t SqlLogRepository::getCountByKeyword(const std::wstring & keyword)
 	}
 }
 
+/**
+ * Create the table sql_log_body if not exists, the system db file of old version has no this table.
+ */
+void SqlLogRepository::initBodyTable()
+{
+	if (isInitBodyTable) {
+		return;
+	}
+	std::wstring sql = L"CREATE TABLE IF NOT EXISTS sql_log_body (sql_log_id INTEGER PRIMARY KEY, sql TEXT NOT NULL DEFAULT '')";
+	try {
+		getSysConnect()->exec(sql.c_str());
+		isInitBodyTable = true;
+	} catch (SQLite::QSqlException &e) {
+		std::wstring _err = e.getErrorStr();
+		Q_ERROR(L"exec sql has error, code:{}, msg:{}, sql:{}", e.getErrorCode(), _err, sql);
+		throw QRuntimeException(L"000045", L"sorry, system has error when creating sql_log_body.");
+	}
+}
+
 void SqlLogRepository::queryBind(QSqlStatement &query, SqlLog &item, bool isUpdate /*= false*/)
 {
 	if (isUpdate) {
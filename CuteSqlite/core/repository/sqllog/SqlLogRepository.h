@@ -37,12 +37,15 @@ public:
 	std::vector<uint64_t>  getFrontIds(uint64_t limit = LIMIT_MAX);
 	int removeByBiggerId(uint64_t id);
 	int topById(uint64_t id, int topVal);
+	void initBodyTable();
 
 	SqlLogList getPage(int page, int perPage);
 	SqlLogList getTopByKeyword(const std::wstring & keyword);
 	SqlLogList getPageByKeyword(const std::wstring & keyword, int page, int perPage);
 	uint64_t  getCountByKeyword(const std::wstring & keyword);
 private:
+	bool isInitBodyTable = false;
+
 	void queryBind(QSqlStatement &query, SqlLog &item, bool isUpdate = false);
 	SqlLog toSqlLog(QSqlStatement &query);
 
@@ -0,0 +1,199 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   SqlLogWriter.cpp
+ * @brief  Write the sql logs to the system db in a worker thread with its own connection,
+ *         the logs posted in a short interval are committed in one transaction.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "SqlLogWriter.h"
+#include <algorithm>
+#include <chrono>
+#include <sqlite3/sqlite3.h>
+#include "core/common/repository/QSqlStatement.h"
+#include "utils/Log.h"
+
+SqlLogWriter::~SqlLogWriter()
+{
+	stop();
+}
+
+void SqlLogWriter::start(const std::wstring & dbPath)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (isStarted) {
+		return;
+	}
+	this->dbPath = dbPath;
+	isStop = false;
+	isStarted = true;
+	worker = std::thread(&SqlLogWriter::run, this);
+}
+
+bool SqlLogWriter::post(SqlLog && sqlLog)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!isStarted || isStop) {
+			return false;
+		}
+		if (queue.size() >= SQL_LOG_QUEUE_MAX) {
+			// don't wait for the writer, the history is not worth blocking the window
+			if ((droppedCount++ & 0xff) == 0) {
+				Q_WARN(L"sql log queue is full, dropped:{}", droppedCount);
+			}
+			return false;
+		}
+		queue.push_back(std::move(sqlLog));
+	}
+	queueCond.notify_one();
+	return true;
+}
+
+/**
+ * Called when the application exits, the worker thread writes all the queued logs before it exits.
+ */
+void SqlLogWriter::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!isStarted) {
+			return;
+		}
+		isStop = true;
+	}
+	queueCond.notify_one();
+	if (worker.joinable()) {
+		worker.join();
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	isStarted = false;
+}
+
+bool SqlLogWriter::isRunning()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return isStarted && !isStop;
+}
+
+void SqlLogWriter::run()
+{
+	if (!openConnect()) {
+		std::lock_guard<std::mutex> lock(mutex);
+		Q_ERROR(L"open sql log writer connect has error, dropped:{}", queue.size());
+		queue.clear();
+		isStop = true;
+		return;
+	}
+
+	std::vector<SqlLog> batch;
+	batch.reserve(SQL_LOG_BATCH_MAX);
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			queueCond.wait(lock, [this] { return !queue.empty() || isStop; });
+			if (queue.empty()) {
+				break; // isStop and all the logs have been written
+			}
+			// group commit: wait a while for the following logs unless the batch is full or stopping
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(SQL_LOG_COMMIT_INTERVAL);
+			queueCond.wait_until(lock, deadline, [this] { return queue.size() >= SQL_LOG_BATCH_MAX || isStop; });
+
+			size_t n = std::min(queue.size(), static_cast<size_t>(SQL_LOG_BATCH_MAX));
+			for (size_t i = 0; i < n; i++) {
+				batch.push_back(std::move(queue.front()));
+				queue.pop_front();
+			}
+		}
+		writeBatch(batch);
+		batch.clear();
+	}
+	closeConnect();
+}
+
+bool SqlLogWriter::openConnect()
+{
+	connect.reset(new QSqlDatabase(L"sqlite3_sql_log_writer"));
+	connect->setDatabaseName(dbPath);
+	if (!connect->open()) {
+		return false;
+	}
+	connect->setBusyTimeout(SQL_LOG_BUSY_TIMEOUT);
+	return true;
+}
+
+void SqlLogWriter::closeConnect()
+{
+	if (!connect) {
+		return;
+	}
+	connect->close();
+	connect.reset();
+}
+
+/**
+ * Write the logs in one transaction, the batch is dropped if it has error, the history is not worth retrying.
+ */
+void SqlLogWriter::writeBatch(std::vector<SqlLog> & batch)
+{
+	try {
+		connect->exec(L"BEGIN IMMEDIATE;");
+		for (auto & item : batch) {
+			writeSqlLog(item);
+		}
+		connect->exec(L"COMMIT;");
+	} catch (SQLite::QSqlException &e) {
+		std::wstring _err = e.getErrorStr();
+		Q_ERROR(L"write sql log has error, code:{}, msg:{}, dropped:{}", e.getErrorCode(), _err, batch.size());
+		if (!sqlite3_get_autocommit(connect->getHandle())) {
+			connect->tryExec(L"ROLLBACK;");
+		}
+	}
+}
+
+void SqlLogWriter::writeSqlLog(SqlLog & item)
+{
+	bool isTruncated = item.sql.size() > SQL_LOG_MAX_SQL_LENGTH;
+	{
+		QSqlStatement query(connect.get(), L"INSERT INTO sql_log (user_db_id, sql, effect_rows, code, msg, exec_time, transfer_time, total_time, top, created_at, updated_at) \
+			VALUES (:user_db_id, :sql, :effect_rows, :code, :msg, :exec_time, :transfer_time, :total_time, :top, :created_at, :updated_at)");
+		if (isTruncated) {
+			// the list and the keyword search of sql log only need the head of sql
+			query.bind(L":sql", item.sql.substr(0, SQL_LOG_MAX_SQL_LENGTH).append(L"..."));
+		} else {
+			query.bindNoCopy(L":sql", item.sql);
+		}
+		query.bind(L":user_db_id", item.userDbId);
+		query.bind(L":effect_rows", item.effectRows);
+		query.bind(L":code", item.code);
+		query.bindNoCopy(L":msg", item.msg);
+		query.bindNoCopy(L":exec_time", item.execTime);
+		query.bindNoCopy(L":transfer_time", item.transferTime);
+		query.bindNoCopy(L":total_time", item.totalTime);
+		query.bind(L":top", item.top);
+		query.bindNoCopy(L":created_at", item.createdAt);
+		query.bindNoCopy(L":updated_at", item.createdAt);
+		query.exec();
+	}
+	if (!isTruncated) {
+		return;
+	}
+
+	QSqlStatement query(connect.get(), L"INSERT INTO sql_log_body (sql_log_id, sql) VALUES (:sql_log_id, :sql)");
+	query.bind(L":sql_log_id", connect->getLastInsertRowid());
+	query.bindNoCopy(L":sql", item.sql);
+	query.exec();
+}
@@ -0,0 +1,74 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   SqlLogWriter.h
+ * @brief  Write the sql logs to the system db in a worker thread with its own connection,
+ *         the logs posted in a short interval are committed in one transaction.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/entity/Entity.h"
+#include "core/common/repository/QSqlDatabase.h"
+
+// the logs waiting to be written, the new log is dropped if the queue is full
+#define SQL_LOG_QUEUE_MAX 4096
+// the max logs committed in one transaction
+#define SQL_LOG_BATCH_MAX 512
+// the interval(ms) that the writer waits for more logs before commit
+#define SQL_LOG_COMMIT_INTERVAL 200
+// the sql longer than it is truncated in sql_log, the whole sql is kept in sql_log_body
+#define SQL_LOG_MAX_SQL_LENGTH 16384
+// the busy timeout(ms) of the writer connection
+#define SQL_LOG_BUSY_TIMEOUT 5000
+
+class SqlLogWriter
+{
+public:
+	SqlLogWriter() = default;
+	~SqlLogWriter();
+
+	// Start the worker thread if it is not running
+	void start(const std::wstring & dbPath);
+	// Queue the log without waiting, return false if the queue is full or the writer is not started
+	bool post(SqlLog && sqlLog);
+	// Write all the queued logs, then stop the worker thread
+	void stop();
+	bool isRunning();
+private:
+	std::thread worker;
+	std::wstring dbPath;
+	std::unique_ptr<QSqlDatabase> connect;
+
+	// protects queue, isStarted and isStop
+	std::mutex mutex;
+	std::condition_variable queueCond;
+	std::deque<SqlLog> queue;
+	bool isStarted = false;
+	bool isStop = false;
+	uint64_t droppedCount = 0;
+
+	void run();
+	bool openConnect();
+	void closeConnect();
+	void writeBatch(std::vector<SqlLog> & batch);
+	void writeSqlLog(SqlLog & item);
+};
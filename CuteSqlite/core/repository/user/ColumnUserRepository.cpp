@@ -32,12 +32,22 @@ ColumnInfoList ColumnUserRepository::getListByTblName(uint64_t userDbId, const s
 	} 
 	sql.append(L"table_info(\"").append(tblName).append(L"\")");
 	try {
+		UserCatalog * catalog = QCatalog::isCacheable(schema) ? &getUserCatalog(userDbId) : nullptr;
+		if (catalog) {
+			auto iter = catalog->columnsMap.find(tblName);
+			if (iter != catalog->columnsMap.end()) {
+				return iter->second;
+			}
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 
 		while (query.executeStep()) {
 			ColumnInfo item = toColumnInfo(query);
 			result.push_back(item);
 		}
+		if (catalog) {
+			catalog->columnsMap[tblName] = result;
+		}
 		return result;
 	} catch (SQLite::QSqlException &ex) {
 		std::wstring _err = ex.getErrorStr();
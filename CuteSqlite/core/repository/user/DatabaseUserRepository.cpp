@@ -49,6 +49,10 @@ Functions DatabaseUserRepository::getFunctions(int64_t userDbId)
 {
 	std::wstring sql = L"PRAGMA function_list;";
 	try {
+		UserCatalog & catalog = getUserCatalog(userDbId);
+		if (!catalog.functions.empty()) {
+			return catalog.functions;
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 		
 		Functions result;
@@ -56,6 +60,7 @@ Functions DatabaseUserRepository::getFunctions(int64_t userDbId)
 			std::wstring item = query.getColumn(L"name").getText();
 			result.push_back(item);
 		}
+		catalog.functions = result;
 		return result;
 	}
 	catch (SQLite::QSqlException &ex) {
@@ -132,6 +132,88 @@ TblIdxSpaceUsed DbStatUserRepository::getTblIdxSpaceUsedByName(uint64_t userDbId
 	}
 }
 
+/**
+ * Aggregate the space used of all the tables and indexes by one scan of dbstat, 
+ * getTblIdxSpaceUsedByName() scans the pages once for every name.
+ * 
+ * @param userDbId
+ * @return the map of name and space used, the names without any page are not included
+ */
+TblIdxSpaceUsedMap DbStatUserRepository::getTblIdxSpaceUsedMap(uint64_t userDbId)
+{
+	TblIdxSpaceUsedMap result;
+	std::wstring sql = L"SELECT name, \
+      sum(ncell) AS nentry, \
+      sum((pagetype=='leaf')*ncell) AS leaf_entries,\
+      sum(payload) AS payload, \
+      sum((pagetype=='overflow') * payload) AS ovfl_payload, \
+      sum(path LIKE '%+000000') AS ovfl_cnt, \
+      max(mx_payload) AS mx_payload, \
+      sum(pagetype=='internal') AS int_pages, \
+      sum(pagetype=='leaf') AS leaf_pages, \
+      sum(pagetype=='overflow') AS ovfl_pages, \
+      sum((pagetype=='internal') * unused) AS int_unused,\
+      sum((pagetype=='leaf') * unused) AS leaf_unused, \
+      sum((pagetype=='overflow') * unused) AS ovfl_unused, \
+      sum(pgsize) AS compressed_size, \
+      max((length(CASE WHEN path LIKE '%+%' THEN '' ELSE path END)+3)/4) \
+        AS depth \
+    FROM temp.dbstat GROUP BY name";
+
+	try {
+		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+		while (query.executeStep()) {
+			std::wstring name = query.getColumn(L"name").getText();
+			result[name] = toTblIdxSpaceUsed(query);
+		}
+		return result;
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"query db has error:{}, msg:{}", ex.getErrorCode(), _err);
+		throw QSqlExecuteException(std::to_wstring(ex.getErrorCode()), ex.getErrorStr(), sql);
+	}
+}
+
+/**
+ * Get the counters of database changes, the file change counter is read from the database header by the VFS of connection.
+ * 
+ * @param userDbId
+ * @return 
+ */
+DbChangeCounter DbStatUserRepository::getDbChangeCounter(uint64_t userDbId)
+{
+	DbChangeCounter result;
+	QSqlDatabase * connect = getUserConnect(userDbId);
+	std::wstring sql = L"PRAGMA data_version";
+	try {
+		QSqlStatement query(connect, sql.c_str());
+		if (query.executeStep()) {
+			result.dataVersion = query.getColumn(0).getInt64();
+		}
+		sql = L"PRAGMA schema_version";
+		QSqlStatement query2(connect, sql.c_str());
+		if (query2.executeStep()) {
+			result.schemaVersion = query2.getColumn(0).getInt64();
+		}
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"query db has error:{}, msg:{}", ex.getErrorCode(), _err);
+		throw QSqlExecuteException(std::to_wstring(ex.getErrorCode()), ex.getErrorStr(), sql);
+	}
+	result.totalChanges = connect->getTotalChanges();
+
+	// The file change counter: 4-byte big-endian integer at offset 24 of the database header
+	sqlite3_file * dbFile = nullptr;
+	if (sqlite3_file_control(connect->getHandle(), "main", SQLITE_FCNTL_FILE_POINTER, &dbFile) == SQLITE_OK 
+		&& dbFile && dbFile->pMethods) {
+		unsigned char bytes[4] = { 0 };
+		if (dbFile->pMethods->xRead(dbFile, bytes, 4, 24) == SQLITE_OK) {
+			result.fileChangeCounter = (uint32_t(bytes[0]) << 24) | (uint32_t(bytes[1]) << 16) | (uint32_t(bytes[2]) << 8) | uint32_t(bytes[3]);
+		}
+	}
+	return result;
+}
+
 TblIdxSpaceUsed DbStatUserRepository::toTblIdxSpaceUsed(QSqlStatement & query)
 {
 	TblIdxSpaceUsed item;
@@ -31,6 +31,8 @@ public:
 	uint64_t getAutovacuum(uint64_t userDbId);
 	uint64_t getFreePageCount(uint64_t userDbId);
 	TblIdxSpaceUsed getTblIdxSpaceUsedByName(uint64_t userDbId, const std::wstring & name);
+	TblIdxSpaceUsedMap getTblIdxSpaceUsedMap(uint64_t userDbId);
+	DbChangeCounter getDbChangeCounter(uint64_t userDbId);
 private:
 	TblIdxSpaceUsed toTblIdxSpaceUsed(QSqlStatement & query);
 };
@@ -35,6 +35,13 @@ UserIndexList IndexUserRepository::getListByTblName(uint64_t userDbId, const std
 	}
 	sql.append(L" WHERE type='index' and tbl_name=:tbl_name ORDER BY name ASC");
 	try {
+		UserCatalog * catalog = QCatalog::isCacheable(schema) ? &getUserCatalog(userDbId) : nullptr;
+		if (catalog) {
+			auto iter = catalog->indexesMap.find(tblName);
+			if (iter != catalog->indexesMap.end()) {
+				return iter->second;
+			}
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 		query.bind(L":tbl_name", tblName);
 
@@ -42,6 +49,9 @@ UserIndexList IndexUserRepository::getListByTblName(uint64_t userDbId, const std
 			UserIndex item = toUserIndex(query);
 			result.push_back(item);
 		}
+		if (catalog) {
+			catalog->indexesMap[tblName] = result;
+		}
 		return result;
 	}
 	catch (SQLite::QSqlException &ex) {
@@ -84,12 +94,18 @@ UserIndexList IndexUserRepository::getListByUserDbId(uint64_t userDbId)
 	sql.append(L"\"sqlite_master\"");
 	sql.append(L" WHERE type='index' ORDER BY name ASC");
 	try {
+		UserCatalog & catalog = getUserCatalog(userDbId);
+		if (catalog.hasIndexes) {
+			return catalog.indexes;
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 
 		while (query.executeStep()) {
 			UserIndex item = toUserIndex(query);
 			result.push_back(item);
 		}
+		catalog.hasIndexes = true;
+		catalog.indexes = result;
 		return result;
 	} catch (SQLite::QSqlException &ex) {
 		std::wstring _err = ex.getErrorStr();
@@ -35,12 +35,23 @@ UserTableList TableUserRepository::getListByUserDbId(uint64_t userDbId, const st
 	}
 	sql.append(L" WHERE type='table' ORDER BY name ASC");
 	try {
+		UserCatalog * catalog = QCatalog::isCacheable(schema) ? &getUserCatalog(userDbId) : nullptr;
+		if (catalog && catalog->hasTables) {
+			return catalog->tables;
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 
 		while (query.executeStep()) {
 			UserTable item = toUserTable(query);
 			result.push_back(item);
 		}
+		if (catalog) {
+			catalog->hasTables = true;
+			catalog->tables = result;
+			for (auto & item : result) {
+				catalog->tableMap[item.name] = item;
+			}
+		}
 		return result;
 	} catch (SQLite::QSqlException &ex) {
 		std::wstring _err = ex.getErrorStr();
@@ -61,12 +72,24 @@ UserTable TableUserRepository::getTable(uint64_t userDbId, const std::wstring &
 	}
 	sql.append(L" WHERE type='table' and name=:name ORDER BY name ASC");
 	try {
+		UserCatalog * catalog = QCatalog::isCacheable(schema) ? &getUserCatalog(userDbId) : nullptr;
+		if (catalog) {
+			auto iter = catalog->tableMap.find(tblName);
+			if (iter != catalog->tableMap.end()) {
+				return iter->second;
+			} else if (catalog->hasTables) {
+				return result; // not exists
+			}
+		}
 		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
 		query.bind(L":name", tblName);
 
 		if (query.executeStep()) {
 			result = toUserTable(query);
 		}
+		if (catalog) {
+			catalog->tableMap[tblName] = result;
+		}
 		return result;
 	} catch (SQLite::QSqlException &ex) {
 		std::wstring _err = ex.getErrorStr();
@@ -122,6 +145,55 @@ uint64_t TableUserRepository::getDataCount(uint64_t userDbId, const std::wstring
 	}
 }
 
+/**
+ * Estimate the rows of table without counting them. The rowid range is read by two b-tree lookups 
+ * (min and max in one SELECT scan the whole table), the WITHOUT ROWID table uses the row count of sqlite_stat1 
+ * written by ANALYZE, and the cells of the table pages in dbstat at last.
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param rowIdName - the name of rowid not shadowed by the columns, empty for WITHOUT ROWID table
+ * @param schema - the schema
+ * @return the estimated rows, the rowid range is larger than the rows if some rows are deleted
+ */
+uint64_t TableUserRepository::getEstimatedDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & rowIdName, const std::wstring & schema)
+{
+	std::wstring fmtSchema = schema.empty() ? std::wstring(L"main") : schema;
+	std::wstring fmtTblName;
+	fmtTblName.append(L"\"").append(fmtSchema).append(L"\".\"").append(tblName).append(L"\"");
+	std::wstring sql;
+	try {
+		if (!rowIdName.empty()) {
+			sql = L"SELECT (SELECT max(" + rowIdName + L") FROM " + fmtTblName + L") - (SELECT min(" + rowIdName + L") FROM " + fmtTblName + L") + 1";
+			QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+			return query.executeStep() && !query.getColumn(0).isNull() ? query.getColumn(0).getInt64() : 0;
+		}
+
+		// the first integer of stat is the rows of table, sqlite_stat1 doesn't exist before ANALYZE
+		sql = L"SELECT stat FROM \"" + fmtSchema + L"\".sqlite_stat1 WHERE tbl = ?1 LIMIT 1";
+		try {
+			QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+			query.bind(1, tblName);
+			if (query.executeStep()) {
+				return std::wcstoull(query.getColumn(0).getText().c_str(), nullptr, 10);
+			}
+		} catch (SQLite::QSqlException &ex) {
+			Q_INFO(L"no sqlite_stat1 for estimating rows:{}, msg:{}", ex.getErrorCode(), ex.getErrorStr());
+		}
+
+		// every cell of WITHOUT ROWID table (b-tree index) is a row
+		sql = L"SELECT sum(ncell) FROM dbstat(?1) WHERE name = ?2";
+		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+		query.bind(1, fmtSchema);
+		query.bind(2, tblName);
+		return query.executeStep() && !query.getColumn(0).isNull() ? query.getColumn(0).getInt64() : 0;
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"query db has error:{}, msg:{}", ex.getErrorCode(), _err);
+		throw QSqlExecuteException(std::to_wstring(ex.getErrorCode()), ex.getErrorStr(), sql);
+	}
+}
+
 DataList TableUserRepository::getPageDataList(uint64_t userDbId, const std::wstring & tblName, int page, int perpage, const std::wstring & schema)
 {
 	DataList result;
@@ -211,6 +283,231 @@ DataList TableUserRepository::getWherePageDataList(uint64_t userDbId, const std:
 	}
 }
 
+/**
+ * Read the next page of the table in the key order, the keyset is moved to the last row of the page.
+ * SQL such as: SELECT *, "rowid" FROM "tbl" WHERE "rowid" > :key AND ({whereClause}) ORDER BY "rowid" LIMIT {perpage}
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param whereClause - the where clause, can be empty
+ * @param keyset - [in/out] the keyset of table scan
+ * @param perpage - the rows of one page
+ * @param schema - the schema
+ * @return the rows of the page, the key columns are not included
+ */
+DataList TableUserRepository::getKeysetDataList(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, TableKeyset & keyset, int perpage, const std::wstring & schema /*= std::wstring()*/)
+{
+	ATLASSERT(!keyset.keyColumns.empty() && perpage > 0);
+	DataList result;
+	if (keyset.isEnd) {
+		return result;
+	}
+	int nKeys = static_cast<int>(keyset.keyColumns.size());
+	std::wstring keyClause;
+	for (int i = 0; i < nKeys; i++) {
+		if (i > 0) {
+			keyClause.append(L",");
+		}
+		keyClause.append(L"\"").append(keyset.keyColumns.at(i)).append(L"\"");
+	}
+
+	std::wstring sql = L"SELECT *,";
+	sql.append(keyClause).append(L" FROM ");
+	if (!schema.empty() && schema != L"main") {
+		sql.append(L"\"").append(schema).append(L"\".").append(L"\"").append(tblName).append(L"\"");
+	} else {
+		sql.append(L"\"").append(tblName).append(L"\"");
+	}
+
+	// the row value (k1,k2) > (?,?) is used for the multi-columns primary key
+	bool hasLastKeys = static_cast<int>(keyset.lastKeys.size()) == nKeys;
+	if (hasLastKeys) {
+		sql.append(L" WHERE ");
+		if (nKeys == 1) {
+			sql.append(keyClause).append(L" > ?");
+		} else {
+			std::wstring params;
+			for (int i = 0; i < nKeys; i++) {
+				params.append(i > 0 ? L",?" : L"?");
+			}
+			sql.append(L"(").append(keyClause).append(L") > (").append(params).append(L")");
+		}
+	}
+	if (!whereClause.empty()) {
+		sql.append(hasLastKeys ? L" AND (" : L" WHERE (").append(whereClause).append(L")");
+	}
+	sql.append(L" ORDER BY ").append(keyClause).append(L" LIMIT ").append(std::to_wstring(perpage));
+	try {
+		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+		if (hasLastKeys) {
+			for (int i = 0; i < nKeys; i++) {
+				const TableKeyValue & keyValue = keyset.lastKeys.at(i);
+				if (keyValue.type == SQLite::INTEGER) {
+					query.bind(i + 1, keyValue.intVal);
+				} else if (keyValue.type == SQLite::FLOAT) {
+					query.bind(i + 1, keyValue.floatVal);
+				} else if (keyValue.type == SQLite::TEXT) {
+					query.bind(i + 1, keyValue.text);
+				} else if (keyValue.type == SQLite::BLOB) {
+					query.bind(i + 1, keyValue.blob.data(), static_cast<int>(keyValue.blob.size()));
+				} else {
+					query.bind(i + 1);
+				}
+			}
+		}
+
+		while (query.executeStep()) {
+			RowItem rowItem = toRowItem(query);
+			// move the key columns in the end of row to the keyset, keep their storage class for binding the next page
+			readKeyValues(query, nKeys, keyset.lastKeys);
+			rowItem.resize(rowItem.size() - nKeys);
+			result.push_back(rowItem);
+		}
+		keyset.isEnd = static_cast<int>(result.size()) < perpage;
+		return result;
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"query db has error:{}, msg:{}", ex.getErrorCode(), _err);
+		throw QSqlExecuteException(std::to_wstring(ex.getErrorCode()), ex.getErrorStr(), sql);
+	}
+}
+
+/**
+ * Apply the row changes by the prepared statements, the statements of the same columns are prepared once and reused.
+ * The caller must begin the transaction. The failed row is recorded to errors and the next rows are still applied,
+ * so all the failed rows are reported, unless the error has rolled back the transaction.
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param rowChanges - the row changes
+ * @param errors - [out] the failed rows
+ * @param schema - the schema
+ * @return the rows have been changed
+ */
+uint64_t TableUserRepository::applyRowChanges(uint64_t userDbId, const std::wstring & tblName, const RowChanges & rowChanges, 
+	RowChangeErrors & errors, const std::wstring & schema /*= std::wstring()*/)
+{
+	QSqlDatabase * connect = getUserConnect(userDbId);
+	// key - the sql, the UPDATE/INSERT/DELETE of the same columns has the same sql
+	std::unordered_map<std::wstring, std::unique_ptr<QSqlStatement>> statements;
+	uint64_t rows = 0;
+	for (auto & rowChange : rowChanges) {
+		std::wstring sql = makeRowChangeSql(tblName, rowChange, schema);
+		if (sql.empty()) {
+			continue;
+		}
+		auto & query = statements[sql];
+		try {
+			if (!query) {
+				query.reset(new QSqlStatement(connect, sql.c_str()));
+			}
+			int index = 1;
+			for (auto & value : rowChange.values) {
+				bindRowChangeValue(*query, index++, value);
+			}
+			for (auto & key : rowChange.keys) {
+				bindRowChangeValue(*query, index++, key);
+			}
+			rows += query->exec();
+			query->reset();
+		} catch (SQLite::QSqlException &e) {
+			if (query) {
+				query->tryReset();
+			}
+			RowChangeError error;
+			error.iItem = rowChange.iItem;
+			error.code = e.getErrorCode();
+			error.msg = e.getErrorStr();
+			error.sql = sql;
+			Q_ERROR(L"Apply row change has error:{}, msg:{}, item:{}, SQL:{}", error.code, error.msg, error.iItem, sql);
+			errors.push_back(error);
+			if (sqlite3_get_autocommit(connect->getHandle())) {
+				// the error such as SQLITE_FULL has rolled back the transaction, the next rows can't be applied
+				break;
+			}
+		}
+	}
+	return rows;
+}
+
+/**
+ * Make the sql with parameters for the row change, the values are bound before the keys.
+ * UPDATE "tbl" SET "column1"=?, "column2"=? WHERE "key1"=? AND "key2"=?
+ * INSERT INTO "tbl" ("column1", "column2") VALUES (?, ?)
+ * DELETE FROM "tbl" WHERE "key1"=? AND "key2"=?
+ */
+std::wstring TableUserRepository::makeRowChangeSql(const std::wstring & tblName, const RowChange & rowChange, const std::wstring & schema /*= std::wstring()*/)
+{
+	std::wstring tbl;
+	if (!schema.empty() && schema != L"main") {
+		tbl.append(L"\"").append(schema).append(L"\".");
+	}
+	tbl.append(L"\"").append(tblName).append(L"\"");
+
+	std::wstring sql;
+	if (rowChange.type == ROW_CHANGE_INSERT) {
+		if (rowChange.values.empty()) {
+			return sql;
+		}
+		std::wstring params;
+		sql.append(L"INSERT INTO ").append(tbl).append(L" (");
+		for (auto & value : rowChange.values) {
+			if (!params.empty()) {
+				sql.append(L", ");
+				params.append(L", ");
+			}
+			sql.append(L"\"").append(value.column).append(L"\"");
+			params.append(L"?");
+		}
+		sql.append(L") VALUES (").append(params).append(L")");
+		return sql;
+	}
+
+	if (rowChange.keys.empty() || (rowChange.type == ROW_CHANGE_UPDATE && rowChange.values.empty())) {
+		return sql;
+	}
+	if (rowChange.type == ROW_CHANGE_UPDATE) {
+		sql.append(L"UPDATE ").append(tbl).append(L" SET ");
+		int i = 0;
+		for (auto & value : rowChange.values) {
+			if (i++ > 0) {
+				sql.append(L", ");
+			}
+			sql.append(L"\"").append(value.column).append(L"\"=?");
+		}
+	} else {
+		sql.append(L"DELETE FROM ").append(tbl);
+	}
+	sql.append(L" WHERE ");
+	int i = 0;
+	for (auto & key : rowChange.keys) {
+		if (i++ > 0) {
+			sql.append(L" AND ");
+		}
+		// "column" IS ? matches the NULL value too
+		sql.append(L"\"").append(key.column).append(key.type == ROW_VALUE_NULL ? L"\" IS ?" : L"\"=?");
+	}
+	return sql;
+}
+
+void TableUserRepository::bindRowChangeValue(QSqlStatement & query, int index, const RowChangeValue & value)
+{
+	switch (value.type) {
+	case ROW_VALUE_NULL:
+		query.bind(index);
+		break;
+	case ROW_VALUE_INTEGER:
+		query.bind(index, static_cast<int64_t>(_wcstoi64(value.val.c_str(), nullptr, 10)));
+		break;
+	case ROW_VALUE_FLOAT:
+		query.bind(index, wcstod(value.val.c_str(), nullptr));
+		break;
+	default:
+		query.bind(index, value.val);
+		break;
+	}
+}
+
 void TableUserRepository::execBySql(uint64_t userDbId, const std::wstring & sql)
 {
 	try {
@@ -225,6 +522,63 @@ void TableUserRepository::execBySql(uint64_t userDbId, const std::wstring & sql)
 	}
 }
 
+/**
+ * Execute the sql with the progress handler of SQLite, the handler is called every nOps virtual machine instructions,
+ * return non-zero from the handler to interrupt the sql.
+ * 
+ * @param userDbId - the user db id
+ * @param sql - the sql
+ * @param nOps - the instructions between two calls of the handler
+ * @param progressHandler - the progress handler
+ * @param progressArg - the argument of progress handler
+ * @return the rows changed by the sql
+ */
+int TableUserRepository::execBySqlWithProgress(uint64_t userDbId, const std::wstring & sql, int nOps, int (*progressHandler)(void *), void * progressArg)
+{
+	QSqlDatabase * connect = getUserConnect(userDbId);
+	sqlite3_progress_handler(connect->getHandle(), nOps, progressHandler, progressArg);
+	try {
+		QSqlStatement query(connect, sql.c_str());
+		query.exec();
+		sqlite3_progress_handler(connect->getHandle(), 0, nullptr, nullptr);
+		return connect->getChanges();
+	} catch (SQLite::QSqlException &e) {
+		sqlite3_progress_handler(connect->getHandle(), 0, nullptr, nullptr);
+		std::wstring _err = e.getErrorStr();
+		Q_ERROR(L"Execute sql has error:{}, msg:{}, SQL:{}", e.getErrorCode(), _err, sql);
+		throw QSqlExecuteException(std::to_wstring(e.getErrorCode()), _err, sql);
+	}
+}
+
+/**
+ * Attach the database file to the connection of user db, can't be called in a transaction.
+ * 
+ * @param userDbId - the user db id
+ * @param dbPath - the path of database file that will be attached
+ * @param schema - the schema name of attached database
+ */
+void TableUserRepository::attachDatabase(uint64_t userDbId, const std::wstring & dbPath, const std::wstring & schema)
+{
+	std::wstring sql = L"ATTACH DATABASE :path AS \"";
+	sql.append(schema).append(L"\"");
+	try {
+		QSqlStatement query(getUserConnect(userDbId), sql.c_str());
+		query.bind(L":path", dbPath);
+		query.exec();
+	} catch (SQLite::QSqlException &e) {
+		std::wstring _err = e.getErrorStr();
+		Q_ERROR(L"Attach database has error:{}, msg:{}, path:{}", e.getErrorCode(), _err, dbPath);
+		throw QSqlExecuteException(std::to_wstring(e.getErrorCode()), _err, sql);
+	}
+}
+
+void TableUserRepository::detachDatabase(uint64_t userDbId, const std::wstring & schema)
+{
+	std::wstring sql = L"DETACH DATABASE \"";
+	sql.append(schema).append(L"\"");
+	execBySql(userDbId, sql);
+}
+
 void TableUserRepository::renameTable(uint64_t userDbId, const std::wstring & oldTableName, const std::wstring & newTableName, const std::wstring & schema)
 {
 	std::wstring ddl = L"ALTER TABLE ";
@@ -290,3 +644,30 @@ UserTable TableUserRepository::toUserTable(QSqlStatement &query)
 	item.sql = query.getColumn(L"sql").isNull() ? L"" : query.getColumn(L"sql").getText();
 	return item;
 }
+
+/**
+ * Read the key columns in the end of current row with their storage class.
+ * 
+ * @param query - the statement has a row
+ * @param nKeys - the number of key columns
+ * @param keyValues - [out] the key values
+ */
+void TableUserRepository::readKeyValues(QSqlStatement &query, int nKeys, TableKeyValues & keyValues)
+{
+	keyValues.resize(nKeys);
+	int firstKey = query.getColumnCount() - nKeys;
+	for (int i = 0; i < nKeys; i++) {
+		QSqlColumn column = query.getColumn(firstKey + i);
+		TableKeyValue & keyValue = keyValues.at(i);
+		keyValue.type = column.getType();
+		if (column.isInteger()) {
+			keyValue.intVal = column.getInt64();
+		} else if (column.isFloat()) {
+			keyValue.floatVal = column.getDouble();
+		} else if (column.isText()) {
+			column.getText(keyValue.text);
+		} else if (column.isBlob()) {
+			keyValue.blob.assign(static_cast<const char *>(column.getBlob()), column.getBytes());
+		}
+	}
+}
@@ -32,15 +32,26 @@ public:
 	UserTable getByRootPage(uint64_t userDbId, uint64_t rootpage);
 
 	uint64_t getDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
+	uint64_t getEstimatedDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & rowIdName, const std::wstring & schema = std::wstring());
 	DataList getPageDataList(uint64_t userDbId, const std::wstring & tblName, int page, int perpage, const std::wstring & schema = std::wstring());
 
 	uint64_t getWhereDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, const std::wstring & schema = std::wstring());
 	DataList getWherePageDataList(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, int page, int perpage, const std::wstring & schema = std::wstring());
+	DataList getKeysetDataList(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, TableKeyset & keyset, int perpage, const std::wstring & schema = std::wstring());
+
+	uint64_t applyRowChanges(uint64_t userDbId, const std::wstring & tblName, const RowChanges & rowChanges, 
+		RowChangeErrors & errors, const std::wstring & schema = std::wstring());
+	std::wstring makeRowChangeSql(const std::wstring & tblName, const RowChange & rowChange, const std::wstring & schema = std::wstring());
 
 	void execBySql(uint64_t userDbId, const std::wstring & sql);
+	int execBySqlWithProgress(uint64_t userDbId, const std::wstring & sql, int nOps, int (*progressHandler)(void *), void * progressArg);
+	void attachDatabase(uint64_t userDbId, const std::wstring & dbPath, const std::wstring & schema);
+	void detachDatabase(uint64_t userDbId, const std::wstring & schema);
 	void renameTable(uint64_t userDbId, const std::wstring & oldTableName, const std::wstring & newTableName, const std::wstring & schema);
 	void truncateTable(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema);
 	void dropTable(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema);
 private:
 	UserTable toUserTable(QSqlStatement &query);
+	void readKeyValues(QSqlStatement &query, int nKeys, TableKeyValues & keyValues);
+	void bindRowChangeValue(QSqlStatement & query, int index, const RowChangeValue & value);
 };
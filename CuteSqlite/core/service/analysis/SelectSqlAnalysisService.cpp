@@ -23,7 +23,6 @@
 #include "core/common/exception/QRuntimeException.h"
 #include "core/common/exception/QSqlExecuteException.h"
 #include "utils/ColumnsUtil.h"
-#include "utils/ByteCodeUtil.h"
 
 DataList SelectSqlAnalysisService::explainSql(uint64_t userDbId, const std::wstring & sql)
 {
@@ -39,27 +38,27 @@ ExplainQueryPlans SelectSqlAnalysisService::explainQueryPlanSql(uint64_t userDbI
 /**
  * Explain bycodeList to ByteCodeResults.
  * 
- * @param byteCodeList - Generate a byte code list from Explain a sql statement
+ * @param program - Decoded from the byte code list of explain a sql statement
  * @return - ByteCodeResults
  */
-ByteCodeResults SelectSqlAnalysisService::explainReadByteCodeToResults(uint64_t userDbId, const DataList & byteCodeList, const std::wstring &sql)
+ByteCodeResults SelectSqlAnalysisService::explainReadByteCodeToResults(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring &sql)
 {
 	ByteCodeResults results;
 	// For results.whereColumns
-	doConvertByteCodeForWhereColumns(userDbId, byteCodeList, sql, results);
+	doConvertByteCodeForWhereColumns(userDbId, program, sql, results);
 	// For results.orderColumns
-	doConvertByteCodeForOrderColumns(userDbId, byteCodeList, sql, results);
+	doConvertByteCodeForOrderColumns(userDbId, program, sql, results);
 	// For results.mergeColumns and result.coveringIndexName
 	doMergeColumnsToResults(userDbId, results);
 	return results;
 }
 
 
-SelectColumns SelectSqlAnalysisService::explainReadByteCodeToSelectColumns(uint64_t userDbId, const DataList & byteCodeList, const std::wstring &sql)
+SelectColumns SelectSqlAnalysisService::explainReadByteCodeToSelectColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring &sql)
 {
 	SelectColumns results;
 	// For selectColumns
-	doConvertByteCodeForSelectColumns(userDbId, byteCodeList, sql, results);
+	doConvertByteCodeForSelectColumns(userDbId, program, sql, results);
 	return results;
 }
 
@@ -92,7 +91,7 @@ PerfAnalysisReportList SelectSqlAnalysisService::getPerfAnalysisReportList()
 }
 
 /**
- * Parse the explain byteCodeList to results.
+ * Parse the explain program to results.
  * includes : 
  * 1) Fill in the table or index params(op, name, type, rootpage) of ByteCodeResult from the row that it is OP_OpenRead
  * 2) Fill in the useIndex of ByteCodeResult from the row.
@@ -100,65 +99,65 @@ PerfAnalysisReportList SelectSqlAnalysisService::getPerfAnalysisReportList()
  * 4) Fill in the indexColumns of ByteCodeResult from the row.
  * 
  * @param [in]userDbId
- * @param [in]byteCodeList
+ * @param [in]program
  * @param [in]sql
  * @param [out]results
  */
-void SelectSqlAnalysisService::doConvertByteCodeForWhereColumns(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql,  ByteCodeResults & results)
+void SelectSqlAnalysisService::doConvertByteCodeForWhereColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql,  ByteCodeResults & results)
 {
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"OpenRead") {
-			parseTableAndIndexFromOpenRead(userDbId, rowItem, results);
-		} else if (ByteCodeUtil::isInSeekOpCodes(opcode)) { // seek opcodes: {L"SeekGT", L"SeekGE", L"SeekLT", L"SeekLE"};
-			parseWhereIdxColumnsFromExplainRow(userDbId, rowItem, results); // create whereColumns and whereIndexColumns
-			parseWhereExpressesFromSeekOpsRow(userDbId, iter, byteCodeList, results);// create whereExpresses
-		} else if (ByteCodeUtil::isInIdxOpCodes(opcode)) { // idx opcodes: {L"IdxGT", L"IdxGE", L"IdxLT", L"IdxLE"};
-			parseWhereIdxColumnsFromExplainRow(userDbId, rowItem, results);
-		} else if (ByteCodeUtil::isInCompareOpCodes(opcode)) { // compare opcode: {L"Eq", L"Ne", L"Lt", L"Le", L"Gt", L"Ge"}
-			parseWhereOrIndexColumnFromOpCompare(userDbId, iter, byteCodeList, results); // create whereColumns and whereIndexColumns
-			parseWhereExpressesFromOpCompare(userDbId, iter, byteCodeList, results); // create whereExpresses
-		} else if (opcode == L"SeekRowid" || opcode == L"NotExists") {
-			parseWhereOrIndexColumnFromSeekRowid(userDbId, iter, results, byteCodeList);
-			parseWhereExpressesFromSeekRowid(userDbId, iter, results, byteCodeList);
-		} else if (opcode == L"Column") { // where column 
-			auto nextIter = std::next(iter);
-			auto & nextOpcode = (*nextIter).at(EXP_OPCODE);
-			if (nextOpcode == L"IfPos" || nextOpcode == L"Rewind"
-				|| nextOpcode == L"Column" || nextOpcode == L"ResultRow"
-				|| nextOpcode == L"Rowid" || nextOpcode == L"MakeRecord") {
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = program.at(i);
+		ByteCodeOp op = instruction.op;
+		if (op == BC_OPEN_READ) {
+			parseTableAndIndexFromOpenRead(userDbId, instruction, results);
+		} else if (ByteCodeUtil::isSeekOp(op)) { // seek opcodes: SeekGT/SeekGE/SeekLT/SeekLE
+			parseWhereIdxColumnsFromExplainRow(userDbId, instruction, results); // create whereColumns and whereIndexColumns
+			parseWhereExpressesFromSeekOpsRow(userDbId, i, program, results);// create whereExpresses
+		} else if (ByteCodeUtil::isIdxOp(op)) { // idx opcodes: IdxGT/IdxGE/IdxLT/IdxLE
+			parseWhereIdxColumnsFromExplainRow(userDbId, instruction, results);
+		} else if (ByteCodeUtil::isCompareOp(op)) { // compare opcode: Eq/Ne/Lt/Le/Gt/Ge
+			parseWhereOrIndexColumnFromOpCompare(userDbId, i, program, results); // create whereColumns and whereIndexColumns
+			parseWhereExpressesFromOpCompare(userDbId, i, program, results); // create whereExpresses
+		} else if (op == BC_SEEK_ROWID || op == BC_NOT_EXISTS) {
+			parseWhereOrIndexColumnFromSeekRowid(userDbId, i, results, program);
+			parseWhereExpressesFromSeekRowid(userDbId, i, results, program);
+		} else if (op == BC_COLUMN) { // where column 
+			ByteCodeOp nextOp = i + 1 < n ? program.at(i + 1).op : BC_OTHER;
+			if (nextOp == BC_IF_POS || nextOp == BC_REWIND
+				|| nextOp == BC_COLUMN || nextOp == BC_RESULT_ROW
+				|| nextOp == BC_ROWID || nextOp == BC_MAKE_RECORD) {
 				continue;
 			}
-			parseWhereOrIndexColumnFromOpColumn(userDbId, rowItem, results);
-		} else if (opcode == L"IfNot" || opcode == L"If") {
-			parseWhereOrIndexNullColumnFromSql(userDbId, rowItem, results, sql);
+			parseWhereOrIndexColumnFromOpColumn(userDbId, instruction, results);
+		} else if (op == BC_IF_NOT || op == BC_IF) {
+			parseWhereOrIndexNullColumnFromSql(userDbId, instruction, results, sql);
 		}
 	}
 }
 
 /**
- * Parse the explain byteCodeList to results.
+ * Parse the explain program to results.
  * includes : 
  * 1) Fill in the useIndex of ByteCodeResult from the row.
  * 2) Fill in the indexColumns of ByteCodeResult from the row.
  * 
  * @param [in]userDbId
- * @param [in]byteCodeList
+ * @param [in]program
  * @param [in]sql
  * @param [out]results
  */
-void SelectSqlAnalysisService::doConvertByteCodeForOrderColumns(uint64_t userDbId, const DataList & byteCodeList, const std::wstring & sql, ByteCodeResults & results)
+void SelectSqlAnalysisService::doConvertByteCodeForOrderColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults & results)
 {
 
-	// opcode Last and opcode Prev exists in byteCodeList at the same time
-	parseOrderOrIndexColumnFromLastAndPrev(userDbId, byteCodeList, sql, results);
+	// opcode Last and opcode Prev exists in program at the same time
+	parseOrderOrIndexColumnFromLastAndPrev(userDbId, program, sql, results);
 
-	// opcode IdxInsert and opcode Sort exists in byteCodeList at the same time
-	parseOrderOrIndexColumnFromIdxInsertAndSort(userDbId, byteCodeList, sql, results);
+	// opcode IdxInsert and opcode Sort exists in program at the same time
+	parseOrderOrIndexColumnFromIdxInsertAndSort(userDbId, program, sql, results);
 
-	// opcode SorterInsert and opcode Sort exists in byteCodeList at the same time
-	parseOrderOrIndexColumnFromSorter(userDbId, byteCodeList, sql, results);
+	// opcode SorterInsert and opcode Sort exists in program at the same time
+	parseOrderOrIndexColumnFromSorter(userDbId, program, sql, results);
 }
 
 void SelectSqlAnalysisService::doMergeColumnsToResults(uint64_t userDbId, ByteCodeResults & results)
@@ -178,13 +177,12 @@ void SelectSqlAnalysisService::doMergeColumnsToResults(uint64_t userDbId, ByteCo
 }
 
 
-void SelectSqlAnalysisService::doConvertByteCodeForSelectColumns(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, SelectColumns & selectColumns)
+void SelectSqlAnalysisService::doConvertByteCodeForSelectColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, SelectColumns & selectColumns)
 {
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"ResultRow") {
-			parseSelectColumnsPrevFromResultRow(userDbId, iter, byteCodeList, selectColumns);
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		if (program.at(i).op == BC_RESULT_ROW) {
+			parseSelectColumnsPrevFromResultRow(userDbId, i, program, selectColumns);
 
 			// Note: Only std::vector can be sorted by std::sort, std::list can't be sorted
 			std::sort(selectColumns.begin(), selectColumns.end(), [](auto & col1, auto & col2) {
@@ -195,23 +193,20 @@ void SelectSqlAnalysisService::doConvertByteCodeForSelectColumns(uint64_t userDb
 	}
 }
 
-bool SelectSqlAnalysisService::parseOrderOrIndexColumnFromLastAndPrev(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results)
+bool SelectSqlAnalysisService::parseOrderOrIndexColumnFromLastAndPrev(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results)
 {
 	int hasLast = false, hasPrev = false;
 	int lastP1 = -1, prevP1 = -1;
-	auto lastIter = byteCodeList.end(), prevIter = byteCodeList.end();
 
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"Last" || opcode == L"SeekEnd") {
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = program.at(i);
+		if (instruction.op == BC_LAST || instruction.op == BC_SEEK_END) {
 			hasLast = true;
-			lastP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-			lastIter = iter;
-		} else if (opcode == L"Prev") {
+			lastP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+		} else if (instruction.op == BC_PREV) {
 			hasPrev = true;
-			prevP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-			prevIter = iter;
+			prevP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
 		}
 	}
 
@@ -326,34 +321,34 @@ bool SelectSqlAnalysisService::parseOrderColumnFromSql(ByteCodeResults::iterator
 	return true;
 }
 
-void SelectSqlAnalysisService::parseOrderOrIndexColumnFromIdxInsertAndSort(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseOrderOrIndexColumnFromIdxInsertAndSort(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results)
 {
 	// 1.parse using columns along this order(opcode order: OpenEphemeral--...-->MakeRecord---->IdxInsert---...--->Sort)
 	bool hasOpenEphemeral = false, hasMakeRecord = false, hasIdxInsert = false, hasSort = false;
 	int openEphemeralP1 = -1, idxInsertP1 = -1, sortP1 = -1,
 		idxInsertP2 = -1,
 		makeRecordP1 = -1, makeRecordP2 = -1, makeRecordP3 = -1;
-	DataList::const_iterator makeRecordIter = byteCodeList.end();
+	int makeRecordIndex = -1;
 	
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"OpenEphemeral") {
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = program.at(i);
+		if (instruction.op == BC_OPEN_EPHEMERAL) {
 			hasOpenEphemeral = true;
-			openEphemeralP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-		} else if (opcode == L"MakeRecord" && (*std::next(iter)).at(EXP_OPCODE) == L"IdxInsert") {
+			openEphemeralP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+		} else if (instruction.op == BC_MAKE_RECORD && i + 1 < n && program.at(i + 1).op == BC_IDX_INSERT) {
 			hasMakeRecord = true;
-			makeRecordP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-			makeRecordP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1;
-			makeRecordP3 = rowItem.at(EXP_P3) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P3)) : -1;
-			makeRecordIter = iter;
-		} else if (opcode == L"IdxInsert") {
+			makeRecordP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+			makeRecordP2 = instruction.p2 != BYTECODE_NULL_OPERAND ? instruction.p2 : -1;
+			makeRecordP3 = instruction.p3 != BYTECODE_NULL_OPERAND ? instruction.p3 : -1;
+			makeRecordIndex = i;
+		} else if (instruction.op == BC_IDX_INSERT) {
 			hasIdxInsert = true;
-			idxInsertP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-			idxInsertP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1;
-		} else if (opcode == L"Sort") {
+			idxInsertP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+			idxInsertP2 = instruction.p2 != BYTECODE_NULL_OPERAND ? instruction.p2 : -1;
+		} else if (instruction.op == BC_SORT) {
 			hasSort = true;
-			sortP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
+			sortP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
 		}
 	}
 
@@ -363,59 +358,11 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromIdxInsertAndSort(uint6
 		|| idxInsertP2 != makeRecordP3
 		|| idxInsertP1 != sortP1) return;
 
-	std::vector<int> makeRecordColumnRegNos;
-	for (int i = 0; i < makeRecordP2; i++) {
-		makeRecordColumnRegNos.push_back(makeRecordP1 + i);
-	}
-
 	// pair : first(std::wstring) - tbl name, second(std::wstring) - column name
 	ByteCodeUseColumns byteCodeUseColumns;
 	// 2. travel the column opcode row item from MakeRecord to Rewind
-	for (int regNo : makeRecordColumnRegNos) {		
-		for (auto iter = std::prev(makeRecordIter); iter != byteCodeList.begin(); iter = std::prev(iter)) {
-			auto & rowItem = *iter;
-			auto rowItemP3 = rowItem.at(EXP_P3) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P3)) : -1;
-			if (rowItem.at(EXP_OPCODE) == L"Rewind") {
-				break;
-			}
-			if (rowItem.at(EXP_OPCODE) != L"Column" || rowItemP3 != regNo) { // Column p3 - register number,must equals each other
-				continue;
-			}
-			auto rowItemP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1; // Column p1 - OpenRead p1
-			auto rowItemP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1; // Column p2 - Table / Index index
-
-			auto tblIter = std::find_if(results.begin(), results.end(), [&rowItemP1](auto & tbl) {
-				return rowItemP1 == tbl.no;
-			});
-			if (tblIter == results.end()) {
-				return ;
-			}
-			int tblNo = (*tblIter).no;
-			std::wstring tblName = (*tblIter).name;
-			std::wstring tblType = (*tblIter).type;
-			if (tblType == L"table") {
-				ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
-
-				//ByteCodeUseColumn params: 0-table no, 1-table name, 2-index no, 3-index name, 4-column name
-				ByteCodeUseColumn sortColumn{tblNo, tblName, -1, L"", columnInfoList.at(rowItemP2).name};
-				byteCodeUseColumns.push_back(sortColumn);
-			} else if (tblType == L"index") {
-				PragmaIndexColumns idxColumns = indexUserRepository->getPragmaIndexColumns(userDbId, (*tblIter).name);	
-				const auto & colomnName = idxColumns.at(rowItemP2).name;
-
-				// parent table item in the results
-				UserIndex userIndex = indexUserRepository->getByIndexName(userDbId, (*tblIter).name);
-				auto pTblIter = std::find_if(results.begin(), results.end(), [&userIndex](auto & resItem) {
-					return resItem.name == userIndex.tblName;
-				});
-				if (pTblIter == results.end()) {
-					return ;
-				}
-				//ByteCodeUseColumn params: 0-table no, 1-table name, 2-index no, 3-index name, 4-column name
-				ByteCodeUseColumn sortColumn{(*pTblIter).no, (*pTblIter).name, tblNo, tblName, colomnName};
-				byteCodeUseColumns.push_back(sortColumn);
-			}
-		}		
+	if (!parseByteCodeUseColumnsFromMakeRecord(userDbId, program, makeRecordIndex, results, byteCodeUseColumns)) {
+		return;
 	}
 	if (byteCodeUseColumns.empty()) {
 		return;
@@ -430,34 +377,34 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromIdxInsertAndSort(uint6
 }
 
 
-void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results)
 {
 	// 1.parse using columns in sorter(opcode order: OpenEphemeral--...-->MakeRecord---->IdxInsert---...--->Sort)
 	bool hasSorterOpen = false, hasMakeRecord = false, hasSorterInsert = false, hasSorterSort = false;
 	int sorterOpenP1 = -1, sorterInsertP1 = -1, sorterSortP1 = -1,
 		sorterInsertP2 = -1,
 		makeRecordP1 = -1, makeRecordP2 = -1, makeRecordP3 = -1;
-	DataList::const_iterator makeRecordIter = byteCodeList.end();
+	int makeRecordIndex = -1;
 	
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"SorterOpen") {
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = program.at(i);
+		if (instruction.op == BC_SORTER_OPEN) {
 			hasSorterOpen = true;
-			sorterOpenP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-		} else if (opcode == L"MakeRecord" && (*std::next(iter)).at(EXP_OPCODE) == L"SorterInsert") {
+			sorterOpenP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+		} else if (instruction.op == BC_MAKE_RECORD && i + 1 < n && program.at(i + 1).op == BC_SORTER_INSERT) {
 			hasMakeRecord = true;
-			makeRecordP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1; // MakeRecord P1 = Column opcode start index 
-			makeRecordP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1;
-			makeRecordP3 = rowItem.at(EXP_P3) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P3)) : -1;
-			makeRecordIter = iter;
-		} else if (opcode == L"SorterInsert") {
+			makeRecordP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1; // MakeRecord P1 = Column opcode start index 
+			makeRecordP2 = instruction.p2 != BYTECODE_NULL_OPERAND ? instruction.p2 : -1;
+			makeRecordP3 = instruction.p3 != BYTECODE_NULL_OPERAND ? instruction.p3 : -1;
+			makeRecordIndex = i;
+		} else if (instruction.op == BC_SORTER_INSERT) {
 			hasSorterInsert = true;
-			sorterInsertP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
-			sorterInsertP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1;
-		} else if (opcode == L"SorterSort") {
+			sorterInsertP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
+			sorterInsertP2 = instruction.p2 != BYTECODE_NULL_OPERAND ? instruction.p2 : -1;
+		} else if (instruction.op == BC_SORTER_SORT) {
 			hasSorterSort = true;
-			sorterSortP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
+			sorterSortP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
 		}
 	}
 
@@ -468,32 +415,67 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDb
 		|| sorterInsertP2 != makeRecordP3 
 		|| sorterInsertP1 != sorterSortP1) return;
 
-	std::vector<int> makeRecordColumnRegNos;
-	for (int i = 0; i < makeRecordP2; i++) {
-		makeRecordColumnRegNos.push_back(makeRecordP1 + i);
-	}
-
 	// pair : first(std::wstring) - tbl name, second(std::wstring) - column name
 	ByteCodeUseColumns byteCodeUseColumns;
 	// 2. travel the column opcode row item from MakeRecord to Rewind
-	for (int regNo : makeRecordColumnRegNos) {		
-		for (auto iter = std::prev(makeRecordIter); iter != byteCodeList.begin(); iter = std::prev(iter)) {
-			auto & rowItem = *iter;
-			auto rowItemP3 = rowItem.at(EXP_P3) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P3)) : -1;
-			if (rowItem.at(EXP_OPCODE) == L"Rewind") {
+	if (!parseByteCodeUseColumnsFromMakeRecord(userDbId, program, makeRecordIndex, results, byteCodeUseColumns)) {
+		return;
+	}
+	if (byteCodeUseColumns.empty()) {
+		return;
+	}
+
+	// Get gid of all sub-select clause that between '(' and ')'
+	std::wstring mainSelectClause = StringUtil::notInSymbolString(sql, L'(', L')', 0, true);
+	parseOrderColumnFromByteCodeUseColumnAndSql(userDbId, byteCodeUseColumns,  mainSelectClause, results);
+
+	// parse the order columns by sub-select clause that between '(' and ')'
+	parseOrderColumnsBySubSelectClause(userDbId, sql,  results);
+
+}
+
+/**
+ * Parse the columns of the registers that MakeRecord packs, the registers are written by the Column opcodes 
+ * between the previous Rewind and MakeRecord.
+ * 
+ * @param userDbId
+ * @param program
+ * @param makeRecordIndex - the index of MakeRecord in the program
+ * @param results
+ * @param byteCodeUseColumns - the columns of the registers, in the order of registers
+ * @return false if the cursor of Column is not found in the results
+ */
+bool SelectSqlAnalysisService::parseByteCodeUseColumnsFromMakeRecord(uint64_t userDbId, const ByteCodeProgram & program, int makeRecordIndex, 
+	ByteCodeResults &results, ByteCodeUseColumns & byteCodeUseColumns)
+{
+	auto & makeRecord = program.at(makeRecordIndex);
+	// the Column opcodes after the Rewind are for MakeRecord
+	int rewindIndex = 0;
+	for (int i = makeRecordIndex - 1; i > 0; i--) {
+		if (program.at(i).op == BC_REWIND) {
+			rewindIndex = i;
+			break;
+		}
+	}
+
+	for (int i = 0; i < makeRecord.p2; i++) {
+		int regNo = makeRecord.p1 + i;
+		for (int defIndex : program.getDefsBefore(makeRecordIndex, { regNo })) {
+			if (defIndex <= rewindIndex) {
 				break;
 			}
-			if (rowItem.at(EXP_OPCODE) != L"Column" || rowItemP3 != regNo) { // Column p3 - register number,must equals each other
+			auto & instruction = program.at(defIndex);
+			if (instruction.op != BC_COLUMN) { // Column p3 - register number,must equals each other
 				continue;
 			}
-			auto rowItemP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1; // Column p1 - OpenRead p1
-			auto rowItemP2 = rowItem.at(EXP_P2) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P2)) : -1; // Column p2 - Table / Index index
+			int columnP1 = instruction.p1; // Column p1 - OpenRead p1
+			int columnP2 = instruction.p2; // Column p2 - Table / Index index
 
-			auto tblIter = std::find_if(results.begin(), results.end(), [&rowItemP1](auto & tbl) {
-				return rowItemP1 == tbl.no;
+			auto tblIter = std::find_if(results.begin(), results.end(), [&columnP1](auto & tbl) {
+				return columnP1 == tbl.no;
 			});
 			if (tblIter == results.end()) {
-				return ;
+				return false;
 			}
 			int tblNo = (*tblIter).no;
 			std::wstring tblName = (*tblIter).name;
@@ -502,11 +484,11 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDb
 				ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 
 				//ByteCodeUseColumn params: 0-table no, 1-table name, 2-index no, 3-index name, 4-column name
-				ByteCodeUseColumn sortColumn{tblNo, tblName, -1, L"", columnInfoList.at(rowItemP2).name};
+				ByteCodeUseColumn sortColumn{tblNo, tblName, -1, L"", columnInfoList.at(columnP2).name};
 				byteCodeUseColumns.push_back(sortColumn);
 			} else if (tblType == L"index") {
 				PragmaIndexColumns idxColumns = indexUserRepository->getPragmaIndexColumns(userDbId, (*tblIter).name);	
-				const auto & colomnName = idxColumns.at(rowItemP2).name;
+				const auto & colomnName = idxColumns.at(columnP2).name;
 
 				// parent table item in the results
 				UserIndex userIndex = indexUserRepository->getByIndexName(userDbId, (*tblIter).name);
@@ -514,7 +496,7 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDb
 					return resItem.name == userIndex.tblName;
 				});
 				if (pTblIter == results.end()) {
-					return ;
+					return false;
 				}
 				//ByteCodeUseColumn params: 0-table no, 1-table name, 2-index no, 3-index name, 4-column name
 				ByteCodeUseColumn sortColumn{(*pTblIter).no, (*pTblIter).name, tblNo, tblName, colomnName};
@@ -522,17 +504,7 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromSorter(uint64_t userDb
 			}
 		}		
 	}
-	if (byteCodeUseColumns.empty()) {
-		return;
-	}
-
-	// Get gid of all sub-select clause that between '(' and ')'
-	std::wstring mainSelectClause = StringUtil::notInSymbolString(sql, L'(', L')', 0, true);
-	parseOrderColumnFromByteCodeUseColumnAndSql(userDbId, byteCodeUseColumns,  mainSelectClause, results);
-
-	// parse the order columns by sub-select clause that between '(' and ')'
-	parseOrderColumnsBySubSelectClause(userDbId, sql,  results);
-
+	return true;
 }
 
 /**
@@ -553,12 +525,13 @@ void SelectSqlAnalysisService::parseOrderColumnsBySubSelectClause(uint64_t userD
 
 		try {
 			DataList subByteCodeList = explainSql(userDbId, subSelectClause);
+			ByteCodeProgram subProgram(subByteCodeList);
 			ByteCodeResults subResults;
 
 			// For results.whereColumns, Recursively call doConvertByteCodeForWhereColumns
-			doConvertByteCodeForWhereColumns(userDbId, subByteCodeList, subSelectClause, subResults);
+			doConvertByteCodeForWhereColumns(userDbId, subProgram, subSelectClause, subResults);
 			// For results.orderColumns, Recursively call doConvertByteCodeForWhereColumns
-			doConvertByteCodeForOrderColumns(userDbId, subByteCodeList, subSelectClause, subResults);
+			doConvertByteCodeForOrderColumns(userDbId, subProgram, subSelectClause, subResults);
 
 			if (subResults.empty()) {
 				continue;
@@ -676,20 +649,20 @@ void SelectSqlAnalysisService::parseOrderColumnFromByteCodeUseColumnAndSql(
 	}
 }
 
-void SelectSqlAnalysisService::parseOrderOrIndexColumnFromOpSorter(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseOrderOrIndexColumnFromOpSorter(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results)
 {
 	bool hasSorterOpen = false, hasSorterSort = false;
 	int sorterOpenP1 = -1, sorterSortP1 = -1;
 
-	for (auto iter = byteCodeList.begin(); iter != byteCodeList.end(); iter++) {
-		auto & rowItem = *iter;
-		auto & opcode = rowItem.at(EXP_OPCODE);
-		if (opcode == L"IdxInsert") {
+	int n = program.size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = program.at(i);
+		if (instruction.op == BC_IDX_INSERT) {
 			hasSorterOpen = true;
-			sorterOpenP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;			
-		} else if (opcode == L"Sort") {
+			sorterOpenP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;			
+		} else if (instruction.op == BC_SORT) {
 			hasSorterSort = true;
-			sorterSortP1 = rowItem.at(EXP_P1) != L"< NULL >" ? std::stoi(rowItem.at(EXP_P1)) : -1;
+			sorterSortP1 = instruction.p1 != BYTECODE_NULL_OPERAND ? instruction.p1 : -1;
 		}
 	}
 
@@ -700,12 +673,15 @@ void SelectSqlAnalysisService::parseOrderOrIndexColumnFromOpSorter(uint64_t user
 	}
 }
 
-void SelectSqlAnalysisService::parseTableAndIndexFromOpenRead(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseTableAndIndexFromOpenRead(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results)
 {
+	if (instruction.p1 == BYTECODE_NULL_OPERAND || instruction.p2 <= 0) {
+		return;
+	}
 	ByteCodeResult result;
 	result.userDbId = userDbId;
-	result.no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
-	result.rootPage = std::stoull(rowItem.at(EXP_P2)); // p2 - root page in the VDBE
+	result.no = instruction.p1; // P1 - Table No. in the VDBE
+	result.rootPage = static_cast<uint64_t>(instruction.p2); // p2 - root page in the VDBE
 	UserTable userTable = tableUserRepository->getByRootPage(userDbId, result.rootPage);
 	result.name = userTable.name;
 	result.type = userTable.type;
@@ -769,12 +745,12 @@ void SelectSqlAnalysisService::parseTableAndIndexFromOpenRead(uint64_t userDbId,
  * support IdxXX  IdxGE/IdxGT/IdxLE/IdxLE
  * 
  * @param userDbId - user db
- * @param rowItem - Opcode row
+ * @param instruction - Opcode row
  * @param results - For ByteCodeResults
  */
-void SelectSqlAnalysisService::parseWhereIdxColumnsFromExplainRow(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseWhereIdxColumnsFromExplainRow(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results)
 {
-	int no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
+	int no = instruction.p1; // P1 - Table No. in the VDBE
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -789,7 +765,7 @@ void SelectSqlAnalysisService::parseWhereIdxColumnsFromExplainRow(uint64_t userD
 	// If cursor P1 refers to an SQL table (B-Tree that uses integer keys), use the value in register P3 as a key. 
 	// If cursor P1 refers to an SQL index, then P3 is the first in an array of P4 registers that are used as an unpacked index key.
 	if ((*iter).type == L"table") {
-		int columnIdx = std::stoi(rowItem.at(EXP_P3));
+		int columnIdx = instruction.p3;
 		auto & tblName = (*iter).name;
 		ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 		auto tblColumnName = columnInfoList.at(columnIdx).name;
@@ -813,9 +789,7 @@ void SelectSqlAnalysisService::parseWhereIdxColumnsFromExplainRow(uint64_t userD
 		auto & parentTblResult = *pTblIter;
 		auto & tblWhereColumns = parentTblResult.whereColumns;
 		auto & tblWhereIndexColumns = parentTblResult.whereIndexColumns;
-		int curP3 = std::stoi(rowItem.at(EXP_P3));
-
-		int useIdxColLen = std::stoi(rowItem.at(EXP_P4)); // P4 - use index column length with sorted, and P3 is the number start with the sorted list
+		int useIdxColLen = instruction.p4; // P4 - use index column length with sorted, and P3 is the number start with the sorted list
 		for (int i = 0; i < useIdxColLen; i++) {
 			auto & idxColumn = idxColumns.at(i);
 			// Add index columns to index result
@@ -857,14 +831,14 @@ void SelectSqlAnalysisService::parseWhereIdxColumnsFromExplainRow(uint64_t userD
  * Get where express from SeekXX opcode row of result list after explain sql statement.
  * 
  * @param userDbId
- * @param rowIter -  byteCodeList row iterator
- * @param byteCodeList - byteCodeList
+ * @param index -  the index of SeekXX instruction in the program
+ * @param program - the decoded program
  * @param results - ByteCodeResults
  */
-void SelectSqlAnalysisService::parseWhereExpressesFromSeekOpsRow(uint64_t userDbId, DataList::const_iterator rowIter, const DataList &byteCodeList, ByteCodeResults & results)
+void SelectSqlAnalysisService::parseWhereExpressesFromSeekOpsRow(uint64_t userDbId, int index, const ByteCodeProgram & program, ByteCodeResults & results)
 {
-	const RowItem & rowItem = *rowIter;
-	int no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
+	const ByteCodeInstruction & instruction = program.at(index);
+	int no = instruction.p1; // P1 - Table No. in the VDBE
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -894,54 +868,38 @@ void SelectSqlAnalysisService::parseWhereExpressesFromSeekOpsRow(uint64_t userDb
 	auto & tblWhereExpresses = parentTblResult.whereExpresses;
 	auto & tblEffectRows = parentTblResult.effectRows;
 
-	int useIdxColLen = std::stoi(rowItem.at(EXP_P4)); // P4 - use index column length of table index, and P3 is the number start
+	int useIdxColLen = instruction.p4; // P4 - use index column length of table index, and P3 is the number start
 	std::wstring whereOpr; // operator for where term, e.g., if where term is "columm1 >= 2", then whereOpr is ">="
-	DataList::const_iterator nextRowIter = std::next(rowIter);
-	std::wstring curOpCode = (*rowIter).at(EXP_OPCODE);
-	std::wstring nextOpCode = (*nextRowIter).at(EXP_OPCODE);
+	ByteCodeOp curOp = instruction.op;
+	ByteCodeOp nextOp = index + 1 < program.size() ? program.at(index + 1).op : BC_OTHER;
 	// opcode params : P3 AND P4
-	int curP3 = std::stoi(rowItem.at(EXP_P3));
-	int curP4 = std::stoi(rowItem.at(EXP_P4));
+	int curP3 = instruction.p3;
+	int curP4 = instruction.p4;
 	int nextP3 = -1, nextP4 = -1;
-	if (nextOpCode == L"IdxGE" || nextOpCode == L"IdxGT" || nextOpCode == L"IdxLE" || nextOpCode == L"IdxLE") {		
-		nextP3 = rowItem.at(EXP_P3) != L"< NULL >" && ! rowItem.at(EXP_P3).empty() ? std::stoi(rowItem.at(EXP_P3)) : -1;
-		nextP4 = rowItem.at(EXP_P4) != L"< NULL >" && ! rowItem.at(EXP_P4).empty()  ? std::stoi(rowItem.at(EXP_P4)) : -1;
+	if (nextOp == BC_IDX_GE || nextOp == BC_IDX_GT || nextOp == BC_IDX_LE) {		
+		nextP3 = instruction.p3 != BYTECODE_NULL_OPERAND ? instruction.p3 : -1;
+		nextP4 = instruction.p4 != BYTECODE_NULL_OPERAND ? instruction.p4 : -1;
 	}
-	
+	bool nextIsNotIdxOrCompare = !ByteCodeUtil::isIdxOp(nextOp) && !ByteCodeUtil::isCompareOp(nextOp);
 
 	for (int i = 0; i < useIdxColLen; i++) {
 		auto & idxColumn = idxColumns.at(i);
-		if (curOpCode  == L"SeekGE" 
-			&& !ByteCodeUtil::isInIdxOpCodes(nextOpCode) 
-			&& !ByteCodeUtil::isInCompareOpCodes(nextOpCode)) {
+		if (curOp == BC_SEEK_GE && nextIsNotIdxOrCompare) {
 			whereOpr = L">=";
-		} else if (curOpCode  == L"SeekGT"
-			&& !ByteCodeUtil::isInIdxOpCodes(nextOpCode) 
-			&& !ByteCodeUtil::isInCompareOpCodes(nextOpCode)) {
+		} else if (curOp == BC_SEEK_GT && nextIsNotIdxOrCompare) {
 			whereOpr = L">";
-		} else if (curOpCode  == L"SeekLE"
-			&& !ByteCodeUtil::isInIdxOpCodes(nextOpCode) 
-			&& !ByteCodeUtil::isInCompareOpCodes(nextOpCode)) {
+		} else if (curOp == BC_SEEK_LE && nextIsNotIdxOrCompare) {
 			whereOpr = L"<=";
-		} else if (curOpCode  == L"SeekLT"
-			&& !ByteCodeUtil::isInIdxOpCodes(nextOpCode) 
-			&& !ByteCodeUtil::isInCompareOpCodes(nextOpCode)) {
+		} else if (curOp == BC_SEEK_LT && nextIsNotIdxOrCompare) {
 			whereOpr = L"<";
-		} else if (curOpCode == L"SeekGE" && nextOpCode == L"IdxGT") {			
+		} else if (curOp == BC_SEEK_GE && nextOp == BC_IDX_GT) {			
 			if (curP3 == nextP3 && curP4 == nextP4) {
 				whereOpr = L"=";
 			} else if (curP4 >= nextP4) {
 				if (i < nextP4) whereOpr = L"=";
 				else whereOpr = L">=";
 			} 
-		} else if (curOpCode == L"SeekLE" && nextOpCode == L"IdxLT") {			
-			if (curP3 == nextP3 && curP4 == nextP4) {
-				whereOpr = L"=";
-			} else if (curP4 >= nextP4) {
-				if (i < nextP4) whereOpr = L"=";
-				else whereOpr = L"<=";
-			} 
-		} else if (curOpCode == L"SeekLE" && nextOpCode == L"IdxLT") {			
+		} else if (curOp == BC_SEEK_LE && nextOp == BC_IDX_LT) {			
 			if (curP3 == nextP3 && curP4 == nextP4) {
 				whereOpr = L"=";
 			} else if (curP4 >= nextP4) {
@@ -953,7 +911,7 @@ void SelectSqlAnalysisService::parseWhereExpressesFromSeekOpsRow(uint64_t userDb
 		auto & columnName = idxColumn.name;
 		std::wstring whereExpress = L"\"" + columnName + L"\"";
 		int compareRegNo = curP3 + i;
-		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, rowIter, byteCodeList);
+		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, index, program);
 		whereExpress.append(whereOpr).append(whereVal);
 
 		auto expIter1 = std::find_if(whereExpresses.begin(), whereExpresses.end(), [&whereExpress](auto & exp) {
@@ -976,12 +934,12 @@ void SelectSqlAnalysisService::parseWhereExpressesFromSeekOpsRow(uint64_t userDb
  * From the row that row.opcode == Column, explain the row params to ByteCodeResults.whereColumns and  ByteCodeResults.indexColumns for ByteCodeResults
  * 
  * @param userDbId - user db
- * @param rowItem - Opcode row
+ * @param instruction - Opcode row
  * @param results - For ByteCodeResults
  */
-void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results)
 {
-	int no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
+	int no = instruction.p1; // P1 - Table No. in the VDBE
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -994,7 +952,7 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpColumn(uint64_t user
 
 	// Column
 	if ((*iter).type == L"table") {
-		int pos = std::stoi(rowItem.at(EXP_P2));
+		int pos = instruction.p2;
 		auto & tblName = (*iter).name;
 		ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 		auto tblColumnName = columnInfoList.at(pos).name;
@@ -1006,7 +964,7 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpColumn(uint64_t user
 		}
 	} else if ((*iter).type == L"index") {
 		PragmaIndexColumns idxColumns = indexUserRepository->getPragmaIndexColumns(userDbId, (*iter).name);		
-		int pos = std::stoi(rowItem.at(EXP_P2)); // P2 - index 
+		int pos = instruction.p2; // P2 - index 
 		
 		auto & idxColumn = idxColumns.at(pos);
 
@@ -1055,9 +1013,9 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpColumn(uint64_t user
 }
 
 
-void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpRowid(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpRowid(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results)
 {
-	int no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
+	int no = instruction.p1; // P1 - Table No. in the VDBE
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -1070,7 +1028,7 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpRowid(uint64_t userD
 
 	// Column
 	if ((*iter).type == L"table") {
-		int pos = std::stoi(rowItem.at(EXP_P2));
+		int pos = instruction.p2;
 		auto & tblName = (*iter).name;
 		ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 		auto tblColumnName = columnInfoList.at(pos).name;
@@ -1133,12 +1091,12 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpRowid(uint64_t userD
  * From the row that row.opcode == Column, explain the row params to ByteCodeResults.whereColumns and  ByteCodeResults.indexColumns for ByteCodeResults
  * 
  * @param userDbId - user db
- * @param rowItem - Opcode row
+ * @param instruction - Opcode row
  * @param results - For ByteCodeResults
  */
-std::wstring SelectSqlAnalysisService::getWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results)
+std::wstring SelectSqlAnalysisService::getWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results)
 {
-	int no = std::stoi(rowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
+	int no = instruction.p1; // P1 - Table No. in the VDBE
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -1152,7 +1110,7 @@ std::wstring SelectSqlAnalysisService::getWhereOrIndexColumnFromOpColumn(uint64_
 	std::wstring result;
 	// Column
 	if ((*iter).type == L"table") {
-		int pos = std::stoi(rowItem.at(EXP_P2));
+		int pos = instruction.p2;
 		auto & tblName = (*iter).name;
 		ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 		auto tblColumnName = columnInfoList.at(pos).name;
@@ -1160,7 +1118,7 @@ std::wstring SelectSqlAnalysisService::getWhereOrIndexColumnFromOpColumn(uint64_
 		return result;
 	} else if ((*iter).type == L"index") {
 		PragmaIndexColumns idxColumns = indexUserRepository->getPragmaIndexColumns(userDbId, (*iter).name);		
-		int pos = std::stoi(rowItem.at(EXP_P2)); // P2 - index 
+		int pos = instruction.p2; // P2 - index 
 		
 		auto & idxColumn = idxColumns.at(pos);
 
@@ -1185,30 +1143,32 @@ std::wstring SelectSqlAnalysisService::getWhereOrIndexColumnFromOpColumn(uint64_
  * From the row that row.opcode == Column, explain the row params to ByteCodeResults.whereExpresses
  * 
  * @param userDbId - user db
- * @param compareOpcode - compare opcode that use this Column
- * @param rowItem - Opcode row
+ * @param compareIndex - the index of compare instruction that use this Column
+ * @param columnIndex - the index of Column instruction
+ * @param program - the decoded program
  * @param results - For ByteCodeResults
  */
-void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId, DataList::const_iterator compareRowIter,
-	DataList::const_iterator columnRowIter, const DataList &byteCodeList, ByteCodeResults &results)
+void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId, int compareIndex, int columnIndex, 
+	const ByteCodeProgram & program, ByteCodeResults &results)
 {
-	const RowItem &columnRowItem = *columnRowIter;
-	int no = std::stoi(columnRowItem.at(EXP_P1)); // P1 - Table No. in the VDBE
-	int compareRegNo = std::stoi((*compareRowIter).at(EXP_P1));	
-	const std::wstring & compareOpcode = (*compareRowIter).at(EXP_OPCODE);
+	const ByteCodeInstruction & compareInstruction = program.at(compareIndex);
+	const ByteCodeInstruction & columnInstruction = program.at(columnIndex);
+	int no = columnInstruction.p1; // P1 - Table No. in the VDBE
+	int compareRegNo = compareInstruction.p1;	
+	ByteCodeOp compareOp = compareInstruction.op;
 
 	// compare opcode P2,jump to not opcode
-	std::wstring compareJumpAddr = (*compareRowIter).at(EXP_P2);
-	std::wstring compareJumpOpcode = getOpcodeByByteCodeAddr(compareJumpAddr, byteCodeList);
-	bool jumpNotOpcode = StringUtil::existsIn(compareJumpOpcode, { L"Next", L"Prev", L"Last", L"Halt" });
+	ByteCodeOp compareJumpOp = program.opcodeOfAddr(compareInstruction.p2);
+	bool jumpNotOpcode = compareJumpOp == BC_NEXT || compareJumpOp == BC_PREV 
+		|| compareJumpOp == BC_LAST || compareJumpOp == BC_HALT;
 
 	std::wstring whereOpr;
-	if (compareOpcode == L"Ne")  whereOpr = jumpNotOpcode ? L"=" : L"<>";		
-	else if (compareOpcode == L"Eq")  whereOpr = jumpNotOpcode ? L"<>" : L"=";
-	else if (compareOpcode == L"Le")  whereOpr = jumpNotOpcode ? L">" : L"<=";
-	else if (compareOpcode == L"Lt")  whereOpr = jumpNotOpcode ? L">=" : L"<";
-	else if (compareOpcode == L"Ge")  whereOpr = jumpNotOpcode ? L"<" : L">=";
-	else if (compareOpcode == L"Gt")  whereOpr = jumpNotOpcode ? L"<=" : L">";
+	if (compareOp == BC_NE)  whereOpr = jumpNotOpcode ? L"=" : L"<>";		
+	else if (compareOp == BC_EQ)  whereOpr = jumpNotOpcode ? L"<>" : L"=";
+	else if (compareOp == BC_LE)  whereOpr = jumpNotOpcode ? L">" : L"<=";
+	else if (compareOp == BC_LT)  whereOpr = jumpNotOpcode ? L">=" : L"<";
+	else if (compareOp == BC_GE)  whereOpr = jumpNotOpcode ? L"<" : L">=";
+	else if (compareOp == BC_GT)  whereOpr = jumpNotOpcode ? L"<=" : L">";
 	
 	auto iter = std::find_if(results.begin(), results.end(), [&no](auto & result) {
 		return result.no == no;
@@ -1222,12 +1182,12 @@ void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId,
 	std::wstring whereExpress;
 	// Column
 	if ((*iter).type == L"table") {
-		int pos = std::stoi(columnRowItem.at(EXP_P2));
+		int pos = columnInstruction.p2;
 		auto & tblName = (*iter).name;
 		ColumnInfoList columnInfoList = columnUserRepository->getListByTblName(userDbId, tblName);
 		auto tblColumnName = columnInfoList.at(pos).name;
 		
-		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, columnRowIter, byteCodeList);
+		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, columnIndex, program);
 		whereExpress.append(L"\"").append(tblColumnName).append(L"\"").append(whereOpr).append(whereVal);
 		
 
@@ -1239,7 +1199,7 @@ void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId,
 		}
 	} else if ((*iter).type == L"index") {
 		PragmaIndexColumns idxColumns = indexUserRepository->getPragmaIndexColumns(userDbId, (*iter).name);		
-		int pos = std::stoi(columnRowItem.at(EXP_P2)); // P2 - index 
+		int pos = columnInstruction.p2; // P2 - index 
 		
 		auto & idxColumn = idxColumns.at(pos);
 		auto & idxColumnName = idxColumn.name;
@@ -1255,7 +1215,7 @@ void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId,
 		auto & parentTblResult = *pTblIter;
 		auto & tblWhereExpresses = parentTblResult.whereExpresses;
 
-		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, columnRowIter, byteCodeList);
+		std::wstring whereVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, columnIndex, program);
 		whereExpress.append(L"\"").append(idxColumnName).append(L"\"").append(whereOpr).append(whereVal);
 
 		// Add index columns to index result
@@ -1277,28 +1237,29 @@ void SelectSqlAnalysisService::parseWhereExpressFromOpColumn(uint64_t userDbId,
 }
 
 /**
- * Compare opcode.
+ * Compare opcode, the registers of compare are written by the previous Column/Rowid/IdxRowid.
  * 
  * @param userDbId
- * @param rowItem
+ * @param index - the index of compare instruction
+ * @param program
  * @param results
- * @param iter
- * @param byteCodeList
  */
-void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpCompare(uint64_t userDbId, DataList::const_iterator iter,
-	 const DataList & byteCodeList, ByteCodeResults & results)
+void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpCompare(uint64_t userDbId, int index,
+	 const ByteCodeProgram & program, ByteCodeResults & results)
 {
-	const RowItem & rowItem = *iter;
-	std::wstring r1 = rowItem.at(EXP_P1); // Compare opcode: P1 - register
-	std::wstring r3 = rowItem.at(EXP_P3); // Compare opcode: P3 - register
+	auto & instruction = program.at(index);
+	int r1 = instruction.p1; // Compare opcode: P1 - register
+	int r3 = instruction.p3; // Compare opcode: P3 - register
 
-	for (auto prevIter = std::prev(iter); prevIter != byteCodeList.begin(); prevIter = std::prev(prevIter)) {
-		if ((*prevIter).at(EXP_OPCODE) == L"Column" && 
-			((*prevIter).at(EXP_P3) == r1 || (*prevIter).at(EXP_P3) == r3)) { // Column row : p3 - register no
-			parseWhereOrIndexColumnFromOpColumn(userDbId, (*prevIter), results);
-		} else if (((*prevIter).at(EXP_OPCODE) == L"IdxRowid" || (*prevIter).at(EXP_OPCODE) == L"Rowid") 
-			&&  ((*prevIter).at(EXP_P2) == r1 || (*prevIter).at(EXP_P2) == r3)) { // Column row : p3 - register no
-			parseWhereOrIndexColumnFromOpRowid(userDbId, (*prevIter), results);
+	for (int prevIndex : program.getDefsBefore(index, { r1, r3 })) {
+		auto & prevInstruction = program.at(prevIndex);
+		if (prevIndex == 0) {
+			break;
+		}
+		if (prevInstruction.op == BC_COLUMN) { // Column row : p3 - register no
+			parseWhereOrIndexColumnFromOpColumn(userDbId, prevInstruction, results);
+		} else if (prevInstruction.op == BC_IDX_ROWID || prevInstruction.op == BC_ROWID) { // Rowid row : p2 - register no
+			parseWhereOrIndexColumnFromOpRowid(userDbId, prevInstruction, results);
 		}
 	}
 
@@ -1306,16 +1267,18 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromOpCompare(uint64_t use
 }
 
 
-void SelectSqlAnalysisService::parseWhereExpressesFromOpCompare(uint64_t userDbId, DataList::const_iterator iter, const DataList & byteCodeList, ByteCodeResults & results)
+void SelectSqlAnalysisService::parseWhereExpressesFromOpCompare(uint64_t userDbId, int index, const ByteCodeProgram & program, ByteCodeResults & results)
 {
-	auto & rowItem = (*iter);
-	std::wstring r1 = rowItem.at(EXP_P1); // Compare opcode: P1 - register
-	std::wstring r3 = rowItem.at(EXP_P3); // Compare opcode: P3 - register
+	auto & instruction = program.at(index);
+	int r1 = instruction.p1; // Compare opcode: P1 - register
+	int r3 = instruction.p3; // Compare opcode: P3 - register
 
-	for (auto prevIter = std::prev(iter); prevIter != byteCodeList.begin(); prevIter = std::prev(prevIter)) {
-		if ((*prevIter).at(EXP_OPCODE) == L"Column" && 
-			((*prevIter).at(EXP_P3) == r1 || (*prevIter).at(EXP_P3) == r3)) { // Column row : p3 - register no
-			parseWhereExpressFromOpColumn(userDbId, iter, prevIter, byteCodeList, results);
+	for (int prevIndex : program.getDefsBefore(index, { r1, r3 })) {
+		if (prevIndex == 0) {
+			break;
+		}
+		if (program.at(prevIndex).op == BC_COLUMN) { // Column row : p3 - register no
+			parseWhereExpressFromOpColumn(userDbId, index, prevIndex, program, results);
 		}
 	}
 }
@@ -1324,15 +1287,14 @@ void SelectSqlAnalysisService::parseWhereExpressesFromOpCompare(uint64_t userDbI
  * SeekRowid row.
  * 
  * @param userDbId
- * @param rowItem
+ * @param index - the index of SeekRowid instruction
  * @param results
- * @param iter
- * @param byteCodeList
+ * @param program
  */
-void SelectSqlAnalysisService::parseWhereOrIndexColumnFromSeekRowid(uint64_t userDbId, DataList::const_iterator iter, ByteCodeResults &results, const DataList & byteCodeList)
+void SelectSqlAnalysisService::parseWhereOrIndexColumnFromSeekRowid(uint64_t userDbId, int index, ByteCodeResults &results, const ByteCodeProgram & program)
 {
-	auto & rowItem = *iter;
-	int no = std::stoi(rowItem.at(EXP_P1)); // SeekRowid opcode: P1 - table no
+	auto & instruction = program.at(index);
+	int no = instruction.p1; // SeekRowid opcode: P1 - table no
 
 	// 1.Convert P1(val = table.rowId) to column name of primary key 
 	auto resIter = std::find_if(results.begin(), results.end(), [&no](const auto &item) {
@@ -1434,23 +1396,27 @@ void SelectSqlAnalysisService::parseWhereOrIndexColumnFromSeekRowid(uint64_t use
 	}
 
 	// 2.Found prev Column match P3 value
-	std::wstring r3 = (*iter).at(EXP_P3); // SeekRowid opcode : p3 - register
-	if (r3.empty()) {
+	int r3 = instruction.p3; // SeekRowid opcode : p3 - register
+	if (r3 == BYTECODE_NULL_OPERAND) {
 		return;
 	}
-	for (auto prevIter = std::prev(iter); prevIter != byteCodeList.begin(); prevIter = std::prev(prevIter)) {
-		if ((*prevIter).at(EXP_OPCODE) == L"Column" && (*prevIter).at(EXP_P3) == r3) { // Column opcode : p3 - register
-			parseWhereOrIndexColumnFromOpColumn(userDbId, (*prevIter), results);
+	for (int prevIndex : program.getDefsBefore(index, { r3 })) {
+		if (prevIndex == 0) {
+			break;
+		}
+		auto & prevInstruction = program.at(prevIndex);
+		if (prevInstruction.op == BC_COLUMN) { // Column opcode : p3 - register
+			parseWhereOrIndexColumnFromOpColumn(userDbId, prevInstruction, results);
 		}
 	}
 }
 
 
-void SelectSqlAnalysisService::parseWhereExpressesFromSeekRowid(uint64_t userDbId, DataList::const_iterator iter, ByteCodeResults &results, const DataList & byteCodeList)
+void SelectSqlAnalysisService::parseWhereExpressesFromSeekRowid(uint64_t userDbId, int index, ByteCodeResults &results, const ByteCodeProgram & program)
 {
-	auto & rowItem = *iter;
-	int no = std::stoi(rowItem.at(EXP_P1)); // SeekRowid opcode: P1 - index no/table no
-	int compareRegNo = std::stoi(rowItem.at(EXP_P3)); // SeekRowid opcode: P3 - content register
+	auto & instruction = program.at(index);
+	int no = instruction.p1; // SeekRowid opcode: P1 - index no/table no
+	int compareRegNo = instruction.p3; // SeekRowid opcode: P3 - content register
 
 	// 1.Convert P1(val = table.rowId) to column name of primary key 
 	auto resIter = std::find_if(results.begin(), results.end(), [&no](const auto &item) {
@@ -1466,19 +1432,23 @@ void SelectSqlAnalysisService::parseWhereExpressesFromSeekRowid(uint64_t userDbI
 	}
 
 	// 2.Found prev Column match P3 value
-	std::wstring r3 = (*iter).at(EXP_P3); // SeekRowid opcode : p3 - register
-	if (r3.empty()) {
+	int r3 = compareRegNo; // SeekRowid opcode : p3 - register
+	if (r3 == BYTECODE_NULL_OPERAND) {
 		return;
 	}
 	std::wstring whereExpress;
 	std::wstring whereExpressVal;
-	for (auto prevIter = std::prev(iter); prevIter != byteCodeList.begin(); prevIter = std::prev(prevIter)) {
-		if ((*prevIter).at(EXP_OPCODE) == L"Column" && (*prevIter).at(EXP_P3) == r3) { // Column opcode : p3 - register
-			whereExpressVal = getWhereOrIndexColumnFromOpColumn(userDbId, (*prevIter), results);
+	for (int prevIndex : program.getDefsBefore(index, { r3 })) {
+		if (prevIndex == 0) {
+			break;
+		}
+		auto & prevInstruction = program.at(prevIndex);
+		if (prevInstruction.op == BC_COLUMN) { // Column opcode : p3 - register
+			whereExpressVal = getWhereOrIndexColumnFromOpColumn(userDbId, prevInstruction, results);
 		}
 	}
 	if (whereExpressVal.empty()) {
-		whereExpressVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, iter, byteCodeList);
+		whereExpressVal = getWhereExpressValByOpColumn(userDbId, compareRegNo, index, program);
 	}
 	
 	Columns columns = getUserColumnStrings(userDbId, tblName);
@@ -1569,7 +1539,7 @@ std::wstring SelectSqlAnalysisService::getPrimaryKeyColumn(uint64_t userDbId, co
 	return L"";
 }
 
-void SelectSqlAnalysisService::parseWhereOrIndexNullColumnFromSql(uint64_t userDbId, const RowItem & rowItem, ByteCodeResults & results, const std::wstring & sql)
+void SelectSqlAnalysisService::parseWhereOrIndexNullColumnFromSql(uint64_t userDbId, const ByteCodeInstruction & instruction, ByteCodeResults & results, const std::wstring & sql)
 {
 	// 1.Get all table from database
 	UserTableStrings allTables = getUserTableStrings(userDbId);
@@ -1645,72 +1615,48 @@ void SelectSqlAnalysisService::parseWhereOrIndexNullColumnFromSql(uint64_t userD
 }
 
 
-void SelectSqlAnalysisService::parseSelectColumnsPrevFromResultRow(uint64_t userDbId, DataList::const_iterator resultRowIter, const DataList & byteCodeList, SelectColumns & selectColumns)
+void SelectSqlAnalysisService::parseSelectColumnsPrevFromResultRow(uint64_t userDbId, int resultRowIndex, const ByteCodeProgram & program, SelectColumns & selectColumns)
 {
-	auto & resultRowItem = *resultRowIter;
-	int registerBegin = std::stoi(resultRowItem.at(EXP_P1));
-	int registerLen = std::stoi(resultRowItem.at(EXP_P2));
+	auto & resultRow = program.at(resultRowIndex);
+	if (resultRow.p1 == BYTECODE_NULL_OPERAND || resultRow.p2 == BYTECODE_NULL_OPERAND) {
+		return;
+	}
+	int registerBegin = resultRow.p1;
+	int registerLen = resultRow.p2;
 	int registerEnd = registerBegin + registerLen - 1;
 	if (registerEnd < registerBegin) {
 		return;
 	}
 
-	DataList::const_iterator iter = std::prev(resultRowIter);
-	while (iter != byteCodeList.end()) {
-		auto & rowItem = *iter;
-		std::wstring opcode = rowItem.at(EXP_OPCODE);
-		if (opcode != L"Column" && opcode != L"Rowid" && opcode != L"IdxRowid") {
+	for (int i = resultRowIndex - 1; i >= 0; i--) {
+		auto & instruction = program.at(i);
+		ByteCodeOp op = instruction.op;
+		if (op != BC_COLUMN && op != BC_ROWID && op != BC_IDX_ROWID) {
 			break;
 		}
-		const std::wstring & comment = rowItem.at(EXP_COMMENT); //e.g., "r[9]=analysis_hair_inspection.inspection"
+		const std::wstring & comment = instruction.row->at(EXP_COMMENT); //e.g., "r[9]=analysis_hair_inspection.inspection"
 		if (comment.empty()) {
-			iter = std::prev(iter);
 			continue;
 		}
-		if (opcode == L"Column") {
-			int registerIdx = std::stoi(rowItem.at(EXP_P3)); // P3 - register index
-			if (registerIdx < registerBegin || registerIdx > registerEnd) {
-				iter = std::prev(iter);
-				continue;
-			}
-			auto strVec = StringUtil::split(comment, L"=");
-			if (strVec.size() < 2) {
-				iter = std::prev(iter);
-				continue;
-			}
-			SelectColumn selColumn;
-			selColumn.regNo = registerIdx;
-			selColumn.fullName = strVec.at(1); // strVec.at(1) - e.g., "analysis_hair_inspection.inspection"
-			auto findIter = std::find_if(selectColumns.begin(), selectColumns.end(), [&selColumn](auto & item) {
-				return selColumn.fullName == item.fullName;
-			});
-			if (findIter == selectColumns.end()) {
-				selectColumns.push_back(selColumn); 
-			}
-			
-		} else if (opcode == L"Rowid" || opcode == L"IdxRowid") {
-			int registerIdx = std::stoi(rowItem.at(EXP_P2)); // P2 - register index
-			if (registerIdx < registerBegin || registerIdx > registerEnd) {
-				iter = std::prev(iter);
-				continue;
-			}
-			auto strVec = StringUtil::split(comment, L"=");
-			if (strVec.size() < 2) {
-				iter = std::prev(iter);
-				continue;
-			}
-			SelectColumn selColumn;
-			selColumn.regNo = registerIdx;
-			selColumn.fullName = strVec.at(1); // strVec.at(1) - e.g., "analysis_hair_inspection.id"
-
-			auto findIter = std::find_if(selectColumns.begin(), selectColumns.end(), [&selColumn](auto & item) {
-				return selColumn.fullName == item.fullName;
-			});
-			if (findIter == selectColumns.end()) {
-				selectColumns.push_back(selColumn); 
-			}
+		// Column : P3 - register index, e.g., "analysis_hair_inspection.inspection"
+		// Rowid/IdxRowid : P2 - register index, e.g., "analysis_hair_inspection.id"
+		int registerIdx = op == BC_COLUMN ? instruction.p3 : instruction.p2;
+		if (registerIdx < registerBegin || registerIdx > registerEnd) {
+			continue;
+		}
+		auto strVec = StringUtil::split(comment, L"=");
+		if (strVec.size() < 2) {
+			continue;
+		}
+		SelectColumn selColumn;
+		selColumn.regNo = registerIdx;
+		selColumn.fullName = strVec.at(1);
+		auto findIter = std::find_if(selectColumns.begin(), selectColumns.end(), [&selColumn](auto & item) {
+			return selColumn.fullName == item.fullName;
+		});
+		if (findIter == selectColumns.end()) {
+			selectColumns.push_back(selColumn); 
 		}
-		iter = std::prev(iter);
 	}
 }
 
@@ -2065,37 +2011,37 @@ std::vector<std::pair<int, std::wstring>> SelectSqlAnalysisService::getIndexColu
  * Get where express value by index column.
  * e.g., where term "where a.gender = 'male' ", return "male"
  * 
- * @param regNo - register number of current row : (*rowIter).at(EXP_P2)
- * @param tblName - table name
- * @param rowIter - current row iterator
- * @param byteCodeList - byteCode list from explain result
+ * @param regNo - register number of current row : instruction.p2
+ * @param index - the index of current instruction
+ * @param program - the decoded program from explain result
  * @return 
  */
-std::wstring SelectSqlAnalysisService::getWhereExpressValByOpColumn(uint64_t userDbId, int compareRegNo, DataList::const_iterator rowIter, const DataList & byteCodeList)
+std::wstring SelectSqlAnalysisService::getWhereExpressValByOpColumn(uint64_t userDbId, int compareRegNo, int index, const ByteCodeProgram & program)
 {
 	std::wstring result;
-	auto & beginIter = byteCodeList.begin();
-	
 	
-	// 1.Found direction: up, From current row iterator(rowIter) to first row iterator(beginIter)
-	for (auto & prevIter = std::prev(rowIter);prevIter != beginIter; prevIter = std::prev(prevIter)) {
-		result = convertByteCodeIterToWhereExpValue(prevIter, compareRegNo);
+	// 1.Found direction: up, From current instruction to first instruction, by the instructions that write the register
+	for (int prevIndex : program.getDefsBefore(index, { compareRegNo })) {
+		if (prevIndex == 0) {
+			break;
+		}
+		result = convertInstructionToWhereExpValue(program.at(prevIndex), compareRegNo);
 		if (!result.empty()) {
 			return result;
 		}
 	}
 
 	// 2.Found direction: down, From initRow.p2 point to nextRow.addr
-	auto startIterAddr = (*beginIter).at(EXP_P2);
-	auto initBeginIter = std::find_if(byteCodeList.begin(), byteCodeList.end(), [&startIterAddr](auto & rowItem) {
-		return startIterAddr == rowItem.at(EXP_ADDR);
-	});
-
-	if (initBeginIter == byteCodeList.end()) {
+	if (program.size() == 0) {
 		return result;
 	}
-	for (auto nextIter = initBeginIter; nextIter != byteCodeList.end(); nextIter = std::next(nextIter)) {
-		result = convertByteCodeIterToWhereExpValue(nextIter, compareRegNo);
+	int initIndex = program.indexOfAddr(program.at(0).p2);
+	if (initIndex == -1) {
+		return result;
+	}
+	auto & defs = program.getDefs(compareRegNo);
+	for (auto iter = std::lower_bound(defs.begin(), defs.end(), initIndex); iter != defs.end(); iter++) {
+		result = convertInstructionToWhereExpValue(program.at(*iter), compareRegNo);
 		if (!result.empty()) {
 			return result;
 		}
@@ -2104,61 +2050,27 @@ std::wstring SelectSqlAnalysisService::getWhereExpressValByOpColumn(uint64_t use
 	return result;
 }
 
-std::wstring SelectSqlAnalysisService::convertByteCodeIterToWhereExpValue(DataList::const_iterator iter, int compareRegNo)
+std::wstring SelectSqlAnalysisService::convertInstructionToWhereExpValue(const ByteCodeInstruction & instruction, int compareRegNo)
 {
 	std::wstring result;
-	auto & rowItem = (*iter);
-	auto & opcode = rowItem.at(EXP_OPCODE);
-	if (opcode == L"Integer") { // P1 - VAL, P2 - register no
-		auto rowP1 = rowItem.at(EXP_P1); // value
-		auto rowP2 = std::stoi(rowItem.at(EXP_P2)); // register no;
-		if (rowP2 == compareRegNo) { // curent row register no == prev row P2 
-			result = rowP1; // P1 - value
-			return result;
-		}
-	} else if (opcode == L"String8" || opcode == L"Real" || opcode == L"Blob") {
-		auto rowP2 = std::stoi(rowItem.at(EXP_P2)); // register no;
-		auto rowP4 = rowItem.at(EXP_P4); // value
-		if (rowP2 == compareRegNo) { // curent row register no == prev row P2 
-			result =  L"\'" + StringUtil::escapeSql(rowP4) + L"\'"; // P4 - String8 value, P4 points to a nul terminated UTF-8 string.
-			return result;
-		}
-	} else if (opcode == L"String") {
-		auto rowP1 = rowItem.at(EXP_P1); // string length
-		auto rowP2 = std::stoi(rowItem.at(EXP_P2)); // register no;
-		auto rowP3 = rowItem.at(EXP_P3); // P3 if is zero, then if it is equal to P5
-		auto rowP4 = rowItem.at(EXP_P4); // P4 string buffer
-		auto rowP5 = std::stoi(rowItem.at(EXP_P5)); // P5 if it is equal to P3
-
-		if (rowP2 == compareRegNo) {
-			std::wstring p4Content = L"\'" + StringUtil::escapeSql(rowP4) + L"\'";
+	auto & rowItem = *instruction.row;
+	if (instruction.p2 != compareRegNo) { // curent row register no == prev row P2 
+		return result;
+	}
+	if (instruction.op == BC_INTEGER) { // P1 - VAL, P2 - register no
+		result = rowItem.at(EXP_P1); // P1 - value
+	} else if (instruction.op == BC_STRING8 || instruction.op == BC_REAL || instruction.op == BC_BLOB) {
+		result =  L"\'" + StringUtil::escapeSql(rowItem.at(EXP_P4)) + L"\'"; // P4 - String8 value, P4 points to a nul terminated UTF-8 string.
+	} else if (instruction.op == BC_STRING) {
+		auto & rowP3 = rowItem.at(EXP_P3); // P3 if is zero, then if it is equal to P5
+		std::wstring p4Content = L"\'" + StringUtil::escapeSql(rowItem.at(EXP_P4)) + L"\'"; // P4 string buffer
 		
-			// If P3 is not zero and the content of register P3 is equal to P5, then the datatype of the register P2 is converted to BLOB. 
-			// The content is the same sequence of bytes, it is merely interpreted as a BLOB instead of a string, as if it had been CAST. In other words:
-			// if( P3!=0 and reg[P3]==P5 ) reg[P2] := CAST(reg[P2] as BLOB)
-			if (rowP3 == L"5" || rowP3 == L"P5") result = L"CAST(" + p4Content + L" AS BLOB)";
-			else result = p4Content;
-		}		
+		// If P3 is not zero and the content of register P3 is equal to P5, then the datatype of the register P2 is converted to BLOB. 
+		// The content is the same sequence of bytes, it is merely interpreted as a BLOB instead of a string, as if it had been CAST. In other words:
+		// if( P3!=0 and reg[P3]==P5 ) reg[P2] := CAST(reg[P2] as BLOB)
+		if (rowP3 == L"5" || rowP3 == L"P5") result = L"CAST(" + p4Content + L" AS BLOB)";
+		else result = p4Content;
 	}
 
 	return result;
 }
-
-std::wstring SelectSqlAnalysisService::getOpcodeByByteCodeAddr(const std::wstring & addr, const DataList & byteCodeList)
-{
-	if (addr.empty()) {
-		return L"";
-	}
-
-	auto iter = std::find_if(byteCodeList.begin(), byteCodeList.end(), [&addr](auto & rowItem) {
-		return rowItem.at(EXP_ADDR) == addr;
-	});
-	if (iter == byteCodeList.end()) {
-		return L"";
-	}
-
-	return (*iter).at(EXP_OPCODE);
-}
-
-
-
@@ -25,6 +25,7 @@
 #include "core/repository/user/ColumnUserRepository.h"
 #include "core/repository/report/PerfAnalysisReportRepository.h"
 #include "core/common/repository/QSqlStatement.h"
+#include "utils/ByteCodeProgram.h"
 
 class SelectSqlAnalysisService : public BaseService<SelectSqlAnalysisService, SqlExecutorUserRepository>
 {
@@ -34,8 +35,8 @@ public:
 
 	DataList explainSql(uint64_t userDbId, const std::wstring & sql);
 	ExplainQueryPlans explainQueryPlanSql(uint64_t userDbId, const std::wstring & sql);
-	ByteCodeResults explainReadByteCodeToResults(uint64_t userDbId, const DataList & byteCodeList, const std::wstring &sql);
-	SelectColumns explainReadByteCodeToSelectColumns(uint64_t userDbId, const DataList & byteCodeList, const std::wstring &sql);
+	ByteCodeResults explainReadByteCodeToResults(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring &sql);
+	SelectColumns explainReadByteCodeToSelectColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring &sql);
 
 	
 	uint64_t savePerfAnalysisReport(uint64_t userDbId, uint64_t sqlLogId);
@@ -49,18 +50,20 @@ private:
 	ColumnUserRepository * columnUserRepository = ColumnUserRepository::getInstance();
 	PerfAnalysisReportRepository * perfAnalysisReportRepository = PerfAnalysisReportRepository::getInstance();
 
-	void doConvertByteCodeForWhereColumns(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults & results);
-	void doConvertByteCodeForOrderColumns(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults & results);
+	void doConvertByteCodeForWhereColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults & results);
+	void doConvertByteCodeForOrderColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults & results);
 	void doMergeColumnsToResults(uint64_t userDbId, ByteCodeResults & results);
-	void doConvertByteCodeForSelectColumns(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, SelectColumns & selectColumns);
+	void doConvertByteCodeForSelectColumns(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, SelectColumns & selectColumns);
 
-	bool parseOrderOrIndexColumnFromLastAndPrev(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results);
-	void parseOrderOrIndexColumnFromIdxInsertAndSort(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results);
-	void parseOrderOrIndexColumnFromSorter(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results);
+	bool parseOrderOrIndexColumnFromLastAndPrev(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results);
+	void parseOrderOrIndexColumnFromIdxInsertAndSort(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results);
+	void parseOrderOrIndexColumnFromSorter(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results);
+	bool parseByteCodeUseColumnsFromMakeRecord(uint64_t userDbId, const ByteCodeProgram & program, int makeRecordIndex, 
+		ByteCodeResults &results, ByteCodeUseColumns & byteCodeUseColumns);
 
 	void parseOrderColumnsBySubSelectClause(uint64_t userDbId, const std::wstring & sql,  ByteCodeResults & results);
 
-	void parseOrderOrIndexColumnFromOpSorter(uint64_t userDbId, const DataList &byteCodeList, const std::wstring & sql, ByteCodeResults &results);
+	void parseOrderOrIndexColumnFromOpSorter(uint64_t userDbId, const ByteCodeProgram & program, const std::wstring & sql, ByteCodeResults &results);
 	bool parseOrderColumnFromSql(ByteCodeResults::iterator tblIter, uint64_t userDbId, const std::wstring & sql, ByteCodeResults &results);
 	void parseOrderColumnFromByteCodeUseColumnAndSql(
 		uint64_t userDbId, 
@@ -68,26 +71,25 @@ private:
 		const std::wstring & sql, 
 		ByteCodeResults & results);
 
-	void parseTableAndIndexFromOpenRead(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results);
-	void parseWhereIdxColumnsFromExplainRow(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results);
-	void parseWhereExpressesFromSeekOpsRow(uint64_t userDbId, DataList::const_iterator rowIter, const DataList &byteCodeList, ByteCodeResults & results);
-	void parseWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results);
-	void parseWhereOrIndexColumnFromOpRowid(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results);
-	std::wstring getWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const RowItem &rowItem, ByteCodeResults &results);
-	void parseWhereExpressFromOpColumn(uint64_t userDbId, DataList::const_iterator compareRowIter,
-		DataList::const_iterator columnRowIter, const DataList &byteCodeList, ByteCodeResults &results);
+	void parseTableAndIndexFromOpenRead(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results);
+	void parseWhereIdxColumnsFromExplainRow(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results);
+	void parseWhereExpressesFromSeekOpsRow(uint64_t userDbId, int index, const ByteCodeProgram & program, ByteCodeResults & results);
+	void parseWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results);
+	void parseWhereOrIndexColumnFromOpRowid(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results);
+	std::wstring getWhereOrIndexColumnFromOpColumn(uint64_t userDbId, const ByteCodeInstruction &instruction, ByteCodeResults &results);
+	void parseWhereExpressFromOpColumn(uint64_t userDbId, int compareIndex, int columnIndex, const ByteCodeProgram & program, ByteCodeResults &results);
 	
-	void parseWhereOrIndexColumnFromOpCompare(uint64_t userDbId, DataList::const_iterator iter,  const DataList & byteCodeList, ByteCodeResults & results);
-	void parseWhereExpressesFromOpCompare(uint64_t userDbId, DataList::const_iterator iter, const DataList & byteCodeList, ByteCodeResults & results);
-	void parseWhereOrIndexColumnFromSeekRowid(uint64_t userDbId, DataList::const_iterator iter, ByteCodeResults &results, const DataList & byteCodeList);
-	void parseWhereExpressesFromSeekRowid(uint64_t userDbId, DataList::const_iterator iter, ByteCodeResults &results, const DataList & byteCodeList);
+	void parseWhereOrIndexColumnFromOpCompare(uint64_t userDbId, int index, const ByteCodeProgram & program, ByteCodeResults & results);
+	void parseWhereExpressesFromOpCompare(uint64_t userDbId, int index, const ByteCodeProgram & program, ByteCodeResults & results);
+	void parseWhereOrIndexColumnFromSeekRowid(uint64_t userDbId, int index, ByteCodeResults &results, const ByteCodeProgram & program);
+	void parseWhereExpressesFromSeekRowid(uint64_t userDbId, int index, ByteCodeResults &results, const ByteCodeProgram & program);
 
 	Columns getUserColumnStrings(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
 	std::wstring getPrimaryKeyColumn(uint64_t userDbId, const std::wstring & tblName, Columns & columns, const std::wstring & schema = std::wstring());
 
-	void parseWhereOrIndexNullColumnFromSql(uint64_t userDbId, const RowItem & rowItem, ByteCodeResults & results, const std::wstring & sql);
+	void parseWhereOrIndexNullColumnFromSql(uint64_t userDbId, const ByteCodeInstruction & instruction, ByteCodeResults & results, const std::wstring & sql);
 
-	void parseSelectColumnsPrevFromResultRow(uint64_t userDbId, DataList::const_iterator resultRowIter, const DataList & byteCodeList, SelectColumns & selectColumns);
+	void parseSelectColumnsPrevFromResultRow(uint64_t userDbId, int resultRowIndex, const ByteCodeProgram & program, SelectColumns & selectColumns);
 	
 	UserTableStrings getUserTableStrings(uint64_t userDbId, const std::wstring & schema = std::wstring());
 	std::vector<std::tuple<std::wstring, std::wstring, std::wstring>> parseWhereNullColumnsFromSelectSqlUpWords(
@@ -106,8 +108,6 @@ private:
 	std::vector<std::pair<int, std::wstring>> getIndexColumnsByCoveringIndexName(uint64_t userDbId, int no, const std::wstring & coveringIndexName);
 	
 	
-	std::wstring getWhereExpressValByOpColumn(uint64_t userDbId, int regNo, DataList::const_iterator rowIter, const DataList & byteCodeList);
-	std::wstring convertByteCodeIterToWhereExpValue(DataList::const_iterator iter, int compareRegNo);
-
-	std::wstring getOpcodeByByteCodeAddr(const std::wstring & compareJumpAddr, const DataList & byteCodeList);
+	std::wstring getWhereExpressValByOpColumn(uint64_t userDbId, int regNo, int index, const ByteCodeProgram & program);
+	std::wstring convertInstructionToWhereExpValue(const ByteCodeInstruction & instruction, int compareRegNo);
 };
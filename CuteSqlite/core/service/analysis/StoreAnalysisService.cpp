@@ -42,6 +42,7 @@ uint64_t StoreAnalysisService::getFreePageCount(uint64_t userDbId)
 DbSpaceUsed & StoreAnalysisService::getDbSpaceUsed(uint64_t userDbId)
 {
 	ATLASSERT(userDbId);
+	clearCacheIfChanged(userDbId);
 	if (!cacheDbSpaceUsedMap.empty()) {
 		auto iter = cacheDbSpaceUsedMap.find(userDbId);
 		if (iter != cacheDbSpaceUsedMap.end()) {
@@ -494,6 +495,28 @@ void StoreAnalysisService::clearCache(uint64_t userDbId)
 	if (iter2 != cacheDbSpaceUsedMap.end()) {
 		cacheDbSpaceUsedMap.erase(iter2);
 	}
+
+	auto iter3 = cacheChangeCounterMap.find(userDbId);
+	if (iter3 != cacheChangeCounterMap.end()) {
+		cacheChangeCounterMap.erase(iter3);
+	}
+}
+
+/**
+ * Clear the cache of user db if the database has been changed since the cache was created, 
+ * so the analysis is reused until the database is changed.
+ * 
+ * @param userDbId
+ */
+void StoreAnalysisService::clearCacheIfChanged(uint64_t userDbId)
+{
+	DbChangeCounter changeCounter = getRepository()->getDbChangeCounter(userDbId);
+	auto iter = cacheChangeCounterMap.find(userDbId);
+	if (iter != cacheChangeCounterMap.end() && iter->second == changeCounter) {
+		return;
+	}
+	clearCache(userDbId);
+	cacheChangeCounterMap[userDbId] = changeCounter;
 }
 
 uint64_t StoreAnalysisService::autovacuumOverhead(uint64_t userDbId, uint64_t filePgcnt, int pageSize)
@@ -535,6 +558,7 @@ uint64_t StoreAnalysisService::getInUsePage(uint64_t userDbId)
 TblIdxSpaceUsedList & StoreAnalysisService::getTblIdxSpaceUsedList(uint64_t userDbId)
 {
 	// Get from cache map
+	clearCacheIfChanged(userDbId);
 	if (!cacheTblIdxSpaceUsedListMap.empty()) {
 		auto iter = cacheTblIdxSpaceUsedListMap.find(userDbId);
 		if (iter != cacheTblIdxSpaceUsedListMap.end()) {
@@ -542,11 +566,18 @@ TblIdxSpaceUsedList & StoreAnalysisService::getTblIdxSpaceUsedList(uint64_t user
 		}
 	}
 
+	// all the tables and indexes are aggregated by one scan of dbstat
 	TblIdxSpaceUsedList tblIdxSpaceUsedList;
+	TblIdxSpaceUsedMap tblIdxSpaceUsedMap = getRepository()->getTblIdxSpaceUsedMap(userDbId);
 	SqliteSchemaList schemaList = sqliteSchemaUserRepository->getListGtRootpage(userDbId);
 	schemaList.push_back({ L"table", L"sqlite_schema", L"sqlite_schema", 0, L"" });
-	for (auto & schema : schemaList) {		
-		TblIdxSpaceUsed tblIdxSpaceUsed = getRepository()->getTblIdxSpaceUsedByName(userDbId, schema.name);
+	for (auto & schema : schemaList) {
+		auto iter = tblIdxSpaceUsedMap.find(schema.name);
+		if (iter == tblIdxSpaceUsedMap.end() && schema.name == L"sqlite_schema") {
+			// the older SQLite names the schema table as sqlite_master in dbstat
+			iter = tblIdxSpaceUsedMap.find(L"sqlite_master");
+		}
+		TblIdxSpaceUsed tblIdxSpaceUsed = iter != tblIdxSpaceUsedMap.end() ? iter->second : TblIdxSpaceUsed();
 		tblIdxSpaceUsed.name = schema.name;
 		tblIdxSpaceUsed.tblName = schema.tblName;
 		tblIdxSpaceUsed.isIndex = int(schema.name != schema.tblName);
@@ -52,9 +52,11 @@ private:
 	// template params: first(uint64_t) - userDbId, second(TblIdxSpaceUsedList) - table and index SpaceUsed List
 	std::unordered_map<uint64_t, TblIdxSpaceUsedList> cacheTblIdxSpaceUsedListMap; // The TblIdxSpaceUsedList cache Map of specified user db id
 	std::unordered_map<uint64_t, DbSpaceUsed> cacheDbSpaceUsedMap; // The DbSpaceUsed cache Map of specified user db id
+	std::unordered_map<uint64_t, DbChangeCounter> cacheChangeCounterMap; // The DbChangeCounter when the cache of specified user db id is created
 
 	SqliteSchemaUserRepository * sqliteSchemaUserRepository = SqliteSchemaUserRepository::getInstance();
 
+	void clearCacheIfChanged(uint64_t userDbId);
 	uint64_t autovacuumOverhead(uint64_t userDbId, uint64_t filePgcnt, int pageSize);
 	uint64_t getInUsePage(uint64_t userDbId);
 	TblIdxSpaceUsedList & getTblIdxSpaceUsedList(uint64_t userDbId);
@@ -24,8 +24,6 @@
 #include "utils/SqlUtil.h"
 #include "core/common/exception/QRuntimeException.h"
 
-Functions DatabaseService::functions;
-
 DatabaseService::DatabaseService()
 {
 
@@ -217,10 +215,8 @@ Functions DatabaseService::getFunctionsStrings(uint64_t userDbId, bool upcase)
 {
 	ATLASSERT(userDbId > 0);
 	
-	if (functions.empty()) {
-		functions = databaseUserRepository->getFunctions(userDbId);
-	}
-		
+	// cached in the catalog of user db connect
+	Functions functions = databaseUserRepository->getFunctions(userDbId);
 	if (!upcase) {
 		return functions;
 	}
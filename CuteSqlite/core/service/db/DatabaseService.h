@@ -60,6 +60,4 @@ private:
 	IndexUserRepository * indexUserRepository = IndexUserRepository::getInstance();
 	ViewUserRepository * viewUserRepository = ViewUserRepository::getInstance();
 	TriggerUserRepository * triggerUserRepository = TriggerUserRepository::getInstance();
-
-	static Functions functions;
 };
@@ -19,12 +19,48 @@
  *********************************************************************/
 #include "stdafx.h"
 #include "TableService.h"
+#include <cerrno>
+#include <unordered_map>
 #include "utils/Log.h"
 #include "utils/SqlUtil.h"
 #include "core/common/Lang.h"
 #include "core/common/exception/QRuntimeException.h"
 #include "core/common/exception/QSqlExecuteException.h"
 
+// The value type of the column affinity by SqlUtil::getColumnAffinity(), SQLite stores the text as it is for TEXT and BLOB affinity
+static RowValueType getColumnAffinityType(const std::wstring & declType)
+{
+	switch (SqlUtil::getColumnAffinity(declType)) {
+	case COLUMN_AFFINITY_INTEGER: return ROW_VALUE_INTEGER;
+	case COLUMN_AFFINITY_REAL: case COLUMN_AFFINITY_NUMERIC: return ROW_VALUE_FLOAT;
+	default: return ROW_VALUE_TEXT;
+	}
+}
+
+// Bind the text as the number only if the whole text is a number, so the stored value is the same as the text converted by SQLite
+static RowValueType getRowValueType(RowValueType affinityType, const std::wstring & val)
+{
+	if (affinityType == ROW_VALUE_TEXT || val.empty() 
+		|| !(iswdigit(val.front()) || val.front() == L'-' || val.front() == L'+')) {
+		return ROW_VALUE_TEXT;
+	}
+	wchar_t * end = nullptr;
+	errno = 0;
+	_wcstoi64(val.c_str(), &end, 10);
+	if (errno == 0 && end && *end == L'\0') {
+		return ROW_VALUE_INTEGER;
+	}
+	if (affinityType == ROW_VALUE_INTEGER && val.find_first_of(L".eE") == std::wstring::npos) {
+		return ROW_VALUE_TEXT;
+	}
+	errno = 0;
+	wcstod(val.c_str(), &end);
+	if (errno == 0 && end && *end == L'\0') {
+		return ROW_VALUE_FLOAT;
+	}
+	return ROW_VALUE_TEXT;
+}
+
 TableService::TableService()
 {
 
@@ -41,6 +77,24 @@ uint64_t TableService::getTableDataCount(uint64_t userDbId, const std::wstring &
 	return getRepository()->getDataCount(userDbId, tblName, schema);
 }
 
+/**
+ * Estimate the rows of table without scanning it, such as the rows shown before rebuilding the table.
+ */
+uint64_t TableService::getTableEstimatedDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !tblName.empty());
+	std::wstring rowIdName;
+	try {
+		TableKeyset keyset = getTableKeyset(userDbId, tblName, schema);
+		if (keyset.isRowId) {
+			rowIdName = keyset.keyColumns.at(0);
+		}
+	} catch (QRuntimeException &) {
+		// the table has no key, the rows are estimated by dbstat
+	}
+	return getRepository()->getEstimatedDataCount(userDbId, tblName, rowIdName, schema);
+}
+
 int TableService::getTableDataPageCount(uint64_t userDbId, const std::wstring & tblName, int perpage, const std::wstring & schema)
 {
 	ATLASSERT(userDbId > 0 && !tblName.empty() && perpage > 0);
@@ -87,6 +141,74 @@ std::pair<Columns, DataList> TableService::getTableDataListWithColumns(uint64_t
 	return result;
 }
 
+/**
+ * Get the keyset for walking the table by getTableKeysetDataList(), the key is the rowid of rowid table,
+ * or the primary key columns of WITHOUT ROWID table.
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param schema - the schema
+ * @return 
+ */
+TableKeyset TableService::getTableKeyset(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !tblName.empty());
+	TableKeyset keyset;
+	UserTable userTable = getRepository()->getTable(userDbId, tblName, schema);
+	ColumnInfoList columns = columnUserRepository->getListByTblName(userDbId, tblName, schema);
+	std::wregex withoutRowIdPat(L"\\)\\s*without\\s+rowid", std::wregex::icase);
+	if (!std::regex_search(userTable.sql, withoutRowIdPat)) {
+		// the rowid can't be used if the table has the column with the same name
+		Columns columnNames;
+		for (auto & columnInfo : columns) {
+			columnNames.push_back(columnInfo.name);
+		}
+		std::wstring rowIdName = SqlUtil::getRowIdAlias(columnNames);
+		if (!rowIdName.empty()) {
+			keyset.keyColumns.push_back(rowIdName);
+			keyset.isRowId = true;
+			return keyset;
+		}
+	}
+
+	// the pk of PRAGMA table_info is the index of column in the primary key, begin with 1
+	std::sort(columns.begin(), columns.end(), [](const ColumnInfo & col1, const ColumnInfo & col2) {
+		return col1.pk < col2.pk;
+	});
+	for (auto & columnInfo : columns) {
+		if (columnInfo.pk) {
+			keyset.keyColumns.push_back(columnInfo.name);
+		}
+	}
+	if (keyset.keyColumns.empty()) {
+		Q_ERROR(L"table has no key for keyset, table:{}", tblName);
+		throw QRuntimeException(L"200020", L"sorry, the table has no key to walk.");
+	}
+	return keyset;
+}
+
+/**
+ * Read the next page of table by the keyset, the time of every page doesn't grow with the pages have been read.
+ * Usage: 
+ *   TableKeyset keyset = getTableKeyset(userDbId, tblName);
+ *   while (!keyset.isEnd) {
+ *     DataList dataList = getTableKeysetDataList(userDbId, tblName, keyset, perpage);
+ *   }
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param keyset - [in/out] the keyset from getTableKeyset()
+ * @param perpage - the rows of one page
+ * @param whereClause - the where clause, can be empty
+ * @param schema - the schema
+ * @return the rows of the page
+ */
+DataList TableService::getTableKeysetDataList(uint64_t userDbId, const std::wstring & tblName, TableKeyset & keyset, int perpage, const std::wstring & whereClause, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !tblName.empty() && perpage > 0);
+	return getRepository()->getKeysetDataList(userDbId, tblName, whereClause, keyset, perpage, schema);
+}
+
 bool TableService::isExistsTblName(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema)
 {
 	UserTable userTable = getRepository()->getTable(userDbId, tblName, schema);
@@ -108,6 +230,118 @@ bool TableService::execBySql(uint64_t userDbId, const std::wstring & sql)
 	return true;
 }
 
+/**
+ * Execute the sql that copies rows, such as INSERT INTO ... SELECT, with the progress handler of SQLite.
+ * 
+ * @param userDbId - the user db id
+ * @param sql - the sql
+ * @param progressHandler - called every TABLE_COPY_PROGRESS_OPS instructions of SQLite, return non-zero to interrupt the sql
+ * @param progressArg - the argument of progressHandler
+ * @return the changed rows
+ */
+int TableService::execBySqlWithProgress(uint64_t userDbId, const std::wstring & sql, int (*progressHandler)(void *), void * progressArg)
+{
+	ATLASSERT(userDbId > 0 && !sql.empty());
+	return getRepository()->execBySqlWithProgress(userDbId, sql, TABLE_COPY_PROGRESS_OPS, progressHandler, progressArg);
+}
+
+/**
+ * Apply the changes of the rows in one transaction, the rows are applied by the prepared statements of the same columns.
+ * The text value is bound as INTEGER/REAL if the column has the numeric affinity and the text is a number.
+ * If any row has failed, all the changes are rolled back and the failed rows are returned in errors.
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param rowChanges - [in/out] the row changes, the types of the values are resolved by the columns
+ * @param errors - [out] the failed rows
+ * @param schema - the schema
+ * @return the rows have been changed, 0 if has error
+ */
+uint64_t TableService::applyRowChanges(uint64_t userDbId, const std::wstring & tblName, RowChanges & rowChanges, 
+	RowChangeErrors & errors, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !tblName.empty());
+	if (rowChanges.empty()) {
+		return 0;
+	}
+	std::unordered_map<std::wstring, RowValueType> affinityTypes;
+	for (auto & columnInfo : getUserColumns(userDbId, tblName, schema)) {
+		affinityTypes[StringUtil::toupper(columnInfo.name)] = getColumnAffinityType(columnInfo.type);
+	}
+	auto resolveTypes = [&affinityTypes](RowChangeValues & values) {
+		for (auto & value : values) {
+			if (value.type != ROW_VALUE_TEXT) {
+				continue;
+			}
+			auto iter = affinityTypes.find(StringUtil::toupper(value.column));
+			if (iter != affinityTypes.end()) {
+				value.type = getRowValueType(iter->second, value.val);
+			}
+		}
+	};
+	for (auto & rowChange : rowChanges) {
+		resolveTypes(rowChange.values);
+		resolveTypes(rowChange.keys);
+	}
+
+	getRepository()->execBySql(userDbId, L"BEGIN;");
+	uint64_t rows = getRepository()->applyRowChanges(userDbId, tblName, rowChanges, errors, schema);
+	if (errors.empty()) {
+		getRepository()->execBySql(userDbId, L"COMMIT;");
+		return rows;
+	}
+	try {
+		getRepository()->execBySql(userDbId, L"ROLLBACK;");
+	} catch (QSqlExecuteException &ex) {
+		// the transaction has been rolled back by the error
+		Q_ERROR(L"rollback has error:{}, msg:{}", ex.getCode(), ex.getMsg());
+	}
+	return 0;
+}
+
+std::wstring TableService::getRowChangeSql(const std::wstring & tblName, const RowChange & rowChange, const std::wstring & schema)
+{
+	return getRepository()->makeRowChangeSql(tblName, rowChange, schema);
+}
+
+void TableService::attachDatabase(uint64_t userDbId, const std::wstring & dbPath, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !dbPath.empty() && !schema.empty());
+	getRepository()->attachDatabase(userDbId, dbPath, schema);
+}
+
+void TableService::detachDatabase(uint64_t userDbId, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !schema.empty());
+	getRepository()->detachDatabase(userDbId, schema);
+}
+
+/**
+ * Copy the rows of source table in the attached database to the target table by one statement, 
+ * the values are copied by SQLite directly and keep their types.
+ * SQL: INSERT INTO "target_tbl" SELECT * FROM "source_schema"."source_tbl" [WHERE {whereClause}]
+ * 
+ * @param userDbId - the user db id of target table
+ * @param targetTblName - the target table name
+ * @param sourceSchema - the schema of attached database by attachDatabase()
+ * @param sourceTblName - the source table name
+ * @param whereClause - the where clause, can be empty
+ * @param progressHandler - called every TABLE_COPY_PROGRESS_OPS instructions of SQLite, return non-zero to interrupt the copy
+ * @param progressArg - the argument of progressHandler
+ * @return the rows have been copied
+ */
+int TableService::copyTableDataFromSchema(uint64_t userDbId, const std::wstring & targetTblName, const std::wstring & sourceSchema, 
+	const std::wstring & sourceTblName, const std::wstring & whereClause, int (*progressHandler)(void *), void * progressArg)
+{
+	ATLASSERT(userDbId > 0 && !targetTblName.empty() && !sourceSchema.empty() && !sourceTblName.empty());
+	std::wstring sql = L"INSERT INTO \"";
+	sql.append(targetTblName).append(L"\" SELECT * FROM \"")
+		.append(sourceSchema).append(L"\".\"").append(sourceTblName).append(L"\"");
+	if (!whereClause.empty()) {
+		sql.append(L" WHERE ").append(whereClause);
+	}
+	return getRepository()->execBySqlWithProgress(userDbId, sql, TABLE_COPY_PROGRESS_OPS, progressHandler, progressArg);
+}
 
 UserTableList TableService::getUserTables(uint64_t userDbId)
 {
@@ -142,8 +376,8 @@ ColumnInfoList TableService::getUserColumns(uint64_t userDbId, const std::wstrin
 	}
 
 	UserTable userTable = getUserTable(userDbId, tblName, schema);
-	IndexInfo primaryKey = SqlUtil::parseConstraintsForPrimaryKey(userTable.sql);
-	ColumnInfoList ddlColumns = SqlUtil::parseColumnsByTableDDL(userTable.sql);
+	IndexInfo primaryKey = getDdlPrimaryKey(userDbId, userTable, schema);
+	ColumnInfoList ddlColumns = getDdlColumns(userDbId, userTable, schema);
 	
 	auto colVec = StringUtil::split(primaryKey.columns, L",");
 	// supplemented the ai and pk properties
@@ -195,8 +429,7 @@ IndexInfoList TableService::getIndexInfoList(uint64_t userDbId, const std::wstri
 		return IndexInfoList();
 	}
 
-	std::wstring & createTblSql = userTable.sql;
-	IndexInfoList indexInfoList = SqlUtil::parseConstraints(createTblSql);
+	IndexInfoList indexInfoList = getDdlConstraints(userDbId, userTable, schema);
 
 	// parse create index ddl
 	UserIndexList userIndexList = getUserIndexes(userDbId, tblName, schema);
@@ -218,6 +451,58 @@ PragmaIndexColumns TableService::getPragmaIndexColumns(uint64_t userDbId, const
 	return indexUserRepository->getPragmaIndexColumns(userDbId, indexName);
 }
 
+/**
+ * Check the rows of table can be read in the order of column by the b-tree, so ORDER BY column needs no sorting.
+ * The column is the rowid, the INTEGER PRIMARY KEY (alias of rowid) or the first column of an index.
+ * 
+ * @param userDbId - the user db id
+ * @param tblName - the table name
+ * @param column - the column name
+ * @param schema - the schema
+ * @return 
+ */
+bool TableService::isOrderedByIndex(uint64_t userDbId, const std::wstring & tblName, const std::wstring & column, const std::wstring & schema)
+{
+	ATLASSERT(userDbId > 0 && !tblName.empty());
+	if (column.empty()) {
+		return false;
+	}
+	std::wstring upColumn = StringUtil::toupper(column);
+	if (upColumn == L"ROWID" || upColumn == L"_ROWID_" || upColumn == L"OID" || upColumn == L"_CT_SQLITE_ROWID") {
+		return true;
+	}
+
+	// 1.the only one primary key column of INTEGER type is the alias of rowid
+	ColumnInfoList columns = columnUserRepository->getListByTblName(userDbId, tblName, schema);
+	int nPk = 0;
+	bool isRowIdAlias = false;
+	for (auto & columnInfo : columns) {
+		if (!columnInfo.pk) {
+			continue;
+		}
+		nPk++;
+		if (StringUtil::toupper(columnInfo.name) == upColumn && StringUtil::toupper(columnInfo.type) == L"INTEGER") {
+			isRowIdAlias = true;
+		}
+	}
+	if (nPk == 1 && isRowIdAlias) {
+		return true;
+	}
+
+	// 2.the first column of the indexes, include the auto indexes of PRIMARY KEY/UNIQUE
+	UserIndexList userIndexList = getUserIndexes(userDbId, tblName, schema);
+	for (auto & userIndex : userIndexList) {
+		PragmaIndexColumns indexColumns = getPragmaIndexColumns(userDbId, userIndex.name);
+		auto iter = std::find_if(indexColumns.begin(), indexColumns.end(), [](const PragmaIndexColumn & indexColumn) {
+			return indexColumn.seqno == 0;
+		});
+		if (iter != indexColumns.end() && StringUtil::toupper((*iter).name) == upColumn) {
+			return true;
+		}
+	}
+	return false;
+}
+
 std::wstring TableService::getPrimaryKeyColumn(uint64_t userDbId, const std::wstring & tblName, Columns & columns, const std::wstring & schema)
 {
 	ATLASSERT(userDbId > 0 && !tblName.empty());
@@ -248,10 +533,63 @@ ForeignKeyList TableService::getForeignKeyList(uint64_t userDbId, const std::wst
 		return ForeignKeyList();
 	}
 
-	std::wstring & createTblSql = userTable.sql;
-	ForeignKeyList foreignKeyList = SqlUtil::parseForeignKeysByTableDDL(createTblSql);
+	return getDdlForeignKeys(userDbId, userTable, schema);
+}
+
+/**
+ * The DDL of table is parsed once and cached in the catalog of user db connect, 
+ * the catalog is cleared after the schema is changed.
+ */
+IndexInfo TableService::getDdlPrimaryKey(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema)
+{
+	if (!QCatalog::isCacheable(schema)) {
+		return SqlUtil::parseConstraintsForPrimaryKey(userTable.sql);
+	}
+	auto & ddlMap = getRepository()->getUserCatalog(userDbId).ddlPrimaryKeyMap;
+	auto iter = ddlMap.find(userTable.name);
+	if (iter != ddlMap.end()) {
+		return iter->second;
+	}
+	return ddlMap[userTable.name] = SqlUtil::parseConstraintsForPrimaryKey(userTable.sql);
+}
 
-	return foreignKeyList;
+ColumnInfoList TableService::getDdlColumns(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema)
+{
+	if (!QCatalog::isCacheable(schema)) {
+		return SqlUtil::parseColumnsByTableDDL(userTable.sql);
+	}
+	auto & ddlMap = getRepository()->getUserCatalog(userDbId).ddlColumnsMap;
+	auto iter = ddlMap.find(userTable.name);
+	if (iter != ddlMap.end()) {
+		return iter->second;
+	}
+	return ddlMap[userTable.name] = SqlUtil::parseColumnsByTableDDL(userTable.sql);
+}
+
+IndexInfoList TableService::getDdlConstraints(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema)
+{
+	if (!QCatalog::isCacheable(schema)) {
+		return SqlUtil::parseConstraints(userTable.sql);
+	}
+	auto & ddlMap = getRepository()->getUserCatalog(userDbId).ddlConstraintsMap;
+	auto iter = ddlMap.find(userTable.name);
+	if (iter != ddlMap.end()) {
+		return iter->second;
+	}
+	return ddlMap[userTable.name] = SqlUtil::parseConstraints(userTable.sql);
+}
+
+ForeignKeyList TableService::getDdlForeignKeys(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema)
+{
+	if (!QCatalog::isCacheable(schema)) {
+		return SqlUtil::parseForeignKeysByTableDDL(userTable.sql);
+	}
+	auto & ddlMap = getRepository()->getUserCatalog(userDbId).ddlForeignKeysMap;
+	auto iter = ddlMap.find(userTable.name);
+	if (iter != ddlMap.end()) {
+		return iter->second;
+	}
+	return ddlMap[userTable.name] = SqlUtil::parseForeignKeysByTableDDL(userTable.sql);
 }
 
 void TableService::renameTable(uint64_t userDbId, const std::wstring & oldTableName, const std::wstring & newTableName, const std::wstring & schema /*= std::wstring()*/)
@@ -23,6 +23,9 @@
 #include "core/repository/user/ColumnUserRepository.h"
 #include "core/repository/user/IndexUserRepository.h"
 
+// the SQLite instructions between two calls of the progress handler when copying table data
+#define TABLE_COPY_PROGRESS_OPS 10000
+
 class TableService : public BaseService<TableService, TableUserRepository>
 {
 public:
@@ -30,15 +33,31 @@ public:
 	~TableService();
 
 	uint64_t getTableDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
+	uint64_t getTableEstimatedDataCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
 	int getTableDataPageCount(uint64_t userDbId, const std::wstring & tblName, int perpage, const std::wstring & schema = std::wstring());
 	uint64_t getTableWhereDataCount(uint64_t userDbId, const std::wstring &  tblName, const std::wstring & whereClause, const std::wstring & schema = std::wstring());
 	int getTableWhereDataPageCount(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, int perpage, const std::wstring & schema = std::wstring());
 	DataList getTableDataList(uint64_t userDbId, const std::wstring & tblName, int page, int perpage, const std::wstring & schema = std::wstring());
 	DataList getTableWhereDataList(uint64_t userDbId, const std::wstring & tblName, const std::wstring & whereClause, int page, int perpage, const std::wstring & schema = std::wstring());
 	std::pair<Columns, DataList> getTableDataListWithColumns(uint64_t userDbId, const std::wstring & tblName, int page, int perpage, const std::wstring & schema = std::wstring());
+	// keyset pagination for walking the whole table
+	TableKeyset getTableKeyset(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
+	DataList getTableKeysetDataList(uint64_t userDbId, const std::wstring & tblName, TableKeyset & keyset, int perpage, const std::wstring & whereClause = std::wstring(), const std::wstring & schema = std::wstring());
 
 	bool isExistsTblName(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
 	bool execBySql(uint64_t userDbId, const std::wstring & sql);
+	int execBySqlWithProgress(uint64_t userDbId, const std::wstring & sql, int (*progressHandler)(void *) = nullptr, void * progressArg = nullptr);
+	// apply the changes of the rows in one transaction
+	uint64_t applyRowChanges(uint64_t userDbId, const std::wstring & tblName, RowChanges & rowChanges, 
+		RowChangeErrors & errors, const std::wstring & schema = std::wstring());
+	// the sql with parameters that applies the row change, for the sql log
+	std::wstring getRowChangeSql(const std::wstring & tblName, const RowChange & rowChange, const std::wstring & schema = std::wstring());
+
+	// copy table data by the attached database
+	void attachDatabase(uint64_t userDbId, const std::wstring & dbPath, const std::wstring & schema);
+	void detachDatabase(uint64_t userDbId, const std::wstring & schema);
+	int copyTableDataFromSchema(uint64_t userDbId, const std::wstring & targetTblName, const std::wstring & sourceSchema, 
+		const std::wstring & sourceTblName, const std::wstring & whereClause, int (*progressHandler)(void *) = nullptr, void * progressArg = nullptr);
 
 	// user table operations
 	UserTableList getUserTables(uint64_t userDbId);
@@ -56,6 +75,7 @@ public:
 	UserIndex getUserIndexByRowId(uint64_t userDbId, uint64_t rowId);
 	IndexInfoList getIndexInfoList(uint64_t userDbId, const std::wstring & tblName, const std::wstring & schema = std::wstring());
 	PragmaIndexColumns getPragmaIndexColumns(uint64_t userDbId, const std::wstring & indexName);
+	bool isOrderedByIndex(uint64_t userDbId, const std::wstring & tblName, const std::wstring & column, const std::wstring & schema = std::wstring());
 	
 	// get runtime user unique or index columns
 	std::wstring getPrimaryKeyColumn(uint64_t userDbId, const std::wstring & tblName, Columns & columns, const std::wstring & schema = std::wstring());
@@ -72,4 +92,9 @@ private:
 	ColumnUserRepository * columnUserRepository = ColumnUserRepository::getInstance();
 	IndexUserRepository * indexUserRepository = IndexUserRepository::getInstance();
 
+	// the parsed DDL of table, cached in the catalog of user db
+	IndexInfo getDdlPrimaryKey(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema);
+	ColumnInfoList getDdlColumns(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema);
+	IndexInfoList getDdlConstraints(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema);
+	ForeignKeyList getDdlForeignKeys(uint64_t userDbId, const UserTable & userTable, const std::wstring & schema);
 };
@@ -21,252 +21,283 @@
 #include "ExportResultService.h"
 #include <fstream>
 #include "utils/FileUtil.h"
+#include "utils/Utf8FileWriter.h"
 
-int ExportResultService::exportToCsv(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas, ExportCsvParams & csvParams)
+#define EXPORT_COLUMNS_PLACEHOLDER "{<!--columns-->}"
+#define EXPORT_DATAS_PLACEHOLDER "{<!--datas-->}"
+
+/**
+ * Export the rows of cursor to a CSV file, the rows are written to file one by one, 
+ * so the query cursor never holds the whole result in memory.
+ * 
+ * @param exportPath - Export path
+ * @param columns - The columns of query data
+ * @param selColumns - Select export columns
+ * @param cursor - The rows of query result, QResultSetCursor or QSqlStatementCursor
+ * @param csvParams - The csv params
+ * @return Export rows count
+ */
+int ExportResultService::exportToCsv(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor, ExportCsvParams & csvParams)
 {
 	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codeccvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
+	std::string fieldTerminatedBy = StringUtil::unicode2Utf8(csvParams.csvFieldTerminatedBy);
+	std::string fieldEnclosedBy = StringUtil::unicode2Utf8(csvParams.csvFieldEnclosedBy);
 
 	// 2.write the columns on the top
 	if (csvParams.hasColumnOnTop) {
 		int n = static_cast<int>(selColumns.size());
 		for (int i = 0; i < n; i++) {
-			auto & selColumn = selColumns.at(i);
 			if (i > 0) {
-				ofs << csvParams.csvFieldTerminatedBy;
+				writer.write(fieldTerminatedBy);
 			}
-			ofs << selColumn;
+			writer.write(selColumns.at(i));
 		}
-		//ofs << csvParams.csvLineTerminatedBy;
-		ofs << endl;
+		writer.writeLine();
 	}
 
 	// 3.write the data to file
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
 	int n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
-		}
+	uint32_t len = 0;
+	while (cursor.next()) {
 		int i = 0;
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
+		for (auto nItem : selIndexes) {
 			if (i > 0) {
-				ofs << csvParams.csvFieldTerminatedBy;
+				writer.write(fieldTerminatedBy);
 			}
-			ofs << csvParams.csvFieldEnclosedBy << vals.at(nItem) << csvParams.csvFieldEnclosedBy;
+			const char * val = cursor.getUtf8Text(nItem, len);
+			writer.write(fieldEnclosedBy);
+			writer.write(val, len);
+			writer.write(fieldEnclosedBy);
 			i++;
 		}
-		ofs << endl;
+		writer.writeLine();
 		n++;
 	}
-	ofs.flush();
-	ofs.close();
+	writer.close();
 
 	return n;
 }
 
-int ExportResultService::exportToJson(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas)
+int ExportResultService::exportToJson(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor)
 {
-	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty() && !datas.empty());
+	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codeccvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
+
+	// the prefix of each column, such as: \t\t"name":"
+	std::vector<std::string> keyPrefixes;
+	for (auto & selColumn : selColumns) {
+		std::string prefix("\t\t\"");
+		prefix.append(StringUtil::unicode2Utf8(selColumn)).append("\":\"");
+		keyPrefixes.push_back(prefix);
+	}
 
 	// 3.write the data to file
-	ofs << L'[' << endl;
+	writer.write('[');
+	writer.writeLine();
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
 	int n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
-		}
+	uint32_t len = 0;
+	while (cursor.next()) {
 		if (n > 0) {
-			ofs  << L',' << endl;
+			writer.write(',');
+			writer.writeLine();
 		}
-		ofs << L'\t' << L'{' << endl;
-		int i = 0;
+		writer.write("\t{", 2);
+		writer.writeLine();
+		int nCols = static_cast<int>(selIndexes.size());
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
+		for (int i = 0; i < nCols; i++) {
 			if (i > 0) {
-				ofs  << L',' << endl;
+				writer.write(',');
+				writer.writeLine();
 			}
-			std::wstring val = StringUtil::escape(vals.at(nItem));
-			ofs << L"\t\t\"" << selColumn << L"\":\"" << val << "\"";
-			i++;
+			const char * val = cursor.getUtf8Text(selIndexes.at(i), len);
+			writer.write(keyPrefixes.at(i));
+			writeJsonText(writer, val, len);
+			writer.write('"');
 		}
-		ofs << endl;
-		ofs << L'\t' << L'}';
+		writer.writeLine();
+		writer.write("\t}", 2);
 		n++;
 	}
-	ofs << endl << L']';
-	ofs.flush();
-	ofs.close();
+	writer.writeLine();
+	writer.write(']');
+	writer.close();
 
 	return n;
 }
 
-
-
-int ExportResultService::exportToHtml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas)
+int ExportResultService::exportToHtml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor)
 {
-	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty() && !datas.empty());
+	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	std::wstring tplHtml = readQueryResultHtmlTemplate();
+	// the template is split by the placeholders, the parts are written around the columns and the datas
+	std::string tplHtml = StringUtil::unicode2Utf8(readQueryResultHtmlTemplate());
+	size_t colPos = tplHtml.find(EXPORT_COLUMNS_PLACEHOLDER);
+	size_t colEnd = colPos == std::string::npos ? tplHtml.size() : colPos + strlen(EXPORT_COLUMNS_PLACEHOLDER);
+	size_t dataPos = tplHtml.find(EXPORT_DATAS_PLACEHOLDER, colEnd);
+	size_t dataEnd = dataPos == std::string::npos ? tplHtml.size() : dataPos + strlen(EXPORT_DATAS_PLACEHOLDER);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codecvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codecvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
 
 	// 2.write the columns on the top
-	
-	int n = static_cast<int>(selColumns.size());
-	std::wostringstream colHtml, dataHtml;
-	colHtml << L"<tr>" << endl;
-	for (int i = 0; i < n; i++) {
-		auto selColumn = selColumns.at(i);
-		colHtml << L"\t" << L"<td bgcolor=silver class='medium'>" << selColumn << L"</td>" << endl;
+	writer.write(tplHtml.data(), colPos == std::string::npos ? tplHtml.size() : colPos);
+	writer.write("<tr>");
+	writer.writeLine();
+	for (auto & selColumn : selColumns) {
+		writer.write("\t<td bgcolor=silver class='medium'>");
+		writer.write(selColumn);
+		writer.write("</td>");
+		writer.writeLine();
 	}
-	//ofs << csvParams.csvLineTerminatedBy;
-	colHtml << L"<tr>" << endl;
-	std::wstring result = StringUtil::replace(tplHtml, L"{<!--columns-->}", colHtml.str());
-	
+	writer.write("</tr>");
+	writer.writeLine();
+	writer.write(tplHtml.data() + colEnd, (dataPos == std::string::npos ? tplHtml.size() : dataPos) - colEnd);
 
 	// 3.write the data to file
-	n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
-		}
-		int i = 0;
-		dataHtml << L"<tr>" << endl;
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
+	int n = 0;
+	uint32_t len = 0;
+	while (cursor.next()) {
+		writer.write("<tr>");
+		writer.writeLine();
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
-			dataHtml << L"\t" << L"<td class='normal' valign='top'>" << vals.at(nItem) << L"</td>" << endl;
-			i++;
+		for (auto nItem : selIndexes) {
+			const char * val = cursor.getUtf8Text(nItem, len);
+			writer.write("\t<td class='normal' valign='top'>");
+			writer.write(val, len);
+			writer.write("</td>");
+			writer.writeLine();
 		}
-		dataHtml << L"<tr>" << endl;
+		writer.write("</tr>");
+		writer.writeLine();
 		n++;
 	}
-	result = StringUtil::replace(result, L"{<!--datas-->}", dataHtml.str());
-	ofs << result << endl;
-	ofs.flush();
-	ofs.close();
+	writer.write(tplHtml.data() + dataEnd, tplHtml.size() - dataEnd);
+	writer.writeLine();
+	writer.close();
 	return n;
 }
 
-int ExportResultService::exportToXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas)
+int ExportResultService::exportToXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor)
 {
-	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty() && !datas.empty());
+	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codecvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codecvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
+
+	// the open and close tags of each column
+	std::vector<std::string> openTags, closeTags;
+	for (auto & selColumn : selColumns) {
+		std::string name = StringUtil::unicode2Utf8(selColumn);
+		openTags.push_back(std::string("\t\t<").append(name).append(">"));
+		closeTags.push_back(std::string("</").append(name).append(">"));
+	}
 
 	// 3.write the data to file
-	ofs << L"<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << endl;
-	ofs << "<data>" << endl;
+	writer.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
+	writer.writeLine();
+	writer.write("<data>");
+	writer.writeLine();
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
 	int n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
-		}
-		
-		ofs << L"\t<row>" << endl;
-		int i = 0;
+	uint32_t len = 0;
+	int nCols = static_cast<int>(selIndexes.size());
+	while (cursor.next()) {
+		writer.write("\t<row>");
+		writer.writeLine();
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
-			
-			std::wstring val = StringUtil::escapeXml(vals.at(nItem));
-			ofs << L"\t\t<" << selColumn << L">" << val  << L"</" << selColumn << L">" << endl;
-			i++;
+		for (int i = 0; i < nCols; i++) {
+			const char * val = cursor.getUtf8Text(selIndexes.at(i), len);
+			writer.write(openTags.at(i));
+			writeXmlText(writer, val, len);
+			writer.write(closeTags.at(i));
+			writer.writeLine();
 		}
-		ofs << L"\t</row>" << endl;
+		writer.write("\t</row>");
+		writer.writeLine();
 		n++;
 	}
-	ofs << "</data>" << endl;
-	ofs.flush();
-	ofs.close();
+	writer.write("</data>");
+	writer.writeLine();
+	writer.close();
 
 	return n;
 }
 
-int ExportResultService::exportToExcelXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas, ExportExcelParams & excelParams)
+int ExportResultService::exportToExcelXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor, ExportExcelParams & excelParams)
 {
-	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty() && !datas.empty());
+	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	std::wstring tplHtml = readQueryResultXmlTemplate();
+	// the template is split by the placeholders, the parts are written around the columns and the datas
+	std::string tplXml = StringUtil::unicode2Utf8(readQueryResultXmlTemplate());
+	size_t colPos = tplXml.find(EXPORT_COLUMNS_PLACEHOLDER);
+	size_t colEnd = colPos == std::string::npos ? tplXml.size() : colPos + strlen(EXPORT_COLUMNS_PLACEHOLDER);
+	size_t dataPos = tplXml.find(EXPORT_DATAS_PLACEHOLDER, colEnd);
+	size_t dataEnd = dataPos == std::string::npos ? tplXml.size() : dataPos + strlen(EXPORT_DATAS_PLACEHOLDER);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codeccvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
 
-	// 2.write the columns on the top	
-	int n = static_cast<int>(selColumns.size());
-	std::wostringstream colXml, dataXml;
-	colXml << L"\t<ss:Row>" << endl;
-	for (int i = 0; i < n; i++) {
-		auto selColumn = selColumns.at(i);
-		colXml << L"\t\t" << L"<ss:Cell  ss:StyleID=\"s27\"><Data ss:Type=\"String\">" << selColumn << L"</Data></ss:Cell>" << endl;
+	// 2.write the columns on the top
+	writer.write(tplXml.data(), colPos == std::string::npos ? tplXml.size() : colPos);
+	writer.write("\t<ss:Row>");
+	writer.writeLine();
+	for (auto & selColumn : selColumns) {
+		writer.write("\t\t<ss:Cell  ss:StyleID=\"s27\"><Data ss:Type=\"String\">");
+		writer.write(selColumn);
+		writer.write("</Data></ss:Cell>");
+		writer.writeLine();
 	}
-	//ofs << csvParams.csvLineTerminatedBy;
-	colXml << L"\t</ss:Row>" << endl;
-	std::wstring result = StringUtil::replace(tplHtml, L"{<!--columns-->}", colXml.str());
-	
+	writer.write("\t</ss:Row>");
+	writer.writeLine();
+	writer.write(tplXml.data() + colEnd, (dataPos == std::string::npos ? tplXml.size() : dataPos) - colEnd);
 
 	// 3.write the data to file
-	n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
-		}
-		int i = 0;
-		dataXml << L"\t<ss:Row>" << endl;
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
+	int n = 0;
+	uint32_t len = 0;
+	while (cursor.next()) {
+		writer.write("\t<ss:Row>");
+		writer.writeLine();
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
-			std::wstring val = StringUtil::escapeXml(vals.at(nItem));
-			dataXml << L"\t\t" << L"<ss:Cell><Data ss:Type=\"String\">" << val << L"</Data></ss:Cell>" << endl;
-			i++;
+		for (auto nItem : selIndexes) {
+			const char * val = cursor.getUtf8Text(nItem, len);
+			writer.write("\t\t<ss:Cell><Data ss:Type=\"String\">");
+			writeXmlText(writer, val, len);
+			writer.write("</Data></ss:Cell>");
+			writer.writeLine();
 		}
-		dataXml << L"\t</ss:Row>" << endl;
+		writer.write("\t</ss:Row>");
+		writer.writeLine();
 		n++;
 	}
-	result = StringUtil::replace(result, L"{<!--datas-->}", dataXml.str());
-	ofs << result << endl;
-	ofs.flush();
-	ofs.close();
+	writer.write(tplXml.data() + dataEnd, tplXml.size() - dataEnd);
+	writer.writeLine();
+	writer.close();
 	return n;
 }
 
@@ -277,7 +308,7 @@ int ExportResultService::exportToExcelXml(std::wstring & exportPath, Columns & c
  * @param tbl - Query table
  * @param columns - The columns of query data
  * @param selColumns - Select export columns 
- * @param datas - The query result data
+ * @param cursor - The rows of query result, QResultSetCursor or QSqlStatementCursor
  * @param sqlarams - The Sql Settings params 
  * @return Export rows count 
  */
@@ -285,69 +316,66 @@ int ExportResultService::exportToSql(std::wstring & exportPath,
 		UserTable & tbl, 
 		Columns & columns, 
 		ExportSelectedColumns & selColumns, 
-		DataList & datas, 
+		QResultCursor & cursor, 
 		ExportSqlParams & sqlarams)
 {
 	ATLASSERT(!exportPath.empty() && !columns.empty() && !selColumns.empty());
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	// 1. create and open the ouput fstream	
-	std::wofstream ofs;
-	auto codecvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codecvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
+	// 1. create and open the ouput file
+	Utf8FileWriter writer;
+	writer.open(exportPath);
 
 	std::wstring tplSql = readQueryResultSqlTemplate();
-	ofs << tplSql << endl;
+	writer.write(tplSql);
+	writer.writeLine();
 
 	// 2.write the structure sql	
-	int n = static_cast<int>(selColumns.size());
 	if (sqlarams.sqlSetting == L"structure-only" || sqlarams.sqlSetting == L"structure-and-data") {
-		ofs << tbl.sql << L";" << endl;
+		writer.write(tbl.sql);
+		writer.write(';');
+		writer.writeLine();
 	}
 	
 	if (sqlarams.sqlSetting == L"structure-only") {
-		ofs.flush();
-		ofs.close();
+		writer.close();
 		return 0;
 	}
 	
-	// 3.write the data to file
-	n = 0;
-	for (auto vals : datas) {
-		if (vals.empty()) {
-			continue;
+	// 3.write the data to file, the "INSERT INTO tbl (columns) VALUES (" prefix is same for all the rows
+	std::wstring insertPrefix(L"INSERT INTO \"");
+	insertPrefix.append(tbl.name).append(L"\" (");
+	int nCols = static_cast<int>(selColumns.size());
+	for (int i = 0; i < nCols; i++) {
+		if (i > 0) {
+			insertPrefix.append(L", ");
 		}
-		int i = 0;
-		std::wostringstream dataSql, columnStmt, valuesStmt;
-		dataSql << L"INSERT INTO \"" << tbl.name << L"\" ";
+		insertPrefix.append(L"\"").append(selColumns.at(i)).append(L"\"");
+	}
+	insertPrefix.append(L") VALUES (");
+	std::string insertPrefixUtf8 = StringUtil::unicode2Utf8(insertPrefix);
 
-		columnStmt << L"(";
-		valuesStmt << L" VALUES (";
+	std::vector<int> selIndexes = getColumnIndexes(columns, selColumns);
+	int n = 0;
+	uint32_t len = 0;
+	while (cursor.next()) {
+		writer.write(insertPrefixUtf8);
 		// write the selected column data value
-		for (auto selColumn : selColumns) {
-			int nItem = getColumnIndex(columns, selColumn);
-			std::wstring val = StringUtil::escapeSql(vals.at(nItem));
-
+		for (int i = 0; i < nCols; i++) {
 			if (i > 0) {
-				columnStmt << L", ";
-				valuesStmt <<  L", ";
+				writer.write(", ", 2);
 			}
-			columnStmt << L"\"" << selColumn << "\"";
-			valuesStmt << L"'" << val <<  L"'";
-			i++;
+			const char * val = cursor.getUtf8Text(selIndexes.at(i), len);
+			writer.write('\'');
+			writeSqlText(writer, val, len);
+			writer.write('\'');
 		}
-		columnStmt <<  L')';
-		valuesStmt << L')';
-		dataSql << columnStmt.str() << valuesStmt.str() << L';';
-		ofs << dataSql.str() << endl;
+		writer.write(");", 2);
+		writer.writeLine();
 		n++;
 	}
-	
-	ofs.flush();
-	ofs.close();
+	writer.close();
 	return n;
 }
 
@@ -371,6 +399,84 @@ int ExportResultService::getColumnIndex(Columns & columns, std::wstring & column
 	return -1;
 }
 
+/**
+ * Get the indexes of the selected columns in the vector of Columns, resolved once before writing the rows.
+ * 
+ * @param columns The vector of Columns
+ * @param selColumns The selected columns
+ * @return indexes
+ */
+std::vector<int> ExportResultService::getColumnIndexes(Columns & columns, ExportSelectedColumns & selColumns)
+{
+	std::vector<int> result;
+	for (auto & selColumn : selColumns) {
+		result.push_back(getColumnIndex(columns, selColumn));
+	}
+	return result;
+}
+
+/**
+ * Write the text as the JSON string value, the \ " \r \n chars are escaped.
+ * 
+ * @param writer - The file writer
+ * @param text - The UTF-8 text
+ * @param len - The bytes of text
+ */
+void ExportResultService::writeJsonText(Utf8FileWriter & writer, const char * text, uint32_t len)
+{
+	uint32_t begin = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		const char * escaped = nullptr;
+		switch (text[i]) {
+		case '\\': escaped = "\\\\"; break;
+		case '"': escaped = "\\\""; break;
+		case '\r': escaped = "\\r"; break;
+		case '\n': escaped = "\\n"; break;
+		default: continue;
+		}
+		writer.write(text + begin, i - begin);
+		writer.write(escaped, 2);
+		begin = i + 1;
+	}
+	writer.write(text + begin, len - begin);
+}
+
+/**
+ * Write the text as the XML element value, the text is wrapped by CDATA if it has < > [ ] \r \n chars.
+ */
+void ExportResultService::writeXmlText(Utf8FileWriter & writer, const char * text, uint32_t len)
+{
+	bool isCdata = false;
+	for (uint32_t i = 0; i < len && !isCdata; i++) {
+		char ch = text[i];
+		isCdata = ch == '<' || ch == '>' || ch == '\r' || ch == '\n' || ch == '[' || ch == ']';
+	}
+	if (isCdata) {
+		writer.write("<![CDATA[", 9);
+	}
+	writer.write(text, len);
+	if (isCdata) {
+		writer.write("]]>", 3);
+	}
+}
+
+/**
+ * Write the text as the SQL string value, the ' char is escaped as ''.
+ */
+void ExportResultService::writeSqlText(Utf8FileWriter & writer, const char * text, uint32_t len)
+{
+	uint32_t begin = 0;
+	for (uint32_t i = 0; i < len; i++) {
+		if (text[i] != '\'') {
+			continue;
+		}
+		writer.write(text + begin, i - begin + 1);
+		writer.write('\'');
+		begin = i + 1;
+	}
+	writer.write(text + begin, len - begin);
+}
+
 /**
  * Change the file extend name of export path.
  * 
@@ -21,6 +21,8 @@
 #include "core/common/service/BaseService.h"
 #include "core/repository/db/UserDbRepository.h"
 #include "core/entity/Entity.h"
+#include "core/common/repository/QResultCursor.h"
+#include "utils/Utf8FileWriter.h"
 
 class ExportResultService : public BaseService<ExportResultService, UserDbRepository>
 {
@@ -28,25 +30,28 @@ public:
 	ExportResultService() {};
 	~ExportResultService() {};
 
-	// do export operation
-	int exportToCsv(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas, ExportCsvParams & csvParams);
-	int exportToJson2(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas);
-	int exportToJson(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas);
-	int exportToHtml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas);
-	int exportToXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas);
-	int exportToExcelXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, DataList & datas,ExportExcelParams & excelParams);
+	// do export operation, the rows are read from the cursor and written to file one by one
+	int exportToCsv(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor, ExportCsvParams & csvParams);
+	int exportToJson(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor);
+	int exportToHtml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor);
+	int exportToXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor);
+	int exportToExcelXml(std::wstring & exportPath, Columns & columns, ExportSelectedColumns & selColumns, QResultCursor & cursor, ExportExcelParams & excelParams);
 	int exportToSql(std::wstring & exportPath, 
 		UserTable & tbl, 
 		Columns & columns, 
 		ExportSelectedColumns & selColumns, 
-		DataList & datas,
+		QResultCursor & cursor,
 		ExportSqlParams & sqlarams);
 
 	std::wstring & changeExportPathExt(std::wstring & exportPath, const wchar_t * ext);
 	
 private:
 	int getColumnIndex(Columns & columns, std::wstring & columnName);
+	std::vector<int> getColumnIndexes(Columns & columns, ExportSelectedColumns & selColumns);
 	std::wstring escapeLineTerminaled(std::wstring & lineTernimal);
+	void writeJsonText(Utf8FileWriter & writer, const char * text, uint32_t len);
+	void writeXmlText(Utf8FileWriter & writer, const char * text, uint32_t len);
+	void writeSqlText(Utf8FileWriter & writer, const char * text, uint32_t len);
 	std::wstring readQueryResultHtmlTemplate();
 	std::wstring readQueryResultXmlTemplate();
 	std::wstring readQueryResultSqlTemplate();
@@ -25,6 +25,35 @@ uint64_t SqlLogService::createSqlLog(SqlLog & sqlLog)
 	return getRepository()->create(sqlLog);
 }
 
+void SqlLogService::postSqlLog(const SqlLog & sqlLog)
+{
+	if (!startSqlLogWriter()) {
+		return;
+	}
+	sqlLogWriter.post(SqlLog(sqlLog));
+}
+
+void SqlLogService::stopSqlLogWriter()
+{
+	sqlLogWriter.stop();
+}
+
+bool SqlLogService::startSqlLogWriter()
+{
+	if (sqlLogWriter.isRunning()) {
+		return true;
+	}
+	try {
+		// the writer connect can't create the table in its transaction of inserting
+		getRepository()->initBodyTable();
+	} catch (QRuntimeException &ex) {
+		Q_ERROR(L"start sql log writer has error, code:{}, msg:{}", ex.getCode(), ex.getMsg());
+		return false;
+	}
+	sqlLogWriter.start(getRepository()->getSysConnect()->getDatabaseName());
+	return true;
+}
+
 void SqlLogService::clearOldSqlLog()
 {
 	uint64_t totalNums = getRepository()->getCount();
@@ -22,6 +22,7 @@
 #include "core/entity/Entity.h"
 #include "core/common/service/BaseService.h"
 #include "core/repository/sqllog/SqlLogRepository.h"
+#include "core/repository/sqllog/SqlLogWriter.h"
 
 class SqlLogService : public BaseService<SqlLogService, SqlLogRepository>
 {
@@ -30,6 +31,9 @@ public:
 	~SqlLogService() {};
 
 	uint64_t createSqlLog(SqlLog & sqlLog);
+	// Queue the sql log to the writer thread without waiting, use createSqlLog if the id is needed
+	void postSqlLog(const SqlLog & sqlLog);
+	void stopSqlLogWriter();
 	void clearOldSqlLog();
 	std::vector<std::wstring> getDatesFromList(const SqlLogList &list);
 
@@ -46,5 +50,9 @@ public:
 	SqlLogList getPageSqlLogByKeyword(const std::wstring & keyword, int page, int perPage);
 	uint64_t getSqlLogCountByKeyword(const std::wstring & keyword);
 	SqlLog getSqlLog(uint64_t sqlLogId);
+private:
+	SqlLogWriter sqlLogWriter;
+
+	bool startSqlLogWriter();
 };
 
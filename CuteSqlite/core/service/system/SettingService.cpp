@@ -83,7 +83,7 @@ Setting SettingService::getAllSysSetting(bool isReload)
  * @param isReload Ƿ¼
  * @return з<group, Setting>
  */
-IniSetting SettingService::getAllIniSetting(bool isReload)
+const IniSetting & SettingService::getAllIniSetting(bool isReload)
 {
 	if (!isReload && iniSetting.empty() == false) {
 		return iniSetting;
@@ -122,24 +122,17 @@ IniSetting SettingService::getAllIniSetting(bool isReload)
  */
 Setting SettingService::getAllGenderSetting()
 {
-	Setting genders;
-	IniSetting settings = getAllIniSetting();
-	if (settings.empty()) {
-		return genders;
-	}
-	genders = settings[L"GENDER"];
-	return genders;
+	return getSettingBySection(L"GENDER");
 }
 
 Setting SettingService::getSettingBySection(const std::wstring & section)
 {
-	Setting sectionSetting;
-	IniSetting settings = getAllIniSetting();
-	if (settings.empty()) {
-		return sectionSetting;
+	const IniSetting & settings = getAllIniSetting();
+	auto iterator = settings.find(section);
+	if (iterator == settings.end()) {
+		return Setting();
 	}
-	sectionSetting = settings[section];
-	return sectionSetting;
+	return iterator->second;
 }
 
 /**
@@ -36,7 +36,7 @@ public:
 	
 	//--------------ini---------------------------------------------------
 	// ȡiniзԼ<group, Setting>
-	IniSetting getAllIniSetting(bool isReload = false);
+	const IniSetting & getAllIniSetting(bool isReload = false);
 	// iniļֵ key=val
 	std::wstring getGenderIniVal(const std::wstring & key);
 	// ҳͼƬ,<first-ͼ·,twice-ͼƬ·>
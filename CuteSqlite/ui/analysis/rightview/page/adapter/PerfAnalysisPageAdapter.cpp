@@ -53,12 +53,13 @@ void PerfAnalysisPageAdapter::initSupplier()
 		ExplainQueryPlans expQueryPlans = selectSqlAnalysisService->explainQueryPlanSql(supplier->getSqlLog().userDbId, supplier->getSqlLog().sql);
 		supplier->setExplainQueryPlans(expQueryPlans);
 
-		// 3. Convert explain data list to ByteCodeResults
-		ByteCodeResults results = selectSqlAnalysisService->explainReadByteCodeToResults(supplier->getRuntimeUserDbId(), explainDatas, supplier->getSqlLog().sql);
+		// 3. Decode explain data list once, then convert it to ByteCodeResults
+		ByteCodeProgram program(explainDatas);
+		ByteCodeResults results = selectSqlAnalysisService->explainReadByteCodeToResults(supplier->getRuntimeUserDbId(), program, supplier->getSqlLog().sql);
 		supplier->setByteCodeResults(results);
 
-		// 4.Convert explain data list to SelectColumns
-		SelectColumns selectColumns = selectSqlAnalysisService->explainReadByteCodeToSelectColumns(supplier->getRuntimeUserDbId(), explainDatas, supplier->getSqlLog().sql);
+		// 4.Convert explain program to SelectColumns
+		SelectColumns selectColumns = selectSqlAnalysisService->explainReadByteCodeToSelectColumns(supplier->getRuntimeUserDbId(), program, supplier->getSqlLog().sql);
 		supplier->setSelectColumns(selectColumns);
 
 		// 5.Check the report has exists in the perf_analysis_report table, if exists then assign to supplier::isDirty = false, otherwise supplier::isDirty = true
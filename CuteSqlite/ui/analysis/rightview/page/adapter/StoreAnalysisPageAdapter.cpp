@@ -35,7 +35,7 @@ StoreAnalysisPageAdapter::StoreAnalysisPageAdapter(HWND parentHwnd, CWindow * vi
 
 StoreAnalysisPageAdapter::~StoreAnalysisPageAdapter()
 {
-	storeAnalysisService->clearCache(supplier->getRuntimeUserDbId());
+	// the cache of store analysis is kept until the database is changed, reopening the page is instant
 }
 
 /**
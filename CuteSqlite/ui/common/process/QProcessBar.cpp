@@ -24,10 +24,17 @@ void QProcessBar::error(const std::wstring & err)
 	Invalidate(true);
 }
 
+void QProcessBar::setText(const std::wstring & text)
+{
+	this->text = text;
+	Invalidate(true);
+}
+
 void QProcessBar::reset()
 {
 	this->percent = 0;
 	this->err.clear();
+	this->text.clear();
 	Invalidate(true);
 }
 
@@ -105,11 +112,15 @@ LRESULT QProcessBar::OnPaint(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHan
 
 	std::wstring text = std::to_wstring(percent);
 	text.append(L"%");
+	if (!this->text.empty()) {
+		text.append(L"  ").append(this->text);
+	}
 
 	UINT uFormat = DT_CENTER | DT_VCENTER | DT_END_ELLIPSIS;
 	HFONT oldFont = mdc.SelectFont(textFont);
 	HPEN oldPen = mdc.SelectPen(textPen);
-	x = (clientRect.Width() - 80) / 2, y = rect.top + 2, w = 80, h = 20;
+	w = this->text.empty() ? 80 : 240;
+	x = (clientRect.Width() - w) / 2, y = rect.top + 2, h = 20;
 	CRect textRect(x, y, x + w, y + h);
 	COLORREF oldTextColor = mdc.SetTextColor(textColor);
 	COLORREF textBkColor = err.empty() ? processColor : errorColor;
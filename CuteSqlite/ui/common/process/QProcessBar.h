@@ -22,12 +22,15 @@ public:
 	~QProcessBar();
 	void run(int percent);
 	void error(const std::wstring & err);
+	// the text shown after the percent, such as the speed
+	void setText(const std::wstring & text);
 	void reset();
 
 	void setColors(COLORREF bkgColor, COLORREF processColor);
 private:
 	int percent = 0;
 	std::wstring err;
+	std::wstring text;
 
 	COLORREF bkgColor =  RGB(192, 192, 192);
 	CBrush bkgBrush;
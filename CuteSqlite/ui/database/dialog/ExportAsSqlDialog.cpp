@@ -705,8 +705,12 @@ void ExportAsSqlDialog::OnClickYesButton(UINT uNotifyCode, int nID, HWND hwnd)
 	}
 
 	// Export objects(tables/views/triggers) to sql file
-	adapter->exportObjectsToSql(userDbId, exportPath, tblList, viewList, triggerList, 
-		structAndDataParams, insertStatementParams, tblStatementParams);
+	if (!adapter->exportObjectsToSql(userDbId, exportPath, tblList, viewList, triggerList, 
+		structAndDataParams, insertStatementParams, tblStatementParams)) {
+		isRunning = false;
+		yesButton.EnableWindow(TRUE);
+		return ;
+	}
 
 	// save the settings to sys_init table
 	saveExportStructureAndDataSettings(structAndDataParams);
@@ -19,6 +19,7 @@
  *********************************************************************/
 #include "stdafx.h"
 #include "ImportFromCsvDialog.h"
+#include <algorithm>
 #include "common/AppContext.h"
 #include "utils/FontUtil.h"
 #include "ui/common/message/QPopAnimate.h"
@@ -355,6 +356,12 @@ void ImportFromCsvDialog::loadCsvSettingsElems()
 		QWinCreater::loadComboBox(csvCharsetComboBox, QSupplier::csvEncodings, 2, val);
 		supplier->csvCharset = val;
 	}
+
+	// the rows of one transaction, no element for it, can be changed in the sys init
+	std::wstring batchRows = settingService->getSysInit(L"csv-import-batch-rows");
+	if (!batchRows.empty() && batchRows.size() <= 9 && std::all_of(batchRows.begin(), batchRows.end(), ::iswdigit)) {
+		supplier->csvImportBatchRows = std::stoi(batchRows);
+	}
 }
 
 void ImportFromCsvDialog::saveImportSettings()
@@ -437,6 +444,8 @@ LRESULT ImportFromCsvDialog::OnDestroy(UINT uMsg, WPARAM wParam, LPARAM lParam,
 	QDialog::OnDestroy(uMsg, wParam, lParam, bHandled);
 
 	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_IMPORT_PROCESS_ID);
+	// the window is closed when importing, stop the import
+	adapter->cancelImport();
 
 	if (!linePen.IsNull()) linePen.DeleteObject();
 	if (elemFont) ::DeleteObject(elemFont);
@@ -689,28 +698,27 @@ void ImportFromCsvDialog::OnClickYesButton(UINT uNotifyCode, int nID, HWND hwnd)
 		return ;
 	}
 
+	if (isRunning) {
+		return ;
+	}
 	isRunning = true;
 	yesButton.EnableWindow(false);
+	processBar.setText(L"");
+	processBar.run(0);
 
-	// Export objects(tables/views/triggers) to sql file
-	if (!adapter->importFromRuntimeSqlList()) {
+	// Import the csv rows to the table in the worker thread, the result is handled in OnProcessImport
+	if (!adapter->importFromCsv(m_hWnd, importPath)) {
+		isRunning = false;
 		yesButton.EnableWindow(true);
-		return ;
 	}
-
-	QPopAnimate::success(S(L"import-success-text"));		
-	noButton.SetWindowText(S(L"complete").c_str());
-	yesButton.EnableWindow(true);
-
-	AppContext::getInstance()->dispatch(Config::MSG_REFRESH_SAME_TABLE_DATA_ID, WPARAM(supplier->getRuntimeUserDbId()), LPARAM(&supplier->getRuntimeTblName()));
 }
 
 /**
  * Handle the message for export process.
  * 
  * @param uMsg - Config::MSG_IMPORT_DB_FROM_SQL_PROCESS_ID
- * @param wParam - 0 : Import in progress, 1:Import is complete 2:Import has error(s)
- * @param lParam - Percent of export progress
+ * @param wParam - 0 : Import in progress, 1:Import is complete 2:Import has error(s) 4:The speed of import
+ * @param lParam - Percent of the bytes inserted, the row of error if wParam is 2, or the rows per second if wParam is 4
  * @param bHandled - not use
  * @return 0
  */
@@ -722,16 +730,25 @@ LRESULT ImportFromCsvDialog::OnProcessImport(UINT uMsg, WPARAM wParam, LPARAM lP
 		AppContext * appContext = AppContext::getInstance();
 		processBar.run(100);
 		isRunning = false;
+		QPopAnimate::success(S(L"import-success-text"));
+		noButton.SetWindowText(S(L"complete").c_str());
+		yesButton.EnableWindow(true);
+		appContext->dispatch(Config::MSG_REFRESH_SAME_TABLE_DATA_ID, WPARAM(supplier->getRuntimeUserDbId()), LPARAM(&supplier->getRuntimeTblName()));
 	} else if (wParam == 0) { 
 		// 
 		int percent = static_cast<int>(lParam);
 		processBar.run(percent);
 	} else if (wParam == 2) {
 		processBar.error(S(L"import-error-text"));
+		adapter->reportImportError();
 		isRunning = false;
+		yesButton.EnableWindow(true);
 	} else if (wParam == 3) {
 		processBar.error(S(L"import-error-text"));
 		isRunning = false;
+		yesButton.EnableWindow(true);
+	} else if (wParam == 4) {
+		processBar.setText(std::to_wstring(lParam).append(L" rows/s"));
 	}
 	return 0;
 }
@@ -231,8 +231,6 @@ LRESULT ImportFromSqlDialog::OnInitDialog(UINT uMsg, WPARAM wParam, LPARAM lPara
 	linePen.CreatePen(PS_SOLID, 1, lineColor);
 	elemFont = FT(L"elem-size");
 
-	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_IMPORT_PROCESS_ID);
-
 	QDialog::OnInitDialog(uMsg, wParam, lParam, bHandled); 
 	return 0;
 }
@@ -241,7 +239,8 @@ LRESULT ImportFromSqlDialog::OnDestroy(UINT uMsg, WPARAM wParam, LPARAM lParam,
 {
 	QDialog::OnDestroy(uMsg, wParam, lParam, bHandled);
 
-	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_IMPORT_PROCESS_ID);
+	// the window is closed when importing, stop the import
+	adapter->cancelImport();
 
 	if (!linePen.IsNull()) linePen.DeleteObject();
 	if (elemFont) ::DeleteObject(elemFont);
@@ -344,26 +343,27 @@ void ImportFromSqlDialog::OnClickYesButton(UINT uNotifyCode, int nID, HWND hwnd)
 		return ;
 	}
 
+	if (isRunning) {
+		return ;
+	}
 	isRunning = true;
 	yesButton.EnableWindow(false);
+	processBar.setText(L"");
+	processBar.run(0);
 
-	// Export objects(tables/views/triggers) to sql file
-	if (adapter->importFromSql(userDbId, importPath)) {
-		QPopAnimate::success(S(L"import-success-text"));
+	// Import the statements of sql file in the worker thread, the result is handled in OnProcessImport
+	if (!adapter->importFromSql(m_hWnd, userDbId, importPath)) {
+		isRunning = false;
 		yesButton.EnableWindow(true);
-		noButton.SetWindowText(S(L"complete").c_str());
-		return ;
 	}
-
-	yesButton.EnableWindow(true);
 }
 
 /**
  * Handle the message for export process.
  * 
  * @param uMsg - Config::MSG_IMPORT_DB_FROM_SQL_PROCESS_ID
- * @param wParam - 0 : Import in progress, 1:Import is complete 2:Import has error(s)
- * @param lParam - Percent of export progress
+ * @param wParam - 0 : Import in progress, 1:Import is complete 2:Import has error(s) 4:The speed of import
+ * @param lParam - Percent of the bytes executed, the line of error statement if wParam is 2, or the statements per second if wParam is 4
  * @param bHandled - not use
  * @return 0
  */
@@ -375,16 +375,24 @@ LRESULT ImportFromSqlDialog::OnProcessImport(UINT uMsg, WPARAM wParam, LPARAM lP
 		AppContext * appContext = AppContext::getInstance();
 		processBar.run(100);
 		isRunning = false;
+		QPopAnimate::success(S(L"import-success-text"));
+		noButton.SetWindowText(S(L"complete").c_str());
+		yesButton.EnableWindow(true);
 	} else if (wParam == 0) { 
 		// 
 		int percent = static_cast<int>(lParam);
 		processBar.run(percent);
 	} else if (wParam == 2) {
-		QPopAnimate::error(m_hWnd, S(L"import-from-sql-error-text"));
+		processBar.error(S(L"import-error-text"));
+		adapter->reportImportError();
 		isRunning = false;
+		yesButton.EnableWindow(true);
 	} else if (wParam == 3) {
 		QPopAnimate::error(m_hWnd, S(L"file-not-found"));
 		isRunning = false;
+		yesButton.EnableWindow(true);
+	} else if (wParam == 4) {
+		processBar.setText(std::to_wstring(lParam).append(L" stmts/s"));
 	}
 	return 0;
 }
@@ -24,6 +24,8 @@
 #include "common/AppContext.h"
 #include "core/common/Lang.h"
 #include "core/common/exception/QRuntimeException.h"
+#include "core/common/exception/QSqlExecuteException.h"
+#include "core/common/repository/QSqlDumper.h"
 #include "ui/common/message/QPopAnimate.h"
 #include "ui/common/message/QMessageBox.h"
 
@@ -61,7 +63,7 @@ uint64_t ExportDatabaseAdapter::getSeletedUserDbId()
 }
 
 
-void ExportDatabaseAdapter::exportObjectsToSql(uint64_t userDbId, 
+bool ExportDatabaseAdapter::exportObjectsToSql(uint64_t userDbId, 
 	std::wstring & exportPath, 
 	UserTableList & tblList, 
 	UserViewList & viewList, 
@@ -76,37 +78,48 @@ void ExportDatabaseAdapter::exportObjectsToSql(uint64_t userDbId,
 	std::wstring dirPath = FileUtil::getFileDir(exportPath);
 	FileUtil::createDirectory(dirPath);
 
-	// 1. create and open the output fstream	
-	std::wofstream ofs;
-	auto codecvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codecvt);
-	ofs.imbue(utf8);
-	ofs.open(exportPath, std::ios::out | std::ios::trunc);
-
-	ofs << L"--" << endl;
-	ofs << L"PRAGMA foreign_keys=OFF;" << endl;
-	ofs << L"BEGIN;" << endl;
-
-	// 2.Export tables/views/triggers to sql
-	int percent = 0;
-	exportTablesToSql(userDbId, ofs, tblList, structureAndDataParams, insertStatementParams, tblStatementParams, percent);
-	exportViewsToSql(userDbId, ofs, viewList, tblStatementParams, percent);
-	exportTriggersToSql(userDbId, ofs, triggerList, tblStatementParams,  percent);
-
-
-	ofs << L"COMMIT;" << endl;
-	ofs.flush();
-	ofs.close();
+	try {
+		// 1. create and open the output file with UTF-8 BOM
+		Utf8FileWriter writer;
+		writer.open(exportPath);
+
+		writer.write("--");
+		writer.writeLine();
+		writer.write("PRAGMA foreign_keys=OFF;");
+		writer.writeLine();
+		writer.write("BEGIN;");
+		writer.writeLine();
+
+		// 2.Export tables/views/triggers to sql
+		int percent = 0;
+		exportTablesToSql(userDbId, writer, tblList, structureAndDataParams, insertStatementParams, tblStatementParams, percent);
+		exportViewsToSql(userDbId, writer, viewList, tblStatementParams, percent);
+		exportTriggersToSql(userDbId, writer, triggerList, tblStatementParams,  percent);
+
+		writer.write("COMMIT;");
+		writer.writeLine();
+		writer.close();
+	} catch (QSqlExecuteException &ex) {
+		QPopAnimate::report(ex);
+		AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 2, NULL);
+		return false;
+	} catch (QRuntimeException &ex) {
+		QPopAnimate::report(ex);
+		AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 2, NULL);
+		return false;
+	}
 
 	// 3. complete the expert task and send message MSG_EXPORT_DB_AS_SQL_PROCESS_ID to dialog with wParam=1
 	AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 1, 100); // 
+	return true;
 }
 
 /**
- * Export database tables as sql to sql file in append mode
+ * Export database tables as sql to sql file in append mode, the rows of tables are dumped by QSqlDumper
+ * in parallel from one snapshot, and written as typed literals in the order of tables.
  * 
  * @param userDbId
- * @param exportPath
+ * @param writer
  * @param tblList
  * @param structureAndDataParams
  * @param insertStatementParams
@@ -114,7 +127,7 @@ void ExportDatabaseAdapter::exportObjectsToSql(uint64_t userDbId,
  * @return 
  */
 int ExportDatabaseAdapter::exportTablesToSql(uint64_t userDbId, 
-	std::wofstream & ofs, 
+	Utf8FileWriter & writer, 
 	UserTableList & tblList, 
 	StructAndDataParams & structureAndDataParams, 
 	InsertStatementParams & insertStatementParams, 
@@ -126,26 +139,33 @@ int ExportDatabaseAdapter::exportTablesToSql(uint64_t userDbId,
 		AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 0, percent); // 
 		return 0;
 	}
-	// 1.create table and export table data
-	int n = 0;
-	// 90% ֳN
-	int avgVal = int(round( 80.0 / double(tblList.size())));
-	for (auto userTable : tblList) {
-		doExportCreateTableStructure(ofs, userDbId, userTable, structureAndDataParams, tblStatementParams);
-		doExportCreateIndex(ofs, userDbId, userTable, structureAndDataParams, tblStatementParams);
-		doExportTableInsertStatement(ofs, userDbId, userTable, structureAndDataParams, insertStatementParams);
-
-		percent += avgVal;
-		AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 0, percent); // 
-		n++;
+	// 1.create table and create index statements are written before the rows of each table
+	QSqlDumpTables dumpTables;
+	for (auto & userTable : tblList) {
+		QSqlDumpTable dumpTable;
+		dumpTable.name = userTable.name;
+		dumpTable.withData = structureAndDataParams.sqlSetting != L"structure-only";
+		doExportCreateTableStructure(dumpTable.prologue, userDbId, userTable, structureAndDataParams, tblStatementParams);
+		doExportCreateIndex(dumpTable.prologue, userDbId, userTable, structureAndDataParams, tblStatementParams);
+		dumpTables.push_back(dumpTable);
 	}
+
+	// 2.export table data, 80% of progress is divided by the tables
+	QSqlDumpOptions options;
+	options.retainColumn = insertStatementParams.retainColumn;
+	options.multiRows = insertStatementParams.multiRows;
+	options.rowsPerInsert = EXPERT_PER_PAGE;
+	UserDb userDb = databaseService->getUserDb(userDbId);
+	QSqlDumper dumper(userDb.path, options);
+	dumper.dump(writer, dumpTables, &ExportDatabaseAdapter::exportTablesProgressHandler, &percent);
+	int n = static_cast<int>(dumpTables.size());
 	percent = 80;
 	AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 0, percent); // 
 	
 	return n;
 }
 
-void ExportDatabaseAdapter::exportViewsToSql(uint64_t userDbId, std::wofstream & ofs, UserViewList & viewList, 
+void ExportDatabaseAdapter::exportViewsToSql(uint64_t userDbId, Utf8FileWriter & writer, UserViewList & viewList, 
 	TblStatementParams & tblStatementParams, int & percent)
 {
 	if (viewList.empty()) {
@@ -159,12 +179,12 @@ void ExportDatabaseAdapter::exportViewsToSql(uint64_t userDbId, std::wofstream &
 	int avgVal = int(round( 10.0 / double(viewList.size())));
 	for (auto userView : viewList) {
 		if (tblStatementParams.param == L"override-table") {
-			ofs << L"DROP VIEW IF EXISTS \"" << userView.name << L"\";" << endl;	
-			ofs << userView.sql << L";" << endl;
+			writer.write(L"DROP VIEW IF EXISTS \"" + userView.name + L"\";\r\n");
+			writer.write(userView.sql + L";\r\n");
 		} else if (tblStatementParams.param == L"retain-table"){
 			std::wstring sql = userView.sql;
 			replaceCreateViewClause(sql);
-			ofs << sql << L";" << endl;
+			writer.write(sql + L";\r\n");
 		}
 
 		percent += avgVal;
@@ -175,7 +195,7 @@ void ExportDatabaseAdapter::exportViewsToSql(uint64_t userDbId, std::wofstream &
 	AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 0, percent); // 
 }
 
-void ExportDatabaseAdapter::exportTriggersToSql(uint64_t userDbId, std::wofstream & ofs, UserTriggerList & triggerList, TblStatementParams & tblStatementParams, 
+void ExportDatabaseAdapter::exportTriggersToSql(uint64_t userDbId, Utf8FileWriter & writer, UserTriggerList & triggerList, TblStatementParams & tblStatementParams, 
 	int & percent)
 {
 	if (triggerList.empty()) {
@@ -189,12 +209,12 @@ void ExportDatabaseAdapter::exportTriggersToSql(uint64_t userDbId, std::wofstrea
 	int avgVal = int(round( 10.0 / double(triggerList.size())));
 	for (auto userTrigger : triggerList) {
 		if (tblStatementParams.param == L"override-table") {
-			ofs << L"DROP TRIGGER IF EXISTS \"" << userTrigger.name << L"\";" << endl;
-			ofs << userTrigger.sql << L";" << endl;
+			writer.write(L"DROP TRIGGER IF EXISTS \"" + userTrigger.name + L"\";\r\n");
+			writer.write(userTrigger.sql + L";\r\n");
 		} else if (tblStatementParams.param == L"retain-table"){
 			std::wstring sql = userTrigger.sql;
 			replaceCreateTriggerClause(sql);
-			ofs << sql << L";" << endl;
+			writer.write(sql + L";\r\n");
 		}
 
 		percent += avgVal;
@@ -206,15 +226,15 @@ void ExportDatabaseAdapter::exportTriggersToSql(uint64_t userDbId, std::wofstrea
 }
 
 /**
- * Export the table structure to sql file.
+ * Export the table structure to the prologue of the table.
  * 
- * @param ofs - file stream reference
+ * @param prologue - the statements before the rows of table
  * @param userdbId - user database id
  * @param tbl - table struct
  * @param structureAndDataParams - StructAndDataParams object reference
  * @return true/false
  */
-void ExportDatabaseAdapter::doExportCreateTableStructure(std::wofstream & ofs, uint64_t userDbId, 
+void ExportDatabaseAdapter::doExportCreateTableStructure(std::wstring & prologue, uint64_t userDbId, 
 	const UserTable tbl, const StructAndDataParams & structureAndDataParams, const TblStatementParams & tblStatementParams)
 {
 	ATLASSERT(userDbId && !tbl.name.empty() && !structureAndDataParams.sqlSetting.empty());
@@ -226,12 +246,12 @@ void ExportDatabaseAdapter::doExportCreateTableStructure(std::wofstream & ofs, u
 	// Drop tables first ,then create table
 	
 	if (tblStatementParams.param == L"override-table") {
-		ofs << L"DROP TABLE IF EXISTS \"" << tbl.name << L"\";" << endl;	
-		ofs << tbl.sql << L";" << endl;
+		prologue.append(L"DROP TABLE IF EXISTS \"").append(tbl.name).append(L"\";\r\n");
+		prologue.append(tbl.sql).append(L";\r\n");
 	} else if (tblStatementParams.param == L"retain-table"){
 		std::wstring sql = tbl.sql;
 		replaceCreateTableClause(sql);
-		ofs << sql << L";" << endl;
+		prologue.append(sql).append(L";\r\n");
 	}
 	
 
@@ -239,7 +259,7 @@ void ExportDatabaseAdapter::doExportCreateTableStructure(std::wofstream & ofs, u
 }
 
 
-void ExportDatabaseAdapter::doExportCreateIndex(std::wofstream & ofs, uint64_t userDbId, 
+void ExportDatabaseAdapter::doExportCreateIndex(std::wstring & prologue, uint64_t userDbId, 
 	const UserTable tbl, const StructAndDataParams & structureAndDataParams, const TblStatementParams & tblStatementParams)
 {
 	ATLASSERT(userDbId && !tbl.name.empty() && !structureAndDataParams.sqlSetting.empty());
@@ -254,94 +274,29 @@ void ExportDatabaseAdapter::doExportCreateIndex(std::wofstream & ofs, uint64_t u
 			continue;
 		}
 		if (isOverrideTable) { // override table
-			ofs << L"DROP INDEX IF EXISTS \"" << idx.name << L"\";" << endl;
-			ofs << idx.sql << L";" << endl;
+			prologue.append(L"DROP INDEX IF EXISTS \"").append(idx.name).append(L"\";\r\n");
+			prologue.append(idx.sql).append(L";\r\n");
 		} else if (isRetainTable){ // retain-table
 			std::wstring sql = idx.sql;
 			replaceCreateIndexClause(sql);
-			ofs << sql << L";" << endl;
+			prologue.append(sql).append(L";\r\n");
 		}
 	}
 	
 }
 
 /**
- * Export insert statement of the table data to sql file.
+ * Send the progress of tables to dialog, the tables are 80% of the progress.
  * 
- * @param ofs - file stream reference
- * @param userdbId - user database id
- * @param tbl - table struct
- * @param structureAndDataParams - StructAndDataParams object reference
- * @param insertStatementParams - InsertStatementParams object reference
+ * @param doneTables - the tables have been dumped
+ * @param totalTables - the total of tables
+ * @param arg - the percent pointer
  */
-void ExportDatabaseAdapter::doExportTableInsertStatement(std::wofstream & ofs, uint64_t userDbId,
-	const UserTable &tbl, const StructAndDataParams & structureAndDataParams, const InsertStatementParams & insertStatementParams)
+void ExportDatabaseAdapter::exportTablesProgressHandler(int doneTables, int totalTables, void * arg)
 {
-	ATLASSERT(userDbId && !tbl.name.empty() && !structureAndDataParams.sqlSetting.empty());
-
-	if (structureAndDataParams.sqlSetting == L"structure-only") {
-		return;
-	}
-
-	int pages = tableService->getTableDataPageCount(userDbId, tbl.name, EXPERT_PER_PAGE);
-	for (int i = 1; i <= pages; i++) {
-		std::pair<Columns, DataList> result = tableService->getTableDataListWithColumns(userDbId, tbl.name, i, EXPERT_PER_PAGE);
-		std::wstring sql = L"INSERT INTO ";
-		sql.append(L"\"").append(tbl.name).append(L"\" ");
-		// retain columns in insert statement, such as "INSERT INTO tbl (column1, column2, ...) VALUES (v1, v2, ...)"
-		if (insertStatementParams.retainColumn && result.first.size() > 0) {
-			std::wstring columnClause = L"(";
-			for (auto column : result.first) {
-				columnClause.append(L"\"").append(column).append(L"\"").append(L",");
-			}
-			columnClause = StringUtil::cutLastChar(columnClause);
-			columnClause.append(L")");
-			sql.append(columnClause);
-		}
-
-		// if enabled multiRows ,then multi rows in values clause, such as "... VALUES (v1, v2, ...),(vv1, vv2, ...) "
-		if (insertStatementParams.multiRows) {
-			ofs << sql;
-			ofs << L" VALUES ";
-			int i = 0;
-			for (auto rowItem : result.second) {
-				if (i > 0) {
-					ofs << L",";
-				}
-				std::wstring valClause = L"(";
-				int j = 0;
-				for (auto val : rowItem) {
-					if (j > 0) {
-						valClause.append(L",");
-					}
-					valClause.append(L"'").append(StringUtil::escapeSql(val)).append(L"'");
-					j++;
-				}
-				valClause.append(L")");
-				ofs << valClause << endl;
-				i++;
-			}
-			ofs << L";" << endl;
-		}
-		else {
-			for (auto rowItem : result.second) {
-				ofs << sql;
-				ofs << L" VALUES ";
-
-				std::wstring valClause = L"(";
-				int j = 0;
-				for (auto val : rowItem) {
-					if (j > 0) {
-						valClause.append(L",");
-					}
-					valClause.append(L"'").append(StringUtil::escapeSql(val)).append(L"'");
-					j++;
-				}
-				valClause.append(L");");
-				ofs << valClause << endl;
-			}
-		}
-	}
+	int * percent = static_cast<int *>(arg);
+	*percent = totalTables ? 80 * doneTables / totalTables : 80;
+	AppContext::getInstance()->dispatch(Config::MSG_EXPORT_DB_AS_SQL_PROCESS_ID, 0, *percent); // 
 }
 
 /**
@@ -25,6 +25,7 @@
 #include "core/service/db/TableService.h"
 #include "core/service/export/ExportDatabaseObjectsService.h"
 #include "ui/database/supplier/DatabaseSupplier.h"
+#include "utils/Utf8FileWriter.h"
 
 class ExportDatabaseAdapter : public QAdapter<ExportDatabaseAdapter>
 {
@@ -36,7 +37,7 @@ public:
 	void loadDbs();
 	uint64_t getSeletedUserDbId();
 
-	void exportObjectsToSql(uint64_t userDbId,
+	bool exportObjectsToSql(uint64_t userDbId,
 		std::wstring & exportPath,
 		UserTableList & tblList,
 		UserViewList & viewList,
@@ -52,23 +53,22 @@ private:
 	DatabaseSupplier * databaseSupplier = DatabaseSupplier::getInstance();
 
 	int exportTablesToSql(uint64_t userDbId,
-		std::wofstream & ofs, 
+		Utf8FileWriter & writer, 
 		UserTableList & tblList, 
 		StructAndDataParams & structureAndDataParams,
 		InsertStatementParams & insertStatementParams,
 		TblStatementParams & tblStatementParams, int & percent);
-	void exportViewsToSql(uint64_t userDbId, std::wofstream & ofs, UserViewList & viewList, 
+	void exportViewsToSql(uint64_t userDbId, Utf8FileWriter & writer, UserViewList & viewList, 
 		TblStatementParams & tblStatementParams, int & percent);
-	void exportTriggersToSql(uint64_t userDbId, std::wofstream & ofs, UserTriggerList & triggerList, 
+	void exportTriggersToSql(uint64_t userDbId, Utf8FileWriter & writer, UserTriggerList & triggerList, 
 		TblStatementParams & tblStatementParams, int & percent);
 
-	void doExportCreateTableStructure(std::wofstream & ofs, uint64_t userDbId, 
+	void doExportCreateTableStructure(std::wstring & prologue, uint64_t userDbId, 
 		const UserTable tbl, const StructAndDataParams & structureAndDataParams, const TblStatementParams & tblStatementParams);
-	void doExportCreateIndex(std::wofstream & ofs, uint64_t userDbId, 
+	void doExportCreateIndex(std::wstring & prologue, uint64_t userDbId, 
 		const UserTable tbl, const StructAndDataParams & structureAndDataParams, const TblStatementParams & tblStatementParams);
 
-	void doExportTableInsertStatement(std::wofstream & ofs, uint64_t userDbId, 
-		const UserTable &tbl, const StructAndDataParams & structureAndDataParams, const InsertStatementParams & insertStatementParams);
+	static void exportTablesProgressHandler(int doneTables, int totalTables, void * arg);
 
 	void replaceCreateTableClause(std::wstring &sql);	
 	void replaceCreateIndexClause(std::wstring &sql);	
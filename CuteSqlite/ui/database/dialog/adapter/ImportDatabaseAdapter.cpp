@@ -25,7 +25,10 @@
 #include "ui/common/message/QPopAnimate.h"
 #include "ui/common/message/QMessageBox.h"
 
-#define CMD_BUFF_LEN 1024
+// the interval(ms) of the progress messages when importing sql file
+#define SQL_IMPORT_PROGRESS_INTERVAL 200
+// the busy timeout(ms) of the import connection
+#define SQL_IMPORT_BUSY_TIMEOUT 5000
 
 
 ImportDatabaseAdapter::ImportDatabaseAdapter(HWND parentHwnd, ATL::CWindow * view)
@@ -36,7 +39,7 @@ ImportDatabaseAdapter::ImportDatabaseAdapter(HWND parentHwnd, ATL::CWindow * vie
 
 ImportDatabaseAdapter::~ImportDatabaseAdapter()
 {
-
+	cancelImport();
 }
 
 UserDbList ImportDatabaseAdapter::getDbs()
@@ -58,173 +61,163 @@ void ImportDatabaseAdapter::loadDbs()
 }
 
 
-bool ImportDatabaseAdapter::importFromSql(uint64_t userDbId, const std::wstring & importPath)
+/**
+ * Import the sql file to the user db in the worker thread with its own connection, the hwnd receives MSG_IMPORT_PROCESS_ID:
+ * wParam 0 - lParam is the percent of the bytes executed, 4 - lParam is the statements per second,
+ * 1 - the import is complete, 2 - the import has error, call reportImportError() to show it.
+ *
+ * @param hwnd - the window that receives the progress messages
+ * @param userDbId - the user db id
+ * @param importPath - the UTF-8 sql file
+ * @return true if the import is started
+ */
+bool ImportDatabaseAdapter::importFromSql(HWND hwnd, uint64_t userDbId, const std::wstring & importPath)
 {
 	ATLASSERT(userDbId > 0 && !importPath.empty());
 	if (_waccess(importPath.c_str(), 0) != 0) {
 		QPopAnimate::error(parentHwnd, S(L"error-text").append(S(L"import-file-not-exists")));
 		return false;
 	}
+	if (importing.load()) {
+		return false;
+	}
 
 	try {
 		UserDb userDb = databaseService->getUserDb(userDbId);
-		std::wstring dbPath = userDb.path;
-		std::wstring cmdline;
-		std::wstring sqlite3exePath = L"sqlite3.exe"; 
-		
-		std::wstring importRepPath = importPath;
-		// If the file path contains spaces, assign a copy to the local tmp directory
-		// Sample command linec:\system32\cmd.exe /c sqlite3.exe "HairAnalyzer.xlsx" ".read I:/hairanalysis-20230406-211747.sql"
-		if (importPath.find_first_of(L' ') != -1) { 
-			std::wstring tmpfn = FileUtil::getFileName(importPath,false);
-			std::wstring tmpext = FileUtil::getFileExt(importPath);			
-			std::wstring tmptime = DateUtil::getCurrentDateTime(L"%Y%m%d_%H%M%S");
-
-			// Tmp file name ,such as "tmp_hairanalysis_20230406_211747.sql"
-			std::wstring tmppath = ResourceUtil::getProductBinDir();
-			tmppath.append(L"tmp\tmp_").append(tmpfn).append(tmptime).append(L".").append(tmpext);
-			std::wstring tmpdir = FileUtil::getFileDir(tmppath);
-			if (_waccess(tmpdir.c_str(), 0) != 0) {
-				FileUtil::createDirectory(tmpdir);
-			}
-			// copy the import file to tmp file 
-			FileUtil::copy(importPath, tmppath);
-			importRepPath = tmppath;
-
-			// delete tmp file
-			//_wunlink(tmppath);
+		if (importWorker.joinable()) {
+			importWorker.join();
+		}
+		{
+			std::lock_guard<std::mutex> lock(importMutex);
+			importError.reset();
 		}
-		AppContext::getInstance()->dispatch(Config::MSG_IMPORT_PROCESS_ID, 0, 10);
-
-		// Ҫ滻Ŀ¼ָ,Ȼsqlite3 .readwindowsĿ¼
-		importRepPath = StringUtil::replace(importRepPath, L"\\", L"/");
-		cmdline.append(L"/c ").append(sqlite3exePath).append(L" \"").append(dbPath).append(L"\" \".read ").append(importRepPath).append(L"\"");
-		Q_DEBUG(L"Import file, cmd: [{}]", cmdline);
-		execCommandLine(cmdline.c_str());
-		AppContext::getInstance()->dispatch(Config::MSG_IMPORT_PROCESS_ID, 1, 100);
+		// the sql file may drop or alter the tables that the result list pages are querying
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(userDbId));
+		importing.store(true);
+		importWorker = std::thread(&ImportDatabaseAdapter::runImportFromSql, this, hwnd, userDbId, userDb.path, importPath);
 		return true;
 	} catch (QRuntimeException &ex) {
 		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
 		QPopAnimate::error(parentHwnd, S(L"error-text").append(ex.getMsg()).append(L",[code:").append(ex.getCode()).append(L"]"));
 		return false;
-	} catch (SQLite::QSqlException &ex) {
-		std::wstring errCode = std::to_wstring(ex.getErrorCode());
-		Q_ERROR(L"error{}, msg:{}", errCode, ex.getErrorStr());		
-		QPopAnimate::error(parentHwnd, S(L"error-text").append(ex.getErrorStr()).append(L",[code:").append(errCode).append(L"]"));
-		return false;
 	}
 }
 
-std::wstring ImportDatabaseAdapter::readFromSqlFile(const std::wstring & importPath)
+void ImportDatabaseAdapter::cancelImport()
 {
-	if (importPath.empty()) {
-		throw QRuntimeException(L"300011", S(L"import-path-empty-error"));
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		if (importer) {
+			importer->cancel();
+		}
 	}
-
-	if (_waccess(importPath.c_str(), 0) != 0) { // file not exists
-		throw QRuntimeException(L"300012", S(L"import-file-not-exists"));
+	if (importWorker.joinable()) {
+		importWorker.join();
 	}
+}
 
-	std::wifstream ifs;
-	auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-	std::locale utf8(std::locale("C"), codeccvt);
-	ifs.imbue(utf8);
-	ifs.open(importPath, std::ios::in);
-	if (ifs.bad()) {
-		return L"";
+void ImportDatabaseAdapter::reportImportError()
+{
+	std::shared_ptr<QRuntimeException> error;
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		error = importError;
 	}
-	std::wstring result;
-	wchar_t content[1025];
-	while (!ifs.eof()) {		
-		memset(content, 0, sizeof(wchar_t) * 1025);
-		ifs.read(content, 1024);
-		result.append(content);
+	if (!error) {
+		return;
+	}
+	QSqlExecuteException * sqlError = dynamic_cast<QSqlExecuteException *>(error.get());
+	if (sqlError) {
+		QPopAnimate::report(*sqlError);
+	} else {
+		QPopAnimate::report(*error);
 	}
-	
-	ifs.close();
-	return result;
 }
 
 /**
- * Exec the command line.
- * 
- * @param cmdline
+ * The worker thread of importFromSql, the statements are executed by QSqlScriptImporter and stop at the first error.
  */
-void ImportDatabaseAdapter::execCommandLine(const wchar_t * cmdline)
+void ImportDatabaseAdapter::runImportFromSql(HWND hwnd, uint64_t userDbId, std::wstring dbPath, std::wstring importPath)
 {
-	STARTUPINFO si;
-	ZeroMemory(&si, sizeof(STARTUPINFO));
-
-	HANDLE hStdInPipeRead = NULL;
-    HANDLE hStdInPipeWrite = NULL;
-    HANDLE hStdOutPipeRead = NULL;
-    HANDLE hStdOutPipeWrite = NULL;
-
-	 BOOL ok = TRUE;
-	// Create two pipes.
-    SECURITY_ATTRIBUTES sa = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
-	if (!CreatePipe(&hStdInPipeRead, &hStdInPipeWrite, &sa, 0)) {
-		Q_ERROR(L"CreatePipe failed, ERROR:{}. cmdline:{}", GetLastError(), cmdline);
+	QSqlDatabase connect(L"sqlite3_import_db_" + std::to_wstring(userDbId));
+	connect.setDatabaseName(dbPath);
+	if (!connect.open()) {
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = std::make_shared<QRuntimeException>(connect.lastErrorCode(), connect.lastError());
+		importing.store(false);
+		::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, 2, NULL);
 		return;
 	}
-	if (!CreatePipe(&hStdOutPipeRead, &hStdOutPipeWrite, &sa, 0)) {
-		Q_ERROR(L"CreatePipe failed, ERROR:{}. cmdline:{}", GetLastError(), cmdline);
-		return;
+	connect.setBusyTimeout(SQL_IMPORT_BUSY_TIMEOUT);
+
+	QSqlScriptImporter scriptImporter(&connect);
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		importer = &scriptImporter;
+	}
+	SqlImportProgress progress;
+	progress.hwnd = hwnd;
+	progress.beginTick = progress.lastTick = ::GetTickCount64();
+	WPARAM wParam = 1;
+	LPARAM lParam = 100;
+	try {
+		uint64_t statements = scriptImporter.import(importPath, &ImportDatabaseAdapter::importSqlProgressHandler, &progress);
+		Q_INFO(L"import sql file complete, statements:{}, path:{}", statements, importPath);
+		postImportSqlSpeed(hwnd, statements, progress.beginTick);
+	} catch (QSqlExecuteException &ex) {
+		// the line of the error statement is shown before the error message
+		std::wstring errMsg = StringUtil::replace(S(L"import-sql-error-line-text"), std::wstring(L"{line}"), std::to_wstring(ex.getErrRow()));
+		errMsg.append(ex.getMsg());
+		auto error = std::make_shared<QSqlExecuteException>(ex.getCode(), errMsg, ex.getSql());
+		error->setErrRow(ex.getErrRow());
+		error->setRollBack(ex.getRollBack());
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = error;
+		wParam = 2;
+		lParam = static_cast<LPARAM>(ex.getErrRow());
+	} catch (QRuntimeException &ex) {
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = std::make_shared<QRuntimeException>(ex);
+		wParam = 2;
+		lParam = NULL;
+	}
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		importer = nullptr;
+	}
+	connect.close();
+	importing.store(false);
+	::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, wParam, lParam);
+}
+
+/**
+ * Post the percent of the executed bytes and the speed of import to the window, at most once every SQL_IMPORT_PROGRESS_INTERVAL ms.
+ *
+ * @param progress - the progress of QSqlScriptImporter
+ * @param arg - SqlImportProgress pointer
+ * @return 0, continue to import
+ */
+int ImportDatabaseAdapter::importSqlProgressHandler(const QSqlScriptProgress & progress, void * arg)
+{
+	SqlImportProgress * importProgress = static_cast<SqlImportProgress *>(arg);
+	ULONGLONG tick = ::GetTickCount64();
+	if (tick - importProgress->lastTick < SQL_IMPORT_PROGRESS_INTERVAL || !progress.totalBytes) {
+		return 0;
 	}
+	importProgress->lastTick = tick;
+	int percent = static_cast<int>(progress.doneBytes * 100 / progress.totalBytes);
+	percent = (std::min)(percent, 99);
+	if (percent > importProgress->percent) {
+		importProgress->percent = percent;
+		::PostMessage(importProgress->hwnd, Config::MSG_IMPORT_PROCESS_ID, 0, percent);
+	}
+	postImportSqlSpeed(importProgress->hwnd, progress.statements, importProgress->beginTick);
+	return 0;
+}
 
-    si.cb = sizeof(STARTUPINFO);
-    si.hStdError = hStdOutPipeWrite;
-    si.hStdOutput = hStdOutPipeWrite;
-    si.hStdInput = hStdInPipeRead;
-	si.wShowWindow = SW_HIDE; // д
-    si.dwFlags = STARTF_USESTDHANDLES | STARTF_USESHOWWINDOW;
-
-	PROCESS_INFORMATION pi = {};
-
-	// ע1system32·עһҪnew/deletewchar_t飬CreateProcessWִУȻִᱨ
-	wchar_t * exepath = new wchar_t[_MAX_PATH];
-	memset(exepath, 0, sizeof(wchar_t) * sizeof(exepath));
-	::GetSystemDirectoryW(exepath, _MAX_PATH);
-	wcscat_s(exepath, _MAX_PATH, L"\\cmd.exe");
-
-	// ע21,2һҪ,ܱ֤ضȷ, 
-	//    c:\system32\cmd.exe \c sqlite3.exe > [ļ]ȻضļΪض>زִ
-	if (!CreateProcessW(exepath, (LPWSTR)cmdline, NULL, NULL, TRUE, 0, NULL, NULL, &si, &pi)) {
-        Q_ERROR(L"CreateProcessW failed,ERROR:{}. cmdline:{}", GetLastError(), cmdline);
-        return;
-    }
-
-	 // Close pipes we do not need.
-    CloseHandle(hStdOutPipeWrite);
-    CloseHandle(hStdInPipeRead);
-
-	bool bStatus;
-    CHAR aBuf[CMD_BUFF_LEN + 1];
-    DWORD dwRead;
-    // GetStdHandle(STD_OUTPUT_HANDLE)
-
-	std::string outmsg;
-    while (true) {
-		ZeroMemory(aBuf, CMD_BUFF_LEN + 1);
-        bStatus = ReadFile(hStdOutPipeRead, aBuf, sizeof(aBuf), &dwRead, NULL);
-        if (!bStatus || dwRead == 0) {
-            break;
-        }
-		outmsg.append(aBuf);
-    }
-	if (!outmsg.empty()) {
-		std::wstring outstr = StringUtil::utf82Unicode(outmsg);
-        Q_ERROR(L"message from console:{}", outstr);
-	}
-
-	WaitForSingleObject( pi.hProcess, INFINITE );
-	delete[] exepath;
-
-	// Clean up and exit.
-    CloseHandle(hStdOutPipeRead);
-    CloseHandle(hStdInPipeWrite);
-
-    // Close process and thread handles. 
-    CloseHandle( pi.hProcess );
-    CloseHandle( pi.hThread );
+void ImportDatabaseAdapter::postImportSqlSpeed(HWND hwnd, uint64_t statements, ULONGLONG beginTick)
+{
+	ULONGLONG elapsed = ::GetTickCount64() - beginTick;
+	uint64_t statementsPerSecond = statements * 1000 / (elapsed ? elapsed : 1);
+	::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, 4, static_cast<LPARAM>(statementsPerSecond));
 }
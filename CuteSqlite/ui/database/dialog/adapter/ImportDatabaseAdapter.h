@@ -18,11 +18,17 @@
  * @date   2023-10-08
  *********************************************************************/
 #pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "ui/common/adapter/QAdapter.h"
 #include "core/entity/Entity.h"
 #include "core/service/db/DatabaseService.h"
 #include "core/service/db/TableService.h"
 #include "core/service/db/SqlService.h"
+#include "core/common/repository/QSqlScriptImporter.h"
+#include "core/common/exception/QSqlExecuteException.h"
 #include "ui/common/listview/QListViewCtrl.h"
 
 class ImportDatabaseAdapter : public QAdapter<ImportDatabaseAdapter>
@@ -34,7 +40,13 @@ public:
 	//FOR IMPORT AS SQL 
 	UserDbList getDbs();
 	void loadDbs();
-	bool importFromSql(uint64_t userDbId, const std::wstring & importPath);
+	// Import the sql file in the worker thread, the progress is posted to hwnd by MSG_IMPORT_PROCESS_ID
+	bool importFromSql(HWND hwnd, uint64_t userDbId, const std::wstring & importPath);
+	// Interrupt the running import and wait for the worker thread
+	void cancelImport();
+	bool isImporting() const { return importing.load(); }
+	// Show the error of the last import
+	void reportImportError();
 
 protected:
 	UserDbList dbs;
@@ -43,6 +55,23 @@ protected:
 	TableService * tableService = TableService::getInstance();
 	SqlService * sqlService = SqlService::getInstance();
 
-	std::wstring readFromSqlFile(const std::wstring & importPath);
-	void execCommandLine(const wchar_t * cmdline);
+
+	// the progress of sql import, posted to hwnd every SQL_IMPORT_PROGRESS_INTERVAL ms at most
+	typedef struct _SqlImportProgress {
+		HWND hwnd = nullptr;
+		int percent = 0;
+		ULONGLONG beginTick = 0;
+		ULONGLONG lastTick = 0;
+	} SqlImportProgress;
+
+	std::thread importWorker;
+	std::atomic<bool> importing{ false };
+	// protects importer and importError
+	std::mutex importMutex;
+	QSqlScriptImporter * importer = nullptr;
+	std::shared_ptr<QRuntimeException> importError;
+
+	void runImportFromSql(HWND hwnd, uint64_t userDbId, std::wstring dbPath, std::wstring importPath);
+	static int importSqlProgressHandler(const QSqlScriptProgress & progress, void * arg);
+	static void postImportSqlSpeed(HWND hwnd, uint64_t statements, ULONGLONG beginTick);
 };
@@ -20,10 +20,18 @@
 #include "stdafx.h"
 #include "ImportFromCsvAdapter.h"
 #include "core/common/Lang.h"
+#include "common/AppContext.h"
 #include "ui/common/message/QPopAnimate.h"
 #include <strsafe.h>
 #include <utils/SavePointUtil.h>
 
+// the min interval (ms) of posting the import progress
+#define CSV_IMPORT_PROGRESS_INTERVAL 200
+// the rows of csv file shown in the data list view
+#define CSV_PREVIEW_ROWS 1000
+// the busy timeout(ms) of the import connection
+#define CSV_IMPORT_BUSY_TIMEOUT 5000
+
 ImportFromCsvAdapter::ImportFromCsvAdapter(HWND parentHwnd, ImportFromCsvSupplier * supplier)
 	:ImportDatabaseAdapter(parentHwnd, nullptr)
 {
@@ -31,6 +39,11 @@ ImportFromCsvAdapter::ImportFromCsvAdapter(HWND parentHwnd, ImportFromCsvSupplie
 	this->supplier = supplier;
 }
 
+ImportFromCsvAdapter::~ImportFromCsvAdapter()
+{
+	cancelImport();
+}
+
 
 UserTableStrings ImportFromCsvAdapter::getTables(uint64_t userDbid)
 {
@@ -87,13 +100,20 @@ int ImportFromCsvAdapter::loadCsvFileToColumnListView(const std::wstring &import
 		return 0;
 	}
 	
-	std::wstring firstLine = readFirstLineFromCvsFile(importPath);
-	if (firstLine.empty()) {
+	RowItem fields;
+	try {
+		CsvReader reader(getCsvOptions());
+		reader.open(importPath);
+		reader.readRow(fields);
+	} catch (QRuntimeException &ex) {
+		QPopAnimate::report(ex);
+		return 0;
+	}
+	if (fields.empty()) {
 		QPopAnimate::error(E(L"200002"));
 		return 0;
 	}
 	columnListView.DeleteAllItems();
-	auto fields = splitLineAndConvertStringByCsvSettings(firstLine);
 	
 	supplier->setCsvRuntimeColumns(fields);
 	int rowCount = static_cast<int>(fields.size());
@@ -126,29 +146,20 @@ int ImportFromCsvAdapter::loadCsvFileToDataListView(const std::wstring & importP
 		return 0;
 	}
 	
-	std::wifstream ifs;
-	if (supplier->csvCharset == L"UTF-16") {
-		auto codeccvt = new std::codecvt_utf16<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-		std::locale utf16(std::locale("C"), codeccvt);
-		ifs.imbue(utf16);
-	} else {
-		auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-		std::locale utf8(std::locale("C"), codeccvt);
-		ifs.imbue(utf8);
-	}
-	
-	ifs.open(importPath, std::ios::in);
-	if (ifs.bad()) {
+	// only the first CSV_PREVIEW_ROWS rows are read for preview, the whole file is read by importFromRuntimeDatas()
+	CsvReader reader(getCsvOptions());
+	RowItem fields;
+	try {
+		reader.open(importPath);
+		reader.readRow(fields);
+	} catch (QRuntimeException &ex) {
+		QPopAnimate::report(ex);
 		return 0;
 	}
-	
-	std::wstring line = readLineFromCsvFileStream(ifs);
-	if (line.empty()) {
+	if (fields.empty()) {
 		QPopAnimate::error(E(L"200002"));
-		ifs.close();
 		return 0;
 	}
-	auto fields = splitLineAndConvertStringByCsvSettings(line);
 
 	dataListView.DeleteAllItems();
 	supplier->clearCsvRuntimeDatas();
@@ -166,21 +177,16 @@ int ImportFromCsvAdapter::loadCsvFileToDataListView(const std::wstring & importP
 		supplier->addCsvRuntimeData(fields);
 		rowCount++;
 	}
-		
-	while (!ifs.eof()) {
-		line = readLineFromCsvFileStream(ifs);
-		if (line.empty() || 
-			(line.size() <= 2 && (*(line.rbegin()) == L'\r' || *(line.rbegin()) == L'\n'))) {
-			continue;
-		}
-		auto rowItem = splitLineAndConvertStringByCsvSettings(line);
-		if (rowItem.size() != supplier->getCsvRuntimeColumns().size()) {
+	
+	size_t fieldCount = supplier->getCsvRuntimeColumns().size();
+	RowItem rowItem;
+	while (rowCount < CSV_PREVIEW_ROWS && reader.readRow(rowItem)) {
+		if (rowItem.size() != fieldCount) {
 			continue;
 		}
 		supplier->addCsvRuntimeData(rowItem);
 		rowCount++;
 	}
-	ifs.close();
 	dataListView.SetItemCount(rowCount);
 	return rowCount;
 }
@@ -297,156 +303,22 @@ bool ImportFromCsvAdapter::getIsChecked(QListViewCtrl * listView, int iItem)
 	return false;
 }
 
-std::wstring ImportFromCsvAdapter::readFirstLineFromCvsFile(const std::wstring & importPath)
-{
-	if (importPath.empty() || _waccess(importPath.c_str(), 0) != 0) {
-		return 0;
-	}
-	
-	std::wifstream ifs;
-	if (supplier->csvCharset == L"UTF-16") {
-		auto codeccvt = new std::codecvt_utf16<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-		std::locale utf16(std::locale("C"), codeccvt);
-		ifs.imbue(utf16);
-	} else {
-		auto codeccvt = new std::codecvt_utf8<wchar_t, 0x10ffff, std::codecvt_mode(std::generate_header | std::little_endian)>();
-		std::locale utf8(std::locale("C"), codeccvt);
-		ifs.imbue(utf8);
-	}
-	
-	ifs.open(importPath, std::ios::in);
-	if (ifs.bad()) {
-		return L"";
-	}
-	
-	std::wstring line = readLineFromCsvFileStream(ifs);
-	if (line.empty()) {
-		QPopAnimate::error(E(L"200002"));
-		ifs.close();
-		return line;
-	}
-
-	ifs.close();
-
-	return line;
-}
-
-std::wstring ImportFromCsvAdapter::readLineFromCsvFileStream(std::wifstream &ifs)
-{
-	std::stack<int> stack;
-	std::wstring line;
-	int i = 0;
-	while (!ifs.eof()) {
-		wchar_t ch;
-		ifs.get(ch); // ȡһַ
-
-		// һж,ȷз,Ƿڰ
-		if (!supplier->csvFieldEnclosedBy.empty()
-				&& ch == supplier->csvFieldEnclosedBy.at(0)){ // 1. ȡַǰַ(enclose)				
-			if (!supplier->csvFieldEscapedBy.empty() // ѿescape
-				&& !line.empty()
-				&& *(line.rbegin()) == *(supplier->csvFieldEscapedBy.rbegin())) {
-				// 2.жlineһַ,Ƿתѿescape,ǣ
-				line.push_back(ch); 
-				continue;
-			}
-			if (!stack.empty()) { // رյİַ"",һ
-				stack.pop();
-			} else {
-				stack.push(i); // µİַ"",ǿʼһ
-			}			
-		}
-
-		bool foundLineSeperator = false; // Ƿҵз
-		if (supplier->csvLineTerminatedBy == L"CR" && ch == L'\r') {
-			foundLineSeperator = true;
-		} else if (supplier->csvLineTerminatedBy == L"LF" && ch == L'\n') {
-			foundLineSeperator = true;
-		} else if (supplier->csvLineTerminatedBy == L"CRLF" && ch == L'\n') {
-			foundLineSeperator = true;
-		}
-
-		// stack ʶаδر
-		if (foundLineSeperator && stack.empty()) {
-			break;
-		}
-		line.push_back(ch);
-		i++;
-	}
-
-	StringUtil::trim(line);
-	return line;
-}
-
 /**
- * Spit a line, then convert the every field value with CSV settings.
- * 
- * @param line - one row string
- * @return - field value vector
+ * The csv settings of the supplier for CsvReader.
  */
-std::vector<std::wstring> ImportFromCsvAdapter::splitLineAndConvertStringByCsvSettings(std::wstring line)
+CsvOptions ImportFromCsvAdapter::getCsvOptions()
 {
-	std::wstring::size_type pos;
-	std::vector<std::wstring> result;
-	line.append(supplier->csvFieldTerminateBy); // append a field separator
-	std::wstring pattern = supplier->csvFieldTerminateBy;
-	if (pattern == L"TAB") {
-		pattern = L"\t";
-	}
-	int size = static_cast<int>(line.size());
-	for (int i = 0; i < size; i++) {
-		pos = line.find(pattern, i);
-		if (pos < size && pos != std::wstring::npos) {
-			std::wstring s = line.substr(i, pos - i);
-			if (s.empty()) {
-				i = static_cast<int>(pos + pattern.size()) - 1;
-				continue;
-			}
-			
-			// Field value enclose by
-			if (!supplier->csvFieldEnclosedBy.empty()) {
-				for (;;) {
-					size_t _begin = s.find(supplier->csvFieldEnclosedBy);
-					size_t _end = s.rfind(supplier->csvFieldEnclosedBy);
-
-					if (_begin != std::wstring::npos && _end != std::wstring::npos && _begin != _end) {
-						s = s.substr(_begin + 1, _end - _begin - 1);
-						break;
-					} else if (_begin != std::wstring::npos && (_end == std::wstring::npos || _begin == _end)) {
-						// ʾַ[pattern]δǰ[csvFieldEnclosedBy]֮
-						//  "123456abcd, ֻǰһ˫ţδֺһ˫ţŷָδܴ˫֮
-						pos = line.find(pattern, pos + 1);
-						if (pos == std::wstring::npos) {
-							break;
-						}
-						s = line.substr(i, pos - i);
-					} else {
-						break; // not found any csvFieldEnclosedBy
-					}
-				}				
-			}
-
-			if (!supplier->csvFieldEscapedBy.empty() && !supplier->csvFieldEnclosedBy.empty()) {
-				std::wstring before = supplier->csvFieldEscapedBy + supplier->csvFieldEnclosedBy;
-				std::wstring after = supplier->csvFieldEnclosedBy;
-				s = StringUtil::replace(s, before, after);
-			}
-
-			if (!supplier->csvNullAsKeyword.empty() && supplier->csvNullAsKeyword == L"YES") {
-				if (s == L"NULL" || s == L"null") {
-					s = L"< NULL >";
-				}
-			}
-
-
-			if (!s.empty()) {
-				StringUtil::trim(s);
-			}
-			result.push_back(s);
-			i = static_cast<int>(pos + pattern.size()) - 1;
-		}
-	}
-	return result;
+	CsvOptions options;
+	options.fieldTerminatedBy = supplier->csvFieldTerminateBy == L"TAB" ? L"\t" : supplier->csvFieldTerminateBy;
+	if (options.fieldTerminatedBy.empty()) {
+		options.fieldTerminatedBy = L",";
+	}
+	options.enclosedBy = supplier->csvFieldEnclosedBy.empty() ? 0 : supplier->csvFieldEnclosedBy.at(0);
+	options.escapedBy = supplier->csvFieldEscapedBy.empty() ? 0 : supplier->csvFieldEscapedBy.at(0);
+	options.lineTerminatedBy = supplier->csvLineTerminatedBy == L"CR" ? L'\r' : L'\n';
+	options.nullAsKeyword = supplier->csvNullAsKeyword == L"YES";
+	options.isUtf16 = supplier->csvCharset == L"UTF-16";
+	return options;
 }
 
 std::wstring ImportFromCsvAdapter::getPreviewSql()
@@ -506,50 +378,174 @@ std::list<std::wstring> ImportFromCsvAdapter::getRuntimeSqlList()
 	return result;
 }
 
-bool ImportFromCsvAdapter::importFromRuntimeSqlList()
+/**
+ * Import the csv file to the runtime table in the worker thread with its own connection, the rows are parsed 
+ * and converted to the typed values by the workers of QCsvImporter, and committed every supplier->csvImportBatchRows rows.
+ * The hwnd receives MSG_IMPORT_PROCESS_ID:
+ * wParam 0 - lParam is the percent of the bytes inserted, 4 - lParam is the rows per second,
+ * 1 - the import is complete, 2 - the import has error, call reportImportError() to show it.
+ * 
+ * @param hwnd - the window that receives the progress messages
+ * @param importPath - the csv file
+ * @return true if the import is started
+ */
+bool ImportFromCsvAdapter::importFromCsv(HWND hwnd, const std::wstring & importPath)
 {
-	// 1.generate runtime sql statements list
-	auto sqlList = getRuntimeSqlList();
-	if (sqlList.empty()) {
+	if (_waccess(importPath.c_str(), 0) != 0) {
+		QPopAnimate::error(parentHwnd, S(L"error-text").append(S(L"import-file-not-exists")));
+		return false;
+	}
+	if (importing.load()) {
+		return false;
+	}
+
+	// the target columns and the index of csv field for every target column
+	auto & targetColumns = supplier->getTblRuntimeColumns();
+	QCsvImportColumns columns;
+	int colLen = static_cast<int>(targetColumns.size());
+	for (int i = 0; i < colLen; i++) {
+		if (targetColumns.at(i).empty()) {
+			continue;
+		}
+		QCsvImportColumn column;
+		column.name = targetColumns.at(i);
+		column.fieldIndex = i;
+		columns.push_back(column);
+	}
+	QCsvImportOptions options;
+	options.csv = getCsvOptions();
+	options.skipHeader = supplier->csvColumnNameOnTop != 0;
+	options.fieldCount = supplier->getCsvRuntimeColumns().size();
+	options.batchRows = supplier->csvImportBatchRows > 0 ? supplier->csvImportBatchRows : CSV_IMPORT_BATCH_ROWS;
+	if (columns.empty() || !options.fieldCount) {
 		QPopAnimate::error(E(L"200028"));
 		return false;
 	}
-	int percent = 5;
-	::PostMessage(parentHwnd, Config::MSG_IMPORT_PROCESS_ID, 0, percent);
 
-	// 2.Begin a save point
-	uint64_t targetUserDbId = supplier->getRuntimeUserDbId();
-	std::wstring sql = L"BEGIN;";
-	tableService->execBySql(targetUserDbId, sql);
-	
 	try {
-		// 3. begin execute sql statement	
-		int n = static_cast<int>(sqlList.size());
-		int avgVal = int(round(95.0 / double(n)));
-		for (auto & oneSql : sqlList) {
-			sql = oneSql;
-			tableService->execBySql(targetUserDbId, sql);
-			percent += avgVal;
-			::PostMessage(parentHwnd, Config::MSG_IMPORT_PROCESS_ID, 0, percent);
+		uint64_t userDbId = supplier->getRuntimeUserDbId();
+		UserDb userDb = databaseService->getUserDb(userDbId);
+		if (importWorker.joinable()) {
+			importWorker.join();
 		}
-		::PostMessage(parentHwnd, Config::MSG_IMPORT_PROCESS_ID, 1, 100);
-
-		// 4.COMMIT
-		sql = L"COMMIT;";
-		tableService->execBySql(targetUserDbId, sql);
+		{
+			std::lock_guard<std::mutex> lock(importMutex);
+			importError.reset();
+		}
+		// the opened queries of the result list pages hold the SHARED lock, release them before writing by the import connection
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(userDbId));
+		importing.store(true);
+		importWorker = std::thread(&ImportFromCsvAdapter::runImportFromCsv, this, hwnd, userDbId, userDb.path, importPath,
+			supplier->getRuntimeTblName(), columns, options);
 		return true;
-	} catch (QSqlExecuteException &ex) {
-		QPopAnimate::report(ex);
-		sql = L"ROLLBACK;";
-		tableService->execBySql(targetUserDbId, sql);
-		::PostMessage(parentHwnd, Config::MSG_IMPORT_PROCESS_ID, 2, NULL);
-		return false;
 	} catch (QRuntimeException &ex) {
-		QPopAnimate::report(ex);
-		sql = L"ROLLBACK;";
-		tableService->execBySql(targetUserDbId, sql);
-		::PostMessage(parentHwnd, Config::MSG_IMPORT_PROCESS_ID, 2, NULL);
+		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
+		QPopAnimate::error(parentHwnd, S(L"error-text").append(ex.getMsg()).append(L",[code:").append(ex.getCode()).append(L"]"));
 		return false;
 	}
-	return false;
+}
+
+void ImportFromCsvAdapter::cancelImport()
+{
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		if (csvImporter) {
+			csvImporter->cancel();
+		}
+	}
+	if (importWorker.joinable()) {
+		importWorker.join();
+	}
+}
+
+/**
+ * The worker thread of importFromCsv, the import stops at the first error and the rows of the failed batch are rolled back.
+ */
+void ImportFromCsvAdapter::runImportFromCsv(HWND hwnd, uint64_t userDbId, std::wstring dbPath, std::wstring importPath, 
+	std::wstring tblName, QCsvImportColumns columns, QCsvImportOptions options)
+{
+	QSqlDatabase connect(L"sqlite3_import_db_" + std::to_wstring(userDbId));
+	connect.setDatabaseName(dbPath);
+	if (!connect.open()) {
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = std::make_shared<QRuntimeException>(connect.lastErrorCode(), connect.lastError());
+		importing.store(false);
+		::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, 2, NULL);
+		return;
+	}
+	connect.setBusyTimeout(CSV_IMPORT_BUSY_TIMEOUT);
+
+	QCsvImporter importer(&connect, options);
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		csvImporter = &importer;
+	}
+	SqlImportProgress progress;
+	progress.hwnd = hwnd;
+	progress.beginTick = progress.lastTick = ::GetTickCount64();
+	WPARAM wParam = 1;
+	LPARAM lParam = 100;
+	try {
+		uint64_t rows = importer.import(importPath, tblName, columns, &ImportFromCsvAdapter::importCsvProgressHandler, &progress);
+		Q_INFO(L"import csv file complete, rows:{}, path:{}", rows, importPath);
+		if (!rows) {
+			throw QRuntimeException(L"200028", E(L"200028"));
+		}
+		postImportSpeed(hwnd, rows, progress.beginTick);
+	} catch (QSqlExecuteException &ex) {
+		// the row of the error is shown before the error message
+		std::wstring errMsg = StringUtil::replace(S(L"import-csv-error-row-text"), std::wstring(L"{row}"), std::to_wstring(ex.getErrRow()));
+		errMsg.append(ex.getMsg());
+		auto error = std::make_shared<QSqlExecuteException>(ex.getCode(), errMsg, ex.getSql());
+		error->setErrRow(ex.getErrRow());
+		error->setRollBack(ex.getRollBack());
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = error;
+		wParam = 2;
+		lParam = static_cast<LPARAM>(ex.getErrRow());
+	} catch (QRuntimeException &ex) {
+		std::lock_guard<std::mutex> lock(importMutex);
+		importError = std::make_shared<QRuntimeException>(ex);
+		wParam = 2;
+		lParam = NULL;
+	}
+	{
+		std::lock_guard<std::mutex> lock(importMutex);
+		csvImporter = nullptr;
+	}
+	connect.close();
+	importing.store(false);
+	::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, wParam, lParam);
+}
+
+/**
+ * Post the percent of the inserted bytes and the speed of import to the window, at most once every CSV_IMPORT_PROGRESS_INTERVAL ms.
+ * 
+ * @param progress - the progress of QCsvImporter
+ * @param arg - SqlImportProgress pointer
+ * @return 0, continue to import
+ */
+int ImportFromCsvAdapter::importCsvProgressHandler(const QCsvImportProgress & progress, void * arg)
+{
+	SqlImportProgress * importProgress = static_cast<SqlImportProgress *>(arg);
+	ULONGLONG tick = ::GetTickCount64();
+	if (tick - importProgress->lastTick < CSV_IMPORT_PROGRESS_INTERVAL || !progress.totalBytes) {
+		return 0;
+	}
+	importProgress->lastTick = tick;
+	int percent = static_cast<int>(progress.doneBytes * 100 / progress.totalBytes);
+	percent = (std::min)(percent, 99);
+	if (percent > importProgress->percent) {
+		importProgress->percent = percent;
+		::PostMessage(importProgress->hwnd, Config::MSG_IMPORT_PROCESS_ID, 0, percent);
+	}
+	postImportSpeed(importProgress->hwnd, progress.rows, importProgress->beginTick);
+	return 0;
+}
+
+void ImportFromCsvAdapter::postImportSpeed(HWND hwnd, uint64_t rows, ULONGLONG beginTick)
+{
+	ULONGLONG elapsed = ::GetTickCount64() - beginTick;
+	uint64_t rowsPerSecond = rows * 1000 / (elapsed ? elapsed : 1);
+	::PostMessage(hwnd, Config::MSG_IMPORT_PROCESS_ID, 4, static_cast<LPARAM>(rowsPerSecond));
 }
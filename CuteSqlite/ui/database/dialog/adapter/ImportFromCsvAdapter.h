@@ -20,12 +20,14 @@
 #pragma once
 #include "ImportDatabaseAdapter.h"
 #include "ui/database/dialog/supplier/ImportFromCsvSupplier.h"
+#include "utils/CsvReader.h"
+#include "core/common/repository/QCsvImporter.h"
 
 class ImportFromCsvAdapter : public ImportDatabaseAdapter
 {
 public:
 	ImportFromCsvAdapter(HWND parentHwnd, ImportFromCsvSupplier * supplier);
-	~ImportFromCsvAdapter() {};
+	~ImportFromCsvAdapter();
 
 	//FOR IMPORT AS CSV
 	UserTableStrings getTables(uint64_t userDbid);
@@ -41,12 +43,20 @@ public:
 
 	std::list<std::wstring> getRuntimeSqlList();
 
-	// import action
-	bool importFromRuntimeSqlList();
+	// Import the csv file to the runtime table in the worker thread, the progress is posted to hwnd by MSG_IMPORT_PROCESS_ID
+	bool importFromCsv(HWND hwnd, const std::wstring & importPath);
+	// Stop the running import and wait for the worker thread
+	void cancelImport();
 private:
 	ImportFromCsvSupplier * supplier = nullptr;
+	// protected by importMutex
+	QCsvImporter * csvImporter = nullptr;
+
+	void runImportFromCsv(HWND hwnd, uint64_t userDbId, std::wstring dbPath, std::wstring importPath, 
+		std::wstring tblName, QCsvImportColumns columns, QCsvImportOptions options);
+	static int importCsvProgressHandler(const QCsvImportProgress & progress, void * arg);
+	static void postImportSpeed(HWND hwnd, uint64_t rows, ULONGLONG beginTick);
+
 	bool getIsChecked(QListViewCtrl * listView, int iItem);
-	std::wstring readFirstLineFromCvsFile(const std::wstring & importPath);
-	std::wstring readLineFromCsvFileStream(std::wifstream &ifs);
-	std::vector<std::wstring> splitLineAndConvertStringByCsvSettings(std::wstring line);
+	CsvOptions getCsvOptions();
 };
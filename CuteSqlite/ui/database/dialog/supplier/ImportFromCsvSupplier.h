@@ -22,6 +22,9 @@
 #include "ui/database/supplier/DatabaseSupplier.h"
 #include "core/entity/Entity.h"
 
+// the rows committed in one transaction when importing csv
+#define CSV_IMPORT_BATCH_ROWS 10000
+
 class ImportFromCsvSupplier :public QSupplier 
 {
 public:
@@ -36,6 +39,7 @@ public:
 	std::wstring csvLineTerminatedBy;
 	std::wstring csvNullAsKeyword;
 	std::wstring csvCharset;
+	int csvImportBatchRows = CSV_IMPORT_BATCH_ROWS;
 
 	Columns & getCsvRuntimeColumns() { return csvRuntimeColumns; }
 	void setCsvRuntimeColumns(const Columns & val) { csvRuntimeColumns = val; }
@@ -182,6 +182,8 @@ bool DatabaseMenuAdapter::dropView()
 		return false;
 	}
 	try {
+		// the opened queries of the result list pages block the DDL(SQLITE_LOCKED), release them before executing
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(supplier->getSelectedUserDbId()));
 		databaseService->dropView(supplier->getSelectedUserDbId(), supplier->selectedViewName);
 		QPopAnimate::success(S(L"drop-view-success-text")); 
 		if (AppContext::getInstance()->dispatchForResponse(Config::MSG_DROP_VIEW_ID, NULL, NULL)) {
@@ -204,6 +206,7 @@ bool DatabaseMenuAdapter::dropTrigger()
 		return false;
 	}
 	try {
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(supplier->getSelectedUserDbId()));
 		databaseService->dropTrigger(supplier->getSelectedUserDbId(), supplier->selectedTriggerName);
 		QPopAnimate::success(S(L"drop-trigger-success-text")); 
 		if (AppContext::getInstance()->dispatchForResponse(Config::MSG_DROP_TRIGGER_ID, NULL, NULL)) {
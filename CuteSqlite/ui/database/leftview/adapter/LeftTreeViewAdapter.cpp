@@ -260,7 +260,7 @@ void LeftTreeViewAdapter::selectTableTreeItem(uint64_t userDbId, const std::wstr
 			}
 			folderName.assign(cch);
 			::SysFreeString(cch);
-			if (folderName != S(L"tables")) {
+			if (folderName != SR(L"tables")) {
 				folderTreeItem = folderTreeItem.GetNextSibling();
 				continue;
 			}
@@ -550,8 +550,8 @@ void LeftTreeViewAdapter::loadTablesForTreeView(HTREEITEM hTablesFolderItem, Use
 		for (UserTable item : tableList) {
 			HTREEITEM hTblItem = dataView->InsertItem(item.name.c_str(), 2, 2, hTablesFolderItem, TVI_LAST); 
 
-			HTREEITEM hColumnsFolderItem = dataView->InsertItem(S(L"columns").c_str(), 1, 1, hTblItem, TVI_LAST);
-			HTREEITEM hIndexesFolderItem = dataView->InsertItem(S(L"indexes").c_str(), 1, 1, hTblItem, TVI_LAST);
+			HTREEITEM hColumnsFolderItem = dataView->InsertItem(SR(L"columns").c_str(), 1, 1, hTblItem, TVI_LAST);
+			HTREEITEM hIndexesFolderItem = dataView->InsertItem(SR(L"indexes").c_str(), 1, 1, hTblItem, TVI_LAST);
 
 			if (isLoadColumnsAndIndex) {
 				loadTblColumsForTreeView(hColumnsFolderItem, userDb.id, item);
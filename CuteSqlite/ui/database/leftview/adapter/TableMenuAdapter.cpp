@@ -161,6 +161,8 @@ bool TableMenuAdapter::renameTable()
 		return false;
 	}
 	try {
+		// the opened queries of the result list pages block the DDL(SQLITE_LOCKED), release them before executing
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(supplier->getSelectedUserDbId()));
 		tableService->renameTable(supplier->getSelectedUserDbId(), supplier->oldTableName, supplier->newTableName, supplier->selectedSchema);
 		QPopAnimate::success(S(L"rename-table-success-text"));
 		if (AppContext::getInstance()->dispatchForResponse(Config::MSG_RENAME_TABLE_ID, NULL, NULL)) {
@@ -185,6 +187,7 @@ bool TableMenuAdapter::truncateTable()
 		return false;
 	}
 	try {
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(supplier->getSelectedUserDbId()));
 		tableService->truncateTable(supplier->getSelectedUserDbId(), supplier->selectedTable, supplier->selectedSchema);
 		QPopAnimate::success(S(L"truncate-table-success-text")); 
 		AppContext::getInstance()->dispatch(Config::MSG_REFRESH_SAME_TABLE_DATA_ID,
@@ -206,6 +209,7 @@ bool TableMenuAdapter::dropTable()
 		return false;
 	}
 	try {
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(supplier->getSelectedUserDbId()));
 		tableService->dropTable(supplier->getSelectedUserDbId(), supplier->selectedTable, supplier->selectedSchema);
 		QPopAnimate::success(S(L"drop-table-success-text")); 
 		if (AppContext::getInstance()->dispatchForResponse(Config::MSG_DROP_TABLE_ID, NULL, NULL)) {
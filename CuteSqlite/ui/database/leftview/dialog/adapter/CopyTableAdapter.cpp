@@ -24,6 +24,10 @@
 #include "utils/SavePointUtil.h"
 #include "common/AppContext.h"
 #include "utils/SqlUtil.h"
+#include "utils/Log.h"
+
+// the schema name of source db that is attached to the connection of target db
+#define COPY_TABLE_SOURCE_SCHEMA L"cute_copy_source"
 
 CopyTableAdapter::CopyTableAdapter(HWND parentHwnd, CopyTableSupplier * supplier)
 {
@@ -296,6 +300,8 @@ bool CopyTableAdapter::doExecSqlsInOtherDb()
 	uint64_t targetUserDbId = supplier->getTargetUserDbId();
 	int percent = 0;
 
+	// ATTACH must be executed out of the transaction
+	bool attached = attachSourceDb();
 	std::wstring sql = L"BEGIN;";
 	tableService->execBySql(targetUserDbId, sql);
 
@@ -314,8 +320,12 @@ bool CopyTableAdapter::doExecSqlsInOtherDb()
 				tableService->execBySql(targetUserDbId, sql);
 			}
 			
-			// 2. execute table data sql
-			doExecCopyDataSqlInOtherDb(tblItem.first, tblItem.second);
+			// 2. execute table data sql, the text sql of rows is only used if the source db can't be attached
+			if (attached) {
+				doBulkCopyDataInOtherDb(tblItem.first, tblItem.second, percent, percent + avgVal);
+			} else {
+				doExecCopyDataSqlInOtherDb(tblItem.first, tblItem.second);
+			}
 			percent += avgVal;
 			::PostMessage(parentHwnd, Config::MSG_COPY_TABLE_PROCESS_ID, 0, percent);
 		}
@@ -323,6 +333,9 @@ bool CopyTableAdapter::doExecSqlsInOtherDb()
 		// 4.COMMIT TRANSACTION
 		sql = L"COMMIT;";
 		tableService->execBySql(targetUserDbId, sql);
+		if (attached) {
+			detachSourceDb();
+		}
 		::PostMessage(parentHwnd, Config::MSG_COPY_TABLE_PROCESS_ID, 1, 100);
 		return true;
 	}
@@ -330,6 +343,9 @@ bool CopyTableAdapter::doExecSqlsInOtherDb()
 		QPopAnimate::report(ex);
 		sql = L"ROLLBACK;";
 		tableService->execBySql(targetUserDbId, sql);
+		if (attached) {
+			detachSourceDb();
+		}
 		::PostMessage(parentHwnd, Config::MSG_COPY_TABLE_PROCESS_ID, 2, NULL);
 		return false;
 	}
@@ -337,11 +353,109 @@ bool CopyTableAdapter::doExecSqlsInOtherDb()
 		QPopAnimate::report(ex);
 		sql = L"ROLLBACK;";
 		tableService->execBySql(targetUserDbId, sql);
+		if (attached) {
+			detachSourceDb();
+		}
 		::PostMessage(parentHwnd, Config::MSG_COPY_TABLE_PROCESS_ID, 2, NULL);
 		return false;
 	}
 }
 
+/**
+ * Attach the source db to the connection of target db, so the rows can be copied by INSERT ... SELECT.
+ * 
+ * @return false if the source db can't be attached, such as in-memory db or the target db is in a transaction
+ */
+bool CopyTableAdapter::attachSourceDb()
+{
+	UserDb sourceUserDb = databaseService->getUserDb(supplier->getRuntimeUserDbId());
+	if (sourceUserDb.path.empty() || sourceUserDb.path == L":memory:") {
+		return false;
+	}
+	try {
+		tableService->attachDatabase(supplier->getTargetUserDbId(), sourceUserDb.path, COPY_TABLE_SOURCE_SCHEMA);
+		return true;
+	} catch (QSqlExecuteException &ex) {
+		Q_WARN(L"attach source db failed, copy the data by sql text, code:{}, msg:{}", ex.getCode(), ex.getMsg());
+		return false;
+	}
+}
+
+void CopyTableAdapter::detachSourceDb()
+{
+	try {
+		tableService->detachDatabase(supplier->getTargetUserDbId(), COPY_TABLE_SOURCE_SCHEMA);
+	} catch (QSqlExecuteException &ex) {
+		Q_WARN(L"detach source db failed, code:{}, msg:{}", ex.getCode(), ex.getMsg());
+	}
+}
+
+/**
+ * Copy the rows of source table to the target table in the other db by one statement:
+ * INSERT INTO "target_tbl" SELECT * FROM "cute_copy_source"."source_tbl" [WHERE {express} = {suffix}]
+ * The source db must be attached by attachSourceDb().
+ * 
+ * @param suffix - the sharding table suffix
+ * @param targetTblName - the target table name
+ * @param beginPercent - the percent of progress before copying
+ * @param endPercent - the percent of progress after copying
+ * @return 
+ */
+bool CopyTableAdapter::doBulkCopyDataInOtherDb(uint16_t suffix, const std::wstring & targetTblName, int beginPercent, int endPercent)
+{
+	if (supplier->getStructAndDataSetting() == STRUCT_ONLY 
+		|| supplier->getStructAndDataSetting() == UNKOWN || targetTblName.empty()) {
+		return false;
+	}
+
+	std::wstring whereClause;
+	if (supplier->getEnableTableSharding() && supplier->getEnableShardingStrategy() 
+		&& !supplier->getShardingStrategyExpress().empty()) {
+		whereClause.append(L"(").append(supplier->getShardingStrategyExpress()).append(L")").append(L"=").append(std::to_wstring(suffix));
+	}
+
+	// The rows copied are unknown until the statement finished, so estimate the progress by the instructions of SQLite,
+	// every scanned row takes about (columns + 8) instructions
+	uint64_t sourceUserDbId = supplier->getRuntimeUserDbId();
+	std::wstring & sourceTblName = supplier->getRuntimeTblName();
+	uint64_t rows = tableService->getTableDataCount(sourceUserDbId, sourceTblName);
+	uint64_t columns = tableService->getUserColumnStrings(sourceUserDbId, sourceTblName).size();
+
+	CopyProgress progress;
+	progress.hwnd = parentHwnd;
+	progress.beginPercent = beginPercent;
+	progress.endPercent = endPercent;
+	progress.percent = beginPercent;
+	progress.estimatedOps = rows * (columns + 8);
+	tableService->copyTableDataFromSchema(supplier->getTargetUserDbId(), targetTblName, COPY_TABLE_SOURCE_SCHEMA, 
+		sourceTblName, whereClause, &CopyTableAdapter::bulkCopyProgressHandler, &progress);
+	return true;
+}
+
+/**
+ * The progress handler of SQLite, post the percent to parent window when it changes.
+ * 
+ * @param arg - CopyProgress pointer
+ * @return 0 - continue to copy
+ */
+int CopyTableAdapter::bulkCopyProgressHandler(void * arg)
+{
+	CopyProgress * progress = static_cast<CopyProgress *>(arg);
+	if (!progress->estimatedOps || progress->endPercent <= progress->beginPercent) {
+		return 0;
+	}
+	progress->ops += TABLE_COPY_PROGRESS_OPS;
+	int span = progress->endPercent - progress->beginPercent;
+	int percent = progress->beginPercent + static_cast<int>(span * progress->ops / progress->estimatedOps);
+	// the end percent is posted after the statement finished
+	percent = (std::min)(percent, progress->endPercent - 1);
+	if (percent > progress->percent) {
+		progress->percent = percent;
+		::PostMessage(progress->hwnd, Config::MSG_COPY_TABLE_PROCESS_ID, 0, percent);
+	}
+	return 0;
+}
+
 bool CopyTableAdapter::doExecCopyDataSqlInOtherDb(uint16_t suffix, const std::wstring & targetTblName)
 {
 	// SQL : INSERT INTO target_tbl SELECT * FROM source_tbl [WHERE {express} = {suffix}]
@@ -350,7 +464,6 @@ bool CopyTableAdapter::doExecCopyDataSqlInOtherDb(uint16_t suffix, const std::ws
 		return false;
 	}
 
-	int page = 1;
 	int perpage = 100;
 
 	// Get data from the source table of source database, 
@@ -363,10 +476,11 @@ bool CopyTableAdapter::doExecCopyDataSqlInOtherDb(uint16_t suffix, const std::ws
 		whereClause.append(L"(").append(supplier->getShardingStrategyExpress()).append(L")").append(L"=").append(std::to_wstring(suffix));
 	}
 	
-	int totalPage = tableService->getTableWhereDataPageCount(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), whereClause, perpage);
-	for (page = 1; page <= totalPage; page++) {
+	// Walk the source table by keyset, the time of each page is constant even for the big table
+	TableKeyset keyset = tableService->getTableKeyset(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName());
+	while (!keyset.isEnd) {
 		// Get data from source table 
-		DataList pageDataList = tableService->getTableWhereDataList(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), whereClause, page, perpage);
+		DataList pageDataList = tableService->getTableKeysetDataList(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), keyset, perpage, whereClause);
 
 		// Generate a sql statement for the page data list. and then execute the sql statement.
 		std::wstring sql = genderatePageDataSql(pageDataList, targetTblName);
@@ -466,7 +580,6 @@ bool CopyTableAdapter::doAppendCopyDataSqlToEditor(QHelpEdit * editorPtr, uint16
 		return false;
 	}
 
-	int page = 1;
 	int perpage = 100;
 
 	// Get data from the source table of source database, 
@@ -480,10 +593,11 @@ bool CopyTableAdapter::doAppendCopyDataSqlToEditor(QHelpEdit * editorPtr, uint16
 		whereClause.append(L"(").append(supplier->getShardingStrategyExpress()).append(L")").append(L"=").append(std::to_wstring(suffix));
 	}
 	
-	int totalPage = tableService->getTableWhereDataPageCount(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), whereClause, perpage);
-	for (page = 1; page <= totalPage; page++) {
+	// Walk the source table by keyset, the time of each page is constant even for the big table
+	TableKeyset keyset = tableService->getTableKeyset(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName());
+	while (!keyset.isEnd) {
 		// Get data from source table 
-		DataList pageDataList = tableService->getTableWhereDataList(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), whereClause, page, perpage);
+		DataList pageDataList = tableService->getTableKeysetDataList(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), keyset, perpage, whereClause);
 
 		// Generate a sql statement for the page data list. and then execute the sql statement.
 		std::wstring sql = genderatePageDataSql(pageDataList, targetTblName);
@@ -57,10 +57,24 @@ private:
 	bool doExecSqlsInSameDb();
 	std::wstring generateCopyDataSqlInSameDb(uint16_t suffix, const std::wstring & targetTblName);
 
-	// same db
+	// other db
 	bool doExecSqlsInOtherDb();
 	bool doExecCopyDataSqlInOtherDb(uint16_t suffix, const std::wstring & targetTblName);
 
+	// other db - copy data by attaching the source db to the target db connection
+	typedef struct _CopyProgress {
+		HWND hwnd = nullptr;
+		int beginPercent = 0;
+		int endPercent = 0;
+		int percent = 0;
+		uint64_t ops = 0;
+		uint64_t estimatedOps = 0;
+	} CopyProgress;
+	bool attachSourceDb();
+	void detachSourceDb();
+	bool doBulkCopyDataInOtherDb(uint16_t suffix, const std::wstring & targetTblName, int beginPercent, int endPercent);
+	static int bulkCopyProgressHandler(void * arg);
+
 	// Preview sql functions
 	void doLoadTargetTableSqlToEditorForOtherDb(QHelpEdit * editorPtr);
 	bool doAppendCopyDataSqlToEditor(QHelpEdit * editorPtr, uint16_t suffix, const std::wstring & targetTblName);
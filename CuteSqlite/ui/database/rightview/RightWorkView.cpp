@@ -208,6 +208,17 @@ void RightWorkView::createOrShowExecButtons(CRect & clientRect)
 	}
 	QWinCreater::createOrShowButton(m_hWnd, explainQueryPlanButton, Config::DATABASE_EXPLAIN_QUREY_PLAN_BUTTON_ID, L"", rect, clientRect);
 	explainQueryPlanButton.SetToolTip(SNT(L"explain-query-plan-sql"));
+
+	rect.OffsetRect(w + 10, 0);
+	if (!stopSqlButton.IsWindow()) {
+		normalImagePath = imgDir + L"database\\button\\stop-sql-button-disabled.png";
+		pressedImagePath = imgDir + L"database\\button\\stop-sql-button-disabled.png";
+		stopSqlButton.SetIconPath(normalImagePath, pressedImagePath);
+		stopSqlButton.SetBkgColors(topbarColor ,topbarHoverColor, topbarColor);
+	}
+	QWinCreater::createOrShowButton(m_hWnd, stopSqlButton, Config::DATABASE_STOP_SQL_BUTTON_ID, L"", rect, clientRect);
+	stopSqlButton.SetToolTip(S(L"stop-sql"));
+	enableStopSqlButton();
 	
 	rect.OffsetRect(w + 40 , 0);
 	if (!queryButton.IsWindow()) {
@@ -467,6 +478,7 @@ int RightWorkView::OnCreate(LPCREATESTRUCT lpCreateStruct)
 	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_TABLE_PROPERTIES_ID);
 	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_TREEVIEW_CLICK_ID);
 	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_EXEC_SQL_RESULT_MESSAGE_ID);
+	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_QUERY_EXEC_STATE_ID);
 	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_DELETE_DATABASE_ID);
 
 	HINSTANCE ins = ModuleHelper::GetModuleInstance();
@@ -509,6 +521,7 @@ int RightWorkView::OnDestroy()
 	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_TABLE_PROPERTIES_ID);
 	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_TREEVIEW_CLICK_ID);
 	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_EXEC_SQL_RESULT_MESSAGE_ID);
+	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_QUERY_EXEC_STATE_ID);
 	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_DELETE_DATABASE_ID);
 	
 	if (!bkgBrush.IsNull()) bkgBrush.DeleteObject();
@@ -518,6 +531,7 @@ int RightWorkView::OnDestroy()
 	if (execSqlButton.IsWindow()) execSqlButton.DestroyWindow();
 	if (execAllButton.IsWindow()) execAllButton.DestroyWindow();
 	if (explainSqlButton.IsWindow()) explainSqlButton.DestroyWindow();
+	if (stopSqlButton.IsWindow()) stopSqlButton.DestroyWindow();
 	if (queryButton.IsWindow()) queryButton.DestroyWindow();
 	if (historyButton.IsWindow()) historyButton.DestroyWindow();
 	if (saveButton.IsWindow()) saveButton.DestroyWindow();
@@ -586,6 +600,8 @@ int RightWorkView::OnDestroy()
 		delete adapter;
 		adapter = nullptr;
 	}
+	// write the queued sql logs before clearing the old ones
+	sqlLogService->stopSqlLogWriter();
 	sqlLogService->clearOldSqlLog();
 	return 0;
 }
@@ -647,6 +663,12 @@ LRESULT RightWorkView::OnClickExplainQueryPlanButton(UINT uNotifyCode, int nID,
 	return 0;
 }
 
+LRESULT RightWorkView::OnClickStopSqlButton(UINT uNotifyCode, int nID, HWND hwnd)
+{
+	adapter->stopSql();
+	return 0;
+}
+
 LRESULT RightWorkView::OnClickQueryButton(UINT uNotifyCode, int nID, HWND hwnd)
 {
 	adapter->createNewQueryPage(getTabRect());
@@ -1051,8 +1073,8 @@ LRESULT RightWorkView::OnExecSqlResultMessage(UINT uMsg, WPARAM wParam, LPARAM l
 	}
 	runtimeResultInfo->createdAt = runtimeResultInfo->createdAt.empty()  ? 
 		DateUtil::getCurrentDateTime() : runtimeResultInfo->createdAt;
-	// save sql log to db
-	sqlLogService->createSqlLog(*runtimeResultInfo);
+	// save sql log to db in the sql log writer thread
+	sqlLogService->postSqlLog(*runtimeResultInfo);
 	return 0;
 }
 
@@ -1144,10 +1166,53 @@ LRESULT RightWorkView::OnTabViewPageActivated(int idCtrl, LPNMHDR pnmh, BOOL &bH
 	}
 	HWND hwndPage = tabView.GetPageHWND(nPage);
 	databaseSupplier->activeTabPageHwnd = hwndPage;
+	enableStopSqlButton();
+
+	return 0;
+}
 
+/**
+ * Handle the MSG_QUERY_EXEC_STATE_ID message that QueryPage starts or finishes executing the sql in the worker thread.
+ * 
+ * @param uMsg
+ * @param wParam - the QueryPage HWND
+ * @param lParam - 1 if the sql is executing
+ * @param bHandled
+ * @return 
+ */
+LRESULT RightWorkView::OnHandleQueryExecState(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled)
+{
+	enableStopSqlButton();
 	return 0;
 }
 
+/**
+ * The stop button is enabled when the active QueryPage is executing the sql.
+ */
+void RightWorkView::enableStopSqlButton()
+{
+	if (!stopSqlButton.IsWindow()) {
+		return;
+	}
+	bool enabled = adapter ? adapter->isActivePageExecRunning() : false;
+	bool origEnabled = stopSqlButton.IsWindowEnabled();
+	if (origEnabled == enabled) {
+		return;
+	}
+	std::wstring normalImagePath, pressedImagePath;
+	std::wstring imgDir = ResourceUtil::getProductImagesDir();
+	if (enabled) {
+		normalImagePath = imgDir + L"database\\button\\stop-sql-button-normal.png";
+		pressedImagePath = imgDir + L"database\\button\\stop-sql-button-pressed.png";
+	} else {
+		normalImagePath = imgDir + L"database\\button\\stop-sql-button-disabled.png";
+		pressedImagePath = imgDir + L"database\\button\\stop-sql-button-disabled.png";
+	}
+	stopSqlButton.SetIconPath(normalImagePath, pressedImagePath);
+	stopSqlButton.EnableWindow(enabled);
+	stopSqlButton.Invalidate(true);
+}
+
 LRESULT RightWorkView::OnTabViewCloseBtn(int idCtrl, LPNMHDR pnmh, BOOL &bHandled)
 {
 	int nPage = static_cast<int>(pnmh->idFrom);
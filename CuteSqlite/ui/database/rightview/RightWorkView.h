@@ -80,6 +80,7 @@ public:
 		COMMAND_ID_HANDLER_EX(Config::DATABASE_EXEC_ALL_BUTTON_ID, OnClickExecAllButton)
 		COMMAND_ID_HANDLER_EX(Config::DATABASE_EXPLAIN_SQL_BUTTON_ID, OnClickExplainSqlButton)
 		COMMAND_ID_HANDLER_EX(Config::DATABASE_EXPLAIN_QUREY_PLAN_BUTTON_ID, OnClickExplainQueryPlanButton)
+		COMMAND_ID_HANDLER_EX(Config::DATABASE_STOP_SQL_BUTTON_ID, OnClickStopSqlButton)
 		COMMAND_ID_HANDLER_EX(Config::DATABASE_QUERY_BUTTON_ID, OnClickQueryButton)
 		COMMAND_ID_HANDLER_EX(Config::DATABASE_HISTORY_BUTTON_ID, OnClickHistoryButton)
 		// save
@@ -119,6 +120,7 @@ public:
 		MESSAGE_HANDLER(Config::MSG_TABLE_STRUCTURE_DIRTY_ID, OnHandleTableStructureDirty)
 		MESSAGE_HANDLER(Config::MSG_TREEVIEW_CLICK_ID, OnChangeTreeviewItem)
 		MESSAGE_HANDLER(Config::MSG_EXEC_SQL_RESULT_MESSAGE_ID, OnExecSqlResultMessage)
+		MESSAGE_HANDLER(Config::MSG_QUERY_EXEC_STATE_ID, OnHandleQueryExecState)
 
 		MESSAGE_HANDLER(Config::MSG_DELETE_DATABASE_ID, OnDeleteDatabase)
 
@@ -155,6 +157,7 @@ private:
 	QImageButton execAllButton;
 	QImageButton explainSqlButton;
 	QImageButton explainQueryPlanButton;
+	QImageButton stopSqlButton;
 	QImageButton queryButton;
 	QImageButton historyButton;
 	QImageButton saveButton;
@@ -236,6 +239,7 @@ private:
 	LRESULT OnClickExecAllButton(UINT uNotifyCode, int nID, HWND hwnd);
 	LRESULT OnClickExplainSqlButton(UINT uNotifyCode, int nID, HWND hwnd);
 	LRESULT OnClickExplainQueryPlanButton(UINT uNotifyCode, int nID, HWND hwnd);
+	LRESULT OnClickStopSqlButton(UINT uNotifyCode, int nID, HWND hwnd);
 	LRESULT OnClickQueryButton(UINT uNotifyCode, int nID, HWND hwnd);
 	LRESULT OnClickHistoryButton(UINT uNotifyCode, int nID, HWND hwnd);
 	LRESULT OnClickSaveButton(UINT uNotifyCode, int nID, HWND hwnd);
@@ -289,6 +293,8 @@ private:
 	LRESULT OnDeleteDatabase(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
 
 	LRESULT OnTabViewPageActivated(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
+	LRESULT OnHandleQueryExecState(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled);
+	void enableStopSqlButton();
 	LRESULT OnTabViewCloseBtn(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 	LRESULT OnTabViewContextMenu(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 
@@ -95,6 +95,35 @@ void RightWorkViewAdapter::explainQueryPlanSql()
 	}
 }
 
+void RightWorkViewAdapter::stopSql()
+{
+	int nPage = tabView.GetActivePage();
+	if (nPage < 0) {
+		return ;
+	}
+	HWND activeHwnd = tabView.GetPageHWND(nPage);
+	for (auto pagePtr : queryPagePtrs) {
+		if (pagePtr && pagePtr->IsWindow () && activeHwnd == pagePtr->m_hWnd) {
+			pagePtr->cancelExec(); 
+		}		
+	}
+}
+
+bool RightWorkViewAdapter::isActivePageExecRunning()
+{
+	int nPage = tabView.GetActivePage();
+	if (nPage < 0) {
+		return false;
+	}
+	HWND activeHwnd = tabView.GetPageHWND(nPage);
+	for (auto pagePtr : queryPagePtrs) {
+		if (pagePtr && pagePtr->IsWindow () && activeHwnd == pagePtr->m_hWnd) {
+			return pagePtr->isExecRunning();
+		}		
+	}
+	return false;
+}
+
 void RightWorkViewAdapter::createFirstQueryPage(CRect & tabRect, bool isInitedPages)
 {
 	//queryPagePtrs.clear();
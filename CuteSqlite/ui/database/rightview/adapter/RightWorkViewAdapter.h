@@ -34,6 +34,8 @@ public:
 	void execAllSql();
 	void explainSelectedSql();
 	void explainQueryPlanSql();
+	void stopSql();
+	bool isActivePageExecRunning();
 	
 
 	void createFirstQueryPage(CRect & tabRect, bool isInitedPages);
@@ -86,60 +86,20 @@ void QueryPage::execAndShow(bool select)
 		sqlEditor.focus();
 		return;
 	}
+	if (executor.isRunning()) {
+		QPopAnimate::warn(m_hWnd, S(L"query-is-running"));
+		return;
+	}
 	if (supplier->getRuntimeUserDbId() != databaseSupplier->getSelectedUserDbId()) {
 		supplier->setRuntimeUserDbId(databaseSupplier->getSelectedUserDbId());
 	}
 	resultTabView.clearMessage();
 	if (supplier->getOperateType() == QUERY_DATA || supplier->getOperateType() == TABLE_DATA) {
-		supplier->splitToSqlVector(sqls);		
-		std::vector<std::wstring> & sqlVector = supplier->sqlVector;
-		int n = static_cast<int>(sqlVector.size());
-		int nSelectSqlCount = 0, nNotSelectSqlCount = 0;
-
-		// BEGIN a save point 
-		std::wstring spSql;
+		supplier->splitToSqlVector(sqls);
+		// BEGIN a save point if the sqls has not begun a transaction, COMMIT it if the sqls has not committed
 		bool hasBeginTransaction = StringUtil::startWith(sqls, L"BEGIN;", true);
-		if (!hasBeginTransaction) {
-			spSql = L"BEGIN;";
-			sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-		}
-		
-		bool hasError = false;
-		for (int i = 0; i < n; i++) {
-			auto sql = sqlVector.at(i);
-			if (SqlUtil::isSelectSql(sql) || SqlUtil::isPragmaStmt(sql, true)) {
-				resultTabView.addResultToListPage(sql, nSelectSqlCount+1);
-				nSelectSqlCount++;
-			} else {
-				nNotSelectSqlCount++;
-				bool ret = resultTabView.execSqlToInfoPage(sql);
-				if (!ret) {
-					hasError = true;
-					spSql = L"ROLLBACK;"; // ROLLBACK
-					sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);					
-					break;
-				}				
-			}
-		}
-		
-		if (nSelectSqlCount) {
-			// if the count of ptrs has more than nSelectSqlCount in ResultTabView object, Get gid of them.
-			resultTabView.removeResultListPageFrom(nSelectSqlCount);
-			resultTabView.setActivePage(0);
-		} else if (nNotSelectSqlCount){
-			resultTabView.activeResultInfoPage();
-		}
-		if (!hasError) {			
-			bool hasCommitTransaction = StringUtil::endWith(sqls, L"COMMIT;", true);
-			if (!hasCommitTransaction) {
-				spSql = L"COMMIT;"; // COMMIT TRANSACTION
-				sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-			}
-			
-			if (!nSelectSqlCount || nNotSelectSqlCount) {
-				QPopAnimate::success(m_hWnd, S(L"execute-sql-success"));
-			}			
-		}
+		bool hasCommitTransaction = StringUtil::endWith(sqls, L"COMMIT;", true);
+		execSqlVector(std::wstring(), !hasBeginTransaction, !hasCommitTransaction);
 	} else {
 		bool ret = resultTabView.execSqlToInfoPage(sqls);
 		if (ret) {
@@ -154,6 +114,16 @@ void QueryPage::execAndShow(bool select)
 }
 
 void QueryPage::explainAndShow()
+{
+	explainSqlVector(L"EXPLAIN ");
+}
+
+void QueryPage::explainQueryPlanAndShow()
+{
+	explainSqlVector(L"EXPLAIN QUERY PLAN ");
+}
+
+void QueryPage::explainSqlVector(const std::wstring & explainPrefix)
 {
 	std::wstring sqls;
 	
@@ -167,98 +137,87 @@ void QueryPage::explainAndShow()
 		sqlEditor.focus();
 		return;
 	}
+	if (executor.isRunning()) {
+		QPopAnimate::warn(m_hWnd, S(L"query-is-running"));
+		return;
+	}
 	if (supplier->getRuntimeUserDbId() != databaseSupplier->getSelectedUserDbId()) {
 		supplier->setRuntimeUserDbId(databaseSupplier->getSelectedUserDbId());
 	}
 	resultTabView.clearMessage();
 	if (supplier->getOperateType() == QUERY_DATA || supplier->getOperateType() == TABLE_DATA) {
-		supplier->splitToSqlVector(sqls);		
-		std::vector<std::wstring> & sqlVector = supplier->sqlVector;
-		int n = static_cast<int>(sqlVector.size());
-		int nSelectSqlCount = 0, nNotSelectSqlCount = 0;
-
-		// BEGIN a save point 
-		std::wstring spSql = L"BEGIN;";
-		sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-		bool hasError = false;
-		for (int i = 0; i < n; i++) {
-			auto sql = sqlVector.at(i);			
-			if (SqlUtil::isSelectSql(sql) || SqlUtil::isPragmaStmt(sql, true)) {
-				sql = L"EXPLAIN " + sql;
-				resultTabView.addResultToListPage(sql, nSelectSqlCount+1);
-				nSelectSqlCount++;
-			}
-		}
-		
-		if (nSelectSqlCount) {
-			// if the count of ptrs has more than nSelectSqlCount in ResultTabView object, Get gid of them.
-			resultTabView.removeResultListPageFrom(nSelectSqlCount);
-			resultTabView.setActivePage(0);
-		} else if (nNotSelectSqlCount){
-			resultTabView.activeResultInfoPage();
-		}
-		if (!hasError) {
-			spSql = L"COMMIT;"; // COMMIT TRANSACTION
-			sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-			if (!nSelectSqlCount || nNotSelectSqlCount) {
-				QPopAnimate::success(m_hWnd, S(L"execute-sql-success"));
-			}			
-		}
+		supplier->splitToSqlVector(sqls);
+		execSqlVector(explainPrefix, true, true);
 	}
 }
 
-void QueryPage::explainQueryPlanAndShow()
+/**
+ * Execute the supplier->sqlVector by the worker thread of executor, the results are shown when 
+ * the messages MSG_QUERY_EXEC_RESULT_ID/MSG_QUERY_EXEC_FINISHED_ID are received.
+ * 
+ * @param explainPrefix - "EXPLAIN " or "EXPLAIN QUERY PLAN ", only the select sql is explained, empty means execute all the sql
+ * @param isBegin - BEGIN a transaction before the sql
+ * @param isCommit - COMMIT the transaction after the sql
+ */
+void QueryPage::execSqlVector(const std::wstring & explainPrefix, bool isBegin, bool isCommit)
 {
-	std::wstring sqls;
-	
-	sqls = getSqlEditor().getSelText();
-	if (sqls.empty()) {
-		sqls = getSqlEditor().getText();
-	}
-	
-	if (sqls.empty()) {
-		QPopAnimate::warn(m_hWnd, S(L"no-sql-statement"));
-		sqlEditor.focus();
+	uint64_t userDbId = supplier->getRuntimeUserDbId();
+	std::wstring dbPath;
+	try {
+		dbPath = databaseService->getUserDb(userDbId).path;
+	} catch (QSqlExecuteException &ex) {
+		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
+		QPopAnimate::report(ex);
 		return;
 	}
-	if (supplier->getRuntimeUserDbId() != databaseSupplier->getSelectedUserDbId()) {
-		supplier->setRuntimeUserDbId(databaseSupplier->getSelectedUserDbId());
-	}
-	resultTabView.clearMessage();
-	if (supplier->getOperateType() == QUERY_DATA || supplier->getOperateType() == TABLE_DATA) {
-		supplier->splitToSqlVector(sqls);		
-		std::vector<std::wstring> & sqlVector = supplier->sqlVector;
-		int n = static_cast<int>(sqlVector.size());
-		int nSelectSqlCount = 0, nNotSelectSqlCount = 0;
-
-		// BEGIN a save point 
-		std::wstring spSql = L"BEGIN;";
-		sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-		bool hasError = false;
-		for (int i = 0; i < n; i++) {
-			auto sql = sqlVector.at(i);			
-			if (SqlUtil::isSelectSql(sql) || SqlUtil::isPragmaStmt(sql, true)) {
-				sql = L"EXPLAIN QUERY PLAN " + sql;
-				resultTabView.addResultToListPage(sql, nSelectSqlCount+1);
-				nSelectSqlCount++;
-			}
-		}
-		
-		if (nSelectSqlCount) {
-			// if the count of ptrs has more than nSelectSqlCount in ResultTabView object, Get gid of them.
-			resultTabView.removeResultListPageFrom(nSelectSqlCount);
-			resultTabView.setActivePage(0);
-		} else if (nNotSelectSqlCount){
-			resultTabView.activeResultInfoPage();
+
+	std::vector<QSqlExecStatement> statements;
+	execSelectSqlCount = 0;
+	execNotSelectSqlCount = 0;
+	for (auto & sql : supplier->sqlVector) {
+		QSqlExecStatement statement;
+		statement.isQuery = SqlUtil::isSelectSql(sql) || SqlUtil::isPragmaStmt(sql, true);
+		if (!explainPrefix.empty() && !statement.isQuery) {
+			continue;
 		}
-		if (!hasError) {
-			spSql = L"COMMIT;"; // COMMIT TRANSACTION
-			sqlService->executeSql(supplier->getRuntimeUserDbId(), spSql);
-			if (!nSelectSqlCount || nNotSelectSqlCount) {
-				QPopAnimate::success(m_hWnd, S(L"execute-sql-success"));
-			}			
+		if (statement.isQuery) {
+			statement.originSql = explainPrefix + sql;
+			statement.sql = ResultListPageAdapter::buildRuntimeSql(std::wstring(), statement.originSql);
+			statement.tabNo = ++execSelectSqlCount;
+		} else {
+			statement.originSql = sql;
+			statement.sql = sql;
+			execNotSelectSqlCount++;
 		}
+		statements.push_back(std::move(statement));
 	}
+	if (statements.empty()) {
+		return;
+	}
+
+	// if the count of ptrs has more than nSelectSqlCount in ResultTabView object, Get gid of them.
+	if (execSelectSqlCount) {
+		resultTabView.removeResultListPageFrom(execSelectSqlCount);
+	}
+	if (execNotSelectSqlCount) {
+		// the opened queries of the result list pages hold the SHARED lock, release them before writing
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(userDbId));
+	}
+	if (!executor.execute(m_hWnd, userDbId, dbPath, statements, isBegin, isCommit)) {
+		QPopAnimate::warn(m_hWnd, S(L"query-is-running"));
+		return;
+	}
+	AppContext::getInstance()->dispatch(Config::MSG_QUERY_EXEC_STATE_ID, WPARAM(m_hWnd), LPARAM(1));
+}
+
+void QueryPage::cancelExec()
+{
+	executor.cancel();
+}
+
+bool QueryPage::isExecRunning()
+{
+	return executor.isRunning();
 }
 
 void QueryPage::save()
@@ -380,6 +339,10 @@ int QueryPage::OnDestroy()
 {
 	AppContext::getInstance()->unsubscribe(m_hWnd,  Config::MSG_TREEVIEW_CLICK_ID);
 	AppContext::getInstance()->unsubscribe(m_hWnd,  Config::MSG_TREEVIEW_DBCLICK_ID);
+	if (executor.isRunning()) {
+		executor.cancel();
+		AppContext::getInstance()->dispatch(Config::MSG_QUERY_EXEC_STATE_ID, WPARAM(m_hWnd), LPARAM(0));
+	}
 
 	bool ret = QPage::OnDestroy();
 	if (sqlEditor.IsWindow()) sqlEditor.DestroyWindow();
@@ -394,6 +357,70 @@ int QueryPage::OnDestroy()
 	return ret;
 }
 
+/**
+ * Handle the MSG_QUERY_EXEC_RESULT_ID message that the worker thread of executor has executed a statement
+ * or fetched the first page of a query.
+ * 
+ * @param uMsg
+ * @param wParam - the execSeq
+ * @param lParam
+ * @param bHandled
+ * @return 
+ */
+LRESULT QueryPage::OnHandleQueryExecResult(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
+{
+	if (static_cast<uint32_t>(wParam) != executor.getExecSeq()) {
+		return 0;
+	}
+	QSqlExecResults results = executor.takeResults();
+	for (auto & result : results) {
+		ResultInfo resultInfo = result->resultInfo;
+		if (result->isQuery) {
+			int tabNo = result->tabNo;
+			std::wstring originSql = result->originSql;
+			resultTabView.addResultToListPage(originSql, tabNo, std::move(result));
+			if (tabNo == 1) {
+				resultTabView.setActivePage(0);
+			}
+		} else if (resultInfo.code && !result->isCanceled) {
+			QSqlExecuteException ex(std::to_wstring(resultInfo.code), resultInfo.msg, resultInfo.sql);
+			ex.setRollBack(true);
+			QPopAnimate::report(ex);
+		}
+		AppContext::getInstance()->dispatchForResponse(Config::MSG_EXEC_SQL_RESULT_MESSAGE_ID, WPARAM(m_hWnd), LPARAM(&resultInfo));
+	}
+	return 0;
+}
+
+/**
+ * Handle the MSG_QUERY_EXEC_FINISHED_ID message that the worker thread of executor has finished all the statements.
+ * 
+ * @param uMsg
+ * @param wParam - the execSeq
+ * @param lParam - QSqlExecStatus
+ * @param bHandled
+ * @return 
+ */
+LRESULT QueryPage::OnHandleQueryExecFinished(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
+{
+	if (static_cast<uint32_t>(wParam) != executor.getExecSeq()) {
+		return 0;
+	}
+	QSqlExecStatus status = static_cast<QSqlExecStatus>(lParam);
+	if (!execSelectSqlCount && execNotSelectSqlCount) {
+		resultTabView.activeResultInfoPage();
+	}
+	if (status == QSQL_EXEC_DONE) {
+		if (!execSelectSqlCount || execNotSelectSqlCount) {
+			QPopAnimate::success(m_hWnd, S(L"execute-sql-success"));
+		}
+	} else if (status == QSQL_EXEC_CANCELED) {
+		QPopAnimate::warn(m_hWnd, S(L"execute-sql-canceled"));
+	}
+	AppContext::getInstance()->dispatch(Config::MSG_QUERY_EXEC_STATE_ID, WPARAM(m_hWnd), LPARAM(0));
+	return 0;
+}
+
 LRESULT QueryPage::OnClickTreeview(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
 {
 	LeftTreeViewAdapter * treeViewAdapter = (LeftTreeViewAdapter *)wParam;
@@ -25,6 +25,7 @@
 #include "ui/common/edit/QHelpEdit.h"
 #include "ui/database/supplier/DatabaseSupplier.h"
 #include "ui/database/rightview/page/editor/QueryPageEditor.h"
+#include "core/common/repository/QSqlExecutor.h"
 
 class QueryPage : public QTabPage<QueryPageSupplier> {
 public:
@@ -37,6 +38,8 @@ public:
 		MSG_WM_DESTROY(OnDestroy)
 		MESSAGE_HANDLER(Config::MSG_TREEVIEW_CLICK_ID, OnClickTreeview)
 		MESSAGE_HANDLER(Config::MSG_TREEVIEW_DBCLICK_ID, OnDbClickTreeview)
+		MESSAGE_HANDLER(Config::MSG_QUERY_EXEC_RESULT_ID, OnHandleQueryExecResult)
+		MESSAGE_HANDLER(Config::MSG_QUERY_EXEC_FINISHED_ID, OnHandleQueryExecFinished)
 		CHAIN_MSG_MAP(QPage)
 		FORWARD_NOTIFICATIONS()
 	END_MSG_MAP()
@@ -49,6 +52,9 @@ public:
 	void explainAndShow();
 	void explainQueryPlanAndShow();
 	void save();
+	// interrupt the statements that are executing in the worker thread
+	void cancelExec();
+	bool isExecRunning();
 private:
 	std::wstring viewName;
 	std::wstring tplPath;
@@ -61,10 +67,18 @@ private:
 	CHorSplitterWindow splitter;// Horizontal splitter
 
 	SqlService * sqlService = SqlService::getInstance();
+	DatabaseService * databaseService = DatabaseService::getInstance();
+
+	// execute the sql in the worker thread
+	QSqlExecutor executor;
+	int execSelectSqlCount = 0;
+	int execNotSelectSqlCount = 0;
 
 	virtual void createOrShowUI();
 	virtual void loadWindow();
 	void loadSqlEditor();
+	void explainSqlVector(const std::wstring & explainPrefix);
+	void execSqlVector(const std::wstring & explainPrefix, bool isBegin, bool isCommit);
 
 	void createOrShowSplitter(CHorSplitterWindow & win, CRect & clientRect);
 	void createOrShowSqlEditor(QueryPageEditor & win, CRect & clientRect);
@@ -77,6 +91,8 @@ private:
 	LRESULT OnClickTreeview(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
 	// ˫LeftTreeView::treeViewѡ͸ϢշwParamΪCTreeViewCtrlEx *ָ, lParam HTREEITEMָ룬շͨlParamҪ
 	LRESULT OnDbClickTreeview(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);	
+	LRESULT OnHandleQueryExecResult(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
+	LRESULT OnHandleQueryExecFinished(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
 
 	
 };
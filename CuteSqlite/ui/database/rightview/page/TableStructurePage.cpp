@@ -28,6 +28,7 @@
 #include "core/common/exception/QSqlExecuteException.h"
 #include "ui/common/QWinCreater.h"
 #include "ui/common/message/QPopAnimate.h"
+#include "ui/common/message/QMessageBox.h"
 #include "ui/database/rightview/page/table/TableColumnsPage.h"
 #include "ui/database/rightview/page/table/TableIndexesPage.h"
 #include "ui/database/rightview/page/table/adapter/TableColumnsPageAdapter.h"
@@ -119,11 +120,20 @@ void TableStructurePage::save()
 	resultInfo.userDbId = userDbId;
 	resultInfo.createdAt = DateUtil::getCurrentDateTime();
 
-	auto _begin = PerformUtil::begin();
 	UserIndexList userIndexList;
+	AlterTablePlan alterPlan;
 	if (supplier->getOperateType() == MOD_TABLE) {
 		userIndexList= tableService->getUserIndexes(userDbId, tblName);
+		// the size of table is shown before rebuilding it, the user may cancel it
+		alterPlan = planAlterTable(schema, tblName);
+		if (alterPlan.type == ALTER_TABLE_REBUILD && !confirmRebuildTable(alterPlan, schema)) {
+			rebuildProgress.estimatedOps = 0;
+			return;
+		}
 	}
+	auto _begin = PerformUtil::begin();
+	// the opened queries of the result list pages block the DDL(SQLITE_LOCKED), such as dropping the table when rebuilding it
+	AppContext::getInstance()->dispatchForResponse(Config::MSG_RESULT_RELEASE_QUERY_ID, WPARAM(userDbId));
 	
 	// 2. Set the BEGIN TRANSACTION
 	std::wstring sql = L"BEGIN;";
@@ -139,9 +149,13 @@ void TableStructurePage::save()
 				tableService->execBySql(userDbId, sql);
 			}
 			QPopAnimate::success(m_hWnd, S(L"create-table-success-text"));
-		} else {
-			sql = execAlterTable(userIndexList);
+		} else if (execAlterTable(alterPlan, userIndexList, sql)) {
 			QPopAnimate::success(m_hWnd, S(L"alter-table-success-text"));
+		} else {
+			// the user cancels rebuilding the table after the native statements failed
+			sql = L"ROLLBACK;";
+			tableService->execBySql(userDbId, sql);
+			return;
 		}
 
 		// For sql log
@@ -202,6 +216,7 @@ void TableStructurePage::createOrShowUI()
 	createOrShowTableTabView(tableTabView, clientRect);
 	createOrShowSqlPreviewElems(clientRect);
 	createOrShowButtons(clientRect);
+	createOrShowRebuildProcessBar(rebuildProcessBar, clientRect);
 }
 
 
@@ -278,6 +293,21 @@ void TableStructurePage::createOrShowButtons(CRect & clientRect)
 // 	QWinCreater::createOrShowButton(m_hWnd, revertButton, Config::TABLE_REVERT_BUTTON_ID, S(L"revert"), rect, clientRect);
 }
 
+/**
+ * The process bar is shown on the left of save button only when rebuilding the table.
+ */
+void TableStructurePage::createOrShowRebuildProcessBar(QProcessBar & win, CRect & clientRect)
+{
+	int x = 20, y = clientRect.bottom - 45, w = clientRect.Width() - 40 - 120 - 20, h = 20;
+	CRect rect(x, y, x + w, y + h);
+	if (::IsWindow(m_hWnd) && !win.IsWindow()) {
+		win.Create(m_hWnd, rect, L"", WS_CHILD | WS_CLIPCHILDREN | WS_CLIPSIBLINGS, 0, 0);
+		return;
+	} else if (::IsWindow(m_hWnd) && (clientRect.bottom - clientRect.top) > 0) {
+		win.MoveWindow(&rect);
+	}
+}
+
 void TableStructurePage::loadWindow()
 {
 	if (!isNeedReload) {
@@ -391,6 +421,7 @@ int TableStructurePage::OnDestroy()
 	if (saveButton.IsWindow()) saveButton.DestroyWindow();
 	if (revertButton.IsWindow()) revertButton.DestroyWindow();
 	if (sqlPreviewEdit.IsWindow()) sqlPreviewEdit.DestroyWindow();
+	if (rebuildProcessBar.IsWindow()) rebuildProcessBar.DestroyWindow();
 
 	if (supplier) {
 		delete supplier;
@@ -596,7 +627,117 @@ std::vector<std::wstring> TableStructurePage::generateCreateIndexesDDL(const std
 	return tableTabView.getTableIndexesPage().getAdapter()->generateCreateIndexesDDL(schema, tblName);
 }
 
-std::wstring TableStructurePage::execAlterTable(UserIndexList & userIndexList)
+/**
+ * Diff the original and runtime columns, indexes and foreign keys, plan the native ALTER TABLE statements
+ * or rebuilding the table.
+ */
+AlterTablePlan TableStructurePage::planAlterTable(const std::wstring & schema, const std::wstring & tblName)
+{
+	AlterTablePlanner planner(schema, supplier->getRuntimeTblName(), tblName);
+	AlterTablePlan plan = planner.plan(supplier->getColsOrigDatas(), supplier->getColsRuntimeDatas(),
+		supplier->getIdxOrigDatas(), supplier->getIdxRuntimeDatas(),
+		supplier->getFrkOrigDatas(), supplier->getFrkRuntimeDatas());
+	if (plan.type == ALTER_TABLE_REBUILD) {
+		Q_INFO(L"alter table {} by rebuilding, reason:{}", tblName, plan.reason);
+	}
+	return plan;
+}
+
+/**
+ * Estimate the SQLite instructions of copying rows for the progress, every row takes about (columns + 8) instructions.
+ * The rows are estimated without scanning the table, the big table isn't counted on the UI thread before the confirm.
+ * 
+ * @return the estimated rows of table
+ */
+uint64_t TableStructurePage::estimateRebuildRows(const std::wstring & schema)
+{
+	uint64_t rows = tableService->getTableEstimatedDataCount(supplier->getRuntimeUserDbId(), supplier->getRuntimeTblName(), schema);
+	uint64_t columns = supplier->getColsOrigDatas().size();
+	rebuildProgress.estimatedOps = rows * (columns + 8);
+	return rows;
+}
+
+bool TableStructurePage::confirmRebuildTable(const AlterTablePlan & plan, const std::wstring & schema)
+{
+	uint64_t rows = estimateRebuildRows(schema);
+	std::wstring msg = StringUtil::replace(S(L"alter-table-rebuild-confirm-text"), std::wstring(L"{reason}"), plan.reason);
+	msg = StringUtil::replace(msg, std::wstring(L"{rows}"), std::to_wstring(rows));
+	return QMessageBox::confirm(m_hWnd, msg) == Config::CUSTOMER_FORM_YES_BUTTON_ID;
+}
+
+/**
+ * Alter the table by the plan, the native statements are executed in a save point,
+ * and the table is rebuilt if they fail, such as the dropped column is used by a view or trigger.
+ * The rebuilding is confirmed by the user like the plan of rebuilding.
+ * 
+ * @param plan - the plan of planAlterTable()
+ * @param userIndexList - the original indexes of table, dropped when rebuilding
+ * @param resultSql - [out] the executed sql
+ * @return false if the user cancels rebuilding the table
+ */
+bool TableStructurePage::execAlterTable(const AlterTablePlan & plan, UserIndexList & userIndexList, std::wstring & resultSql)
+{
+	resultSql.clear();
+	if (plan.type == ALTER_TABLE_NONE) {
+		return true;
+	}
+	if (plan.type == ALTER_TABLE_NATIVE) {
+		std::wstring error;
+		if (execNativeAlterTable(plan, resultSql, error)) {
+			return true;
+		}
+		CString str;
+		schemaComboBox.GetWindowText(str);
+		AlterTablePlan rebuildPlan = plan;
+		rebuildPlan.type = ALTER_TABLE_REBUILD;
+		rebuildPlan.reason = StringUtil::replace(S(L"alter-table-rebuild-native-failed"), std::wstring(L"{error}"), error);
+		if (!confirmRebuildTable(rebuildPlan, str.GetString())) {
+			rebuildProgress.estimatedOps = 0;
+			return false;
+		}
+	}
+	resultSql = execRebuildTable(userIndexList);
+	return true;
+}
+
+bool TableStructurePage::execNativeAlterTable(const AlterTablePlan & plan, std::wstring & resultSql, std::wstring & error)
+{
+	CString str;
+	tblNameEdit.GetWindowText(str);
+	std::wstring tblName(str.GetString());
+	schemaComboBox.GetWindowText(str);
+	std::wstring schema(str.GetString());
+	uint64_t userDbId = supplier->getRuntimeUserDbId();
+
+	std::wstring savePoint = SavePointUtil::create(L"alter_table");
+	tableService->execBySql(userDbId, L"SAVEPOINT \"" + savePoint + L"\";");
+	std::wstring sql;
+	try {
+		for (auto & planSql : plan.sqls) {
+			sql = planSql;
+			tableService->execBySql(userDbId, sql);
+			resultSql.append(sql).append(lbrk);
+		}
+		auto adapter = tableTabView.getTableIndexesPage().getAdapter();
+		for (auto & item : plan.createIndexes) {
+			sql.clear();
+			adapter->generateOneCreateIndexDDL(item, schema, tblName, sql);
+			tableService->execBySql(userDbId, sql);
+			resultSql.append(sql).append(lbrk);
+		}
+		tableService->execBySql(userDbId, L"RELEASE \"" + savePoint + L"\";");
+		return true;
+	} catch (QSqlExecuteException & ex) {
+		Q_WARN(L"alter table has error:{}, msg:{}, sql:{}, rebuild the table instead", ex.getCode(), ex.getMsg(), sql);
+		tableService->execBySql(userDbId, L"ROLLBACK TO \"" + savePoint + L"\";");
+		tableService->execBySql(userDbId, L"RELEASE \"" + savePoint + L"\";");
+		resultSql.clear();
+		error = ex.getMsg();
+		return false;
+	}
+}
+
+std::wstring TableStructurePage::execRebuildTable(UserIndexList & userIndexList)
 {
 	CString str;
 	tblNameEdit.GetWindowText(str);
@@ -635,9 +776,26 @@ std::wstring TableStructurePage::execAlterTable(UserIndexList & userIndexList)
 		tableService->execBySql(userDbId, sql);
 		resultSql.append(sql).append(lbrk);
 
-		// 3.Generate sql for insert into tmp table with select data from old table
+		// 3.Generate sql for insert into tmp table with select data from old table, the rows may be huge, so show the progress
 		sql = generateInsertIntoTmpTableSql(schema, tmpTblName, oldTblName);
-		tableService->execBySql(userDbId, sql);
+		if (!rebuildProgress.estimatedOps) {
+			estimateRebuildRows(schema);
+		}
+		rebuildProgress.processBar = &rebuildProcessBar;
+		rebuildProgress.percent = 0;
+		rebuildProgress.ops = 0;
+		rebuildProcessBar.reset();
+		rebuildProcessBar.ShowWindow(SW_SHOW);
+		rebuildProcessBar.UpdateWindow();
+		try {
+			tableService->execBySqlWithProgress(userDbId, sql, &TableStructurePage::rebuildProgressHandler, &rebuildProgress);
+		} catch (QSqlExecuteException & ex) {
+			rebuildProcessBar.ShowWindow(SW_HIDE);
+			rebuildProgress.estimatedOps = 0;
+			throw ex;
+		}
+		rebuildProcessBar.ShowWindow(SW_HIDE);
+		rebuildProgress.estimatedOps = 0;
 		resultSql.append(sql).append(lbrk);
 
 		// 4.Drop old table
@@ -678,9 +836,33 @@ std::wstring TableStructurePage::execAlterTable(UserIndexList & userIndexList)
 	return resultSql;
 }
 
+/**
+ * The progress handler of SQLite when copying rows to the tmp table, the UI thread is executing the sql,
+ * so the process bar is painted at once.
+ * 
+ * @param arg - RebuildProgress pointer
+ * @return 0 - continue to copy
+ */
+int TableStructurePage::rebuildProgressHandler(void * arg)
+{
+	RebuildProgress * progress = static_cast<RebuildProgress *>(arg);
+	if (!progress->estimatedOps || !progress->processBar) {
+		return 0;
+	}
+	progress->ops += TABLE_COPY_PROGRESS_OPS;
+	int percent = static_cast<int>(100 * progress->ops / progress->estimatedOps);
+	percent = (std::min)(percent, 99);
+	if (percent > progress->percent) {
+		progress->percent = percent;
+		progress->processBar->run(percent);
+		progress->processBar->UpdateWindow();
+	}
+	return 0;
+}
+
 /**
  * Generate the sql for insert into tmp table, and then exec this sql to copy data from old table to tmp table
- * This function will be called by alter table(function : execAlterTable)
+ * This function will be called by alter table(function : execRebuildTable)
  * 
  * 
  * @param schema
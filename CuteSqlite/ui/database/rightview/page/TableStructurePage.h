@@ -23,8 +23,10 @@
 #include "ui/database/rightview/common/QTabPage.h"
 #include "ui/database/rightview/page/result/ResultTabView.h"
 #include "ui/common/edit/QHelpEdit.h"
+#include "ui/common/process/QProcessBar.h"
 #include "ui/database/rightview/page/table/TableTabView.h"
 #include "ui/database/rightview/page/supplier/TableStructureSupplier.h"
+#include "utils/AlterTablePlanner.h"
 
 class TableStructurePage : public QTabPage<TableStructureSupplier> {
 public:
@@ -76,6 +78,16 @@ private:
 	QImageButton revertButton;
 
 	QHelpEdit sqlPreviewEdit;
+	QProcessBar rebuildProcessBar;
+
+	// the progress of copying rows when rebuilding table
+	typedef struct _RebuildProgress {
+		QProcessBar * processBar = nullptr;
+		int percent = 0;
+		uint64_t ops = 0;
+		uint64_t estimatedOps = 0;
+	} RebuildProgress;
+	RebuildProgress rebuildProgress;
 
 	DatabaseService * databaseService = DatabaseService::getInstance();
 	TableService * tableService = TableService::getInstance();
@@ -89,6 +101,7 @@ private:
 	void createOrShowTableTabView(TableTabView & win, CRect & clientRect);
 	void createOrShowSqlPreviewElems(CRect & clientRect);
 	void createOrShowButtons(CRect & clientRect);
+	void createOrShowRebuildProcessBar(QProcessBar & win, CRect & clientRect);
 	void createOrShowSqlEditor(QHelpEdit & win, UINT id, const std::wstring & text, CRect & rect, CRect & clientRect, DWORD exStyle = 0);
 
 	virtual void loadWindow();
@@ -116,7 +129,13 @@ private:
 	std::wstring generateCreateTableDDL(const std::wstring &schema, const std::wstring & tblName);
 	std::vector<std::wstring> generateCreateIndexesDDL(const std::wstring &schema, const std::wstring & tblName);
 
-	std::wstring execAlterTable(UserIndexList & userIndexList);
+	AlterTablePlan planAlterTable(const std::wstring & schema, const std::wstring & tblName);
+	uint64_t estimateRebuildRows(const std::wstring & schema);
+	bool confirmRebuildTable(const AlterTablePlan & plan, const std::wstring & schema);
+	bool execAlterTable(const AlterTablePlan & plan, UserIndexList & userIndexList, std::wstring & resultSql);
+	bool execNativeAlterTable(const AlterTablePlan & plan, std::wstring & resultSql, std::wstring & error);
+	std::wstring execRebuildTable(UserIndexList & userIndexList);
+	static int rebuildProgressHandler(void * arg);
 
 	std::wstring generateCreateColumnsClause();
 	std::wstring generateConstraintsClause();	
@@ -80,17 +80,24 @@ int ResultInfoPage::OnDestroy()
 LRESULT ResultInfoPage::OnExecSqlResultMessage(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled)
 {
 	auto runtimeResultInfo = (ResultInfo *)lParam;
-	return addResultInfo(runtimeResultInfo);
+	return addResultInfo(runtimeResultInfo, (HWND)wParam);
 }
 
-LRESULT ResultInfoPage::addResultInfo(ResultInfo * runtimeResultInfo)
+/**
+ * Add the result info to the info editor.
+ * 
+ * @param runtimeResultInfo - the result info
+ * @param queryPageHwnd - the query page that executed the sql, nullptr means the active query page
+ * @return 
+ */
+LRESULT ResultInfoPage::addResultInfo(ResultInfo * runtimeResultInfo, HWND queryPageHwnd)
 {
 	if (runtimeResultInfo == nullptr) {
 		return 0;
 	}
 	// class chain : ResultInfoPage($this)->QTabView(tabView)->ResultTabView->CHorSplitterWindow->QueryPage
 	HWND pHwnd = GetParent().GetParent().GetParent().GetParent(); // current query page hwnd
-	if (databaseSupplier->activeTabPageHwnd != pHwnd) {
+	if (queryPageHwnd ? queryPageHwnd != pHwnd : databaseSupplier->activeTabPageHwnd != pHwnd) {
 		return 0;
 	}
 
@@ -36,7 +36,7 @@ public:
 		REFLECT_NOTIFICATIONS()
 	END_MSG_MAP()
 	void setup(QueryPageSupplier * supplier);
-	LRESULT addResultInfo(ResultInfo * runtimeResultInfo);
+	LRESULT addResultInfo(ResultInfo * runtimeResultInfo, HWND queryPageHwnd = nullptr);
 	void clear();
 protected:
 	HFONT textFont = nullptr;
@@ -23,6 +23,7 @@
 #include "utils/SqlUtil.h"
 #include "utils/PerformUtil.h"
 #include "core/common/Lang.h"
+#include "common/AppContext.h"
 #include "ui/common/message/QPopAnimate.h"
 #include "ui/common/message/QMessageBox.h"
 #include "ui/common/QWinCreater.h" 
@@ -70,6 +71,24 @@ void ResultListPage::setup(QueryPageSupplier * supplier, std::wstring & sql)
 	this->sql = sql;
 }
 
+void ResultListPage::setup(QueryPageSupplier * supplier, std::wstring & sql, std::unique_ptr<QSqlExecResult> execResult)
+{
+	this->supplier = supplier;
+	this->sql = sql;
+	this->execResult = std::move(execResult);
+}
+
+void ResultListPage::loadExecResult(std::unique_ptr<QSqlExecResult> execResult)
+{
+	this->execResult = std::move(execResult);
+	if (!IsWindow() || isNeedReload) {
+		// load in loadWindow() when the page is shown
+		isNeedReload = true;
+		return;
+	}
+	loadListView();
+}
+
 void ResultListPage::createOrShowUI()
 {
 	QPage::createOrShowUI();
@@ -224,6 +243,19 @@ void ResultListPage::loadWindow()
 
 void ResultListPage::loadListView()
 {
+	if (execResult) {
+		// the query has been executed by QSqlExecutor of QueryPage, which sends the exec sql message
+		std::unique_ptr<QSqlExecResult> result = std::move(execResult);
+		try {
+			rowCount = adapter->loadListView(result->resultInfo.userDbId, sql, *result);
+		} catch (QSqlExecuteException &ex) {
+			QPopAnimate::report(ex);
+			rowCount = 0;
+		}
+		displayStatusBarPanels(adapter->getRuntimeResultInfo(), false);
+		return;
+	}
+
 	uint64_t userDbId = databaseSupplier->getSelectedUserDbId();
 	if (!userDbId) {
 		QPopAnimate::warn(m_hWnd, S(L"no-select-userdb"));
@@ -487,6 +519,7 @@ void ResultListPage::changeFilterButtonStatus(bool hasRedIcon)
 int ResultListPage::OnCreate(LPCREATESTRUCT lpCreateStruct)
 {
 	bool ret = QPage::OnCreate(lpCreateStruct);
+	AppContext::getInstance()->subscribe(m_hWnd, Config::MSG_RESULT_RELEASE_QUERY_ID);
 
 	HINSTANCE ins = ModuleHelper::GetModuleInstance();
 	m_hAccel = ::LoadAccelerators(ins, MAKEINTRESOURCE(RESULT_LIST_PAGE_ACCEL));
@@ -499,6 +532,7 @@ int ResultListPage::OnCreate(LPCREATESTRUCT lpCreateStruct)
 int ResultListPage::OnDestroy()
 {
 	bool ret = QPage::OnDestroy();
+	AppContext::getInstance()->unsubscribe(m_hWnd, Config::MSG_RESULT_RELEASE_QUERY_ID);
 	if (textFont) ::DeleteObject(textFont);
 
 	if (exportButton.IsWindow()) exportButton.DestroyWindow();
@@ -566,6 +600,7 @@ LRESULT ResultListPage::OnGetListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHandl
 LRESULT ResultListPage::OnPrepareListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHandled)
 {
 	auto pCachehint = (NMLVCACHEHINT *)pnmh;
+	adapter->prepareRuntimeData(pCachehint->iFrom, pCachehint->iTo);
 	return 0;
 }
 
@@ -584,6 +619,76 @@ LRESULT ResultListPage::OnFindListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHand
 	return 0;
 }
 
+/**
+ * Handle the MSG_RESULT_ROWS_CHANGE_ID message that adapter fetched more rows from the opened query.
+ * 
+ * @param uMsg
+ * @param wParam - the fetched rows
+ * @param lParam - 1 if all rows fetched
+ * @param bHandled
+ * @return 
+ */
+LRESULT ResultListPage::OnHandleResultRowsChange(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled)
+{
+	rowCount = static_cast<int>(wParam);
+	if (statusBar.IsWindow()) {
+		displayResultRows();
+	}
+	return 0;
+}
+
+/**
+ * Handle the MSG_RESULT_RELEASE_QUERY_ID message that the statements will be executed by the worker connection or the DDL will be executed,
+ * release the opened query, so the query will not block the writing statements or the DDL, the remain rows are fetched by reopening the query.
+ * 
+ * @param uMsg
+ * @param wParam - the user db id
+ * @param lParam
+ * @param bHandled
+ * @return 
+ */
+LRESULT ResultListPage::OnHandleResultReleaseQuery(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled)
+{
+	if (adapter && adapter->getRuntimeUserDbId() == static_cast<uint64_t>(wParam)) {
+		adapter->releaseRuntimeQuery();
+	}
+	return 0;
+}
+
+/**
+ * Handle the MSG_RESULT_FETCHED_ID message that the worker thread of QSqlExecutor has fetched the rows of the opened query.
+ * 
+ * @param uMsg
+ * @param wParam - the sequence of the fetch
+ * @param lParam
+ * @param bHandled
+ * @return 
+ */
+LRESULT ResultListPage::OnHandleResultFetched(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled)
+{
+	if (adapter) {
+		adapter->finishFetchRuntimeData(static_cast<uint32_t>(wParam));
+	}
+	return 0;
+}
+
+/**
+ * Handle the MSG_RESULT_SORTED_ID message that the worker thread of adapter has sorted the rows.
+ * 
+ * @param uMsg
+ * @param wParam - the sequence of the sort
+ * @param lParam
+ * @param bHandled
+ * @return 
+ */
+LRESULT ResultListPage::OnHandleResultSorted(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled)
+{
+	if (adapter) {
+		adapter->finishSortRuntimeDatas(static_cast<uint32_t>(wParam));
+	}
+	return 0;
+}
+
 /**
  * Click the header.
  * Refrence:https://learn.microsoft.com/zh-cn/windows/win32/controls/hdn-itemclick
@@ -787,9 +892,11 @@ HBRUSH ResultListPage::OnCtlColorEdit(HDC hdc, HWND hwnd)
 }
 
 
-void ResultListPage::displayStatusBarPanels(ResultInfo & resultInfo)
+void ResultListPage::displayStatusBarPanels(ResultInfo & resultInfo, bool isSendMessage)
 {
-	adapter->sendExecSqlMessage(resultInfo);
+	if (isSendMessage) {
+		adapter->sendExecSqlMessage(resultInfo);
+	}
 	displayRuntimeSql();
 	displayDatabase();
 	displayResultRows();
@@ -818,7 +925,12 @@ void ResultListPage::displayDatabase()
 void ResultListPage::displayResultRows()
 {
 	CString resultRows;
-	resultRows.Format(L"%d rows", rowCount);
+	if (adapter->hasMoreRuntimeData()) {
+		// the total rows is unknown until all the rows of the query have been fetched
+		resultRows.Format(L"%d+ rows", rowCount);
+	} else {
+		resultRows.Format(L"%d rows", rowCount);
+	}
 	statusBar.SetPaneText(Config::RESULT_STATUSBAR_ROWS_PANE_ID, resultRows);
 }
 
@@ -40,6 +40,10 @@ public:
 	BEGIN_MSG_MAP_EX(ResultListPage)
 		MSG_WM_CREATE(OnCreate)
 		MSG_WM_DESTROY(OnDestroy)
+		MESSAGE_HANDLER(Config::MSG_RESULT_ROWS_CHANGE_ID, OnHandleResultRowsChange)
+		MESSAGE_HANDLER(Config::MSG_RESULT_SORTED_ID, OnHandleResultSorted)
+		MESSAGE_HANDLER(Config::MSG_RESULT_RELEASE_QUERY_ID, OnHandleResultReleaseQuery)
+		MESSAGE_HANDLER(Config::MSG_RESULT_FETCHED_ID, OnHandleResultFetched)
 		NOTIFY_HANDLER(Config::DATABASE_QUERY_LISTVIEW_ID, NM_CLICK, OnClickListView)
 		NOTIFY_HANDLER(Config::DATABASE_QUERY_LISTVIEW_ID, NM_RCLICK, OnRightClickListView)
 		NOTIFY_HANDLER(Config::DATABASE_QUERY_LISTVIEW_ID, LVN_ITEMCHANGED, OnListViewItemChange)
@@ -67,11 +71,16 @@ public:
 	END_MSG_MAP()
 
 	virtual void setup(QueryPageSupplier * supplier, std::wstring & sql);
+	// setup with the result that the query has been executed by QSqlExecutor
+	void setup(QueryPageSupplier * supplier, std::wstring & sql, std::unique_ptr<QSqlExecResult> execResult);
+	// load the result of QSqlExecutor, the remain rows of the query are fetched on demand
+	void loadExecResult(std::unique_ptr<QSqlExecResult> execResult);
 	void loadListView();
 protected:
 	bool isNeedReload = true;
 	std::wstring sql;
 	int rowCount = 0;
+	std::unique_ptr<QSqlExecResult> execResult; // the pending result of QSqlExecutor, loaded in loadListView()
 	std::wstring settingPrefix;
 
 	COLORREF buttonColor = RGB(238, 238, 238);
@@ -135,6 +144,10 @@ protected:
 	LRESULT OnGetListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 	LRESULT OnPrepareListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 	LRESULT OnFindListViewData(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
+	LRESULT OnHandleResultRowsChange(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled);
+	LRESULT OnHandleResultSorted(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled);
+	LRESULT OnHandleResultReleaseQuery(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled);
+	LRESULT OnHandleResultFetched(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL &bHandled);
 	virtual LRESULT OnClickListViewHeader(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 	LRESULT OnListViewItemChange(int idCtrl, LPNMHDR pnmh, BOOL &bHandled);
 
@@ -158,7 +171,7 @@ protected:
 	void changeFilterButtonStatus(bool hasRedIcon);
 
 	// display the result rows and exec time in the status bar
-	void displayStatusBarPanels(ResultInfo & resultInfo);
+	void displayStatusBarPanels(ResultInfo & resultInfo, bool isSendMessage = true);
 	void displayRuntimeSql();
 	void displayDatabase();
 	void displayResultRows();
@@ -180,6 +180,50 @@ ResultListPage * ResultTabView::addResultToListPage(std::wstring & sql, int tabN
 	return resultListPagePtr;
 }
 
+/**
+ * Show the result that the query has been executed by QSqlExecutor in the result list page of tabNo.
+ * 
+ * @param sql - the origin sql
+ * @param tabNo - the tab no, begin from 1
+ * @param execResult - the executed result
+ * @return the result list page
+ */
+ResultListPage * ResultTabView::addResultToListPage(std::wstring & sql, int tabNo, std::unique_ptr<QSqlExecResult> execResult)
+{
+	CRect clientRect;
+	GetClientRect(clientRect);
+	CRect pageRect = getPageRect(clientRect);
+	int x = 1, y = pageRect.top, w = pageRect.Width() - 2, h = pageRect.Height();
+	CRect rect(x, y, x + w, y + h);
+
+	ResultListPage * resultListPagePtr = nullptr;
+	int n = static_cast<int>(resultListPagePtrs.size());
+	if (tabNo-1 < n) {
+		resultListPagePtr = resultListPagePtrs.at(tabNo -1);
+		resultListPagePtr->setup(supplier, sql);
+		resultListPagePtr->loadExecResult(std::move(execResult));
+	} else {
+		resultListPagePtr = new ResultListPage();
+		resultListPagePtr->setup(supplier, sql, std::move(execResult));
+		resultListPagePtr->Create(tabView.m_hWnd, rect, NULL, WS_CHILD | WS_VISIBLE | WS_CLIPSIBLINGS | WS_CLIPCHILDREN, 0);
+		std::wstring pageTitle = S(L"result-list").append(L" ").append(std::to_wstring(tabNo));
+		int nInsert = static_cast<int>(resultListPagePtrs.size());
+		tabView.InsertPage(nInsert, resultListPagePtr->m_hWnd, pageTitle.c_str(), 0, resultListPagePtr);
+		resultListPagePtrs.push_back(resultListPagePtr);
+	}
+	
+	resultListPagePtr->MoveWindow(rect);
+	resultListPagePtr->ShowWindow(SW_SHOW);
+	return resultListPagePtr;
+}
+
+ResultListPage * ResultTabView::getResultListPage(int tabNo)
+{
+	if (tabNo < 1 || tabNo > static_cast<int>(resultListPagePtrs.size())) {
+		return nullptr;
+	}
+	return resultListPagePtrs.at(tabNo - 1);
+}
 
 void ResultTabView::removeResultListPageFrom(int nSelectSqlCount)
 {
@@ -56,6 +56,8 @@ public:
 	void clearResultListPage();
 	void clearMessage();
 	ResultListPage * addResultToListPage(std::wstring & sql, int tabNo);	
+	ResultListPage * addResultToListPage(std::wstring & sql, int tabNo, std::unique_ptr<QSqlExecResult> execResult);
+	ResultListPage * getResultListPage(int tabNo);
 	void removeResultListPageFrom(int nSelectSqlCount);
 
 	bool execSqlToInfoPage(const std::wstring & sql);
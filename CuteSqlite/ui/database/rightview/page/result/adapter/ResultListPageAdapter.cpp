@@ -1,6 +1,9 @@
 #include "stdafx.h"
 #include "ResultListPageAdapter.h"
 #include <algorithm>
+#include <map>
+#include <unordered_set>
+#include <unordered_map>
 #include <Strsafe.h>
 #include <CommCtrl.h>
 #include "common/AppContext.h"
@@ -12,6 +15,7 @@
 #include "utils/SqlUtil.h"
 #include "utils/ClipboardUtil.h"
 #include "utils/PerformUtil.h"
+#include <thread>
 #include <utils/SavePointUtil.h>
 
 ResultListPageAdapter::ResultListPageAdapter(HWND parentHwnd, QListViewCtrl * listView, ResultType resultType)
@@ -26,7 +30,7 @@ ResultListPageAdapter::ResultListPageAdapter(HWND parentHwnd, QListViewCtrl * li
 
 ResultListPageAdapter::~ResultListPageAdapter()
 {
-
+	closeRuntimeQuery();
 }
 
 int ResultListPageAdapter::loadListView(uint64_t userDbId, std::wstring & sql)
@@ -38,6 +42,8 @@ int ResultListPageAdapter::loadListView(uint64_t userDbId, std::wstring & sql)
 	dataView->DeleteAllItems();
 	dataView->clearChangeVals();
 	dataView->destroySubItemElems();
+	closeRuntimeQuery();
+	runtimeSorter.reset();
 	runtimeTables.clear();
 	runtimeDatas.clear();
 	runtimeColumns.clear();
@@ -53,21 +59,19 @@ int ResultListPageAdapter::loadListView(uint64_t userDbId, std::wstring & sql)
 		return 0;
 	}
 
-	if (!SqlUtil::isPragmaStmt(originSql, false) && !SqlUtil::hasLimitClause(originSql)) {
-		LimitParams limitParams;
-		loadLimitParams(limitParams);
-		if (limitParams.checked) {
-			runtimeSql.append(L" LIMIT ").append(std::to_wstring(limitParams.rows))
-				.append(L" OFFSET ").append(std::to_wstring(limitParams.offset));
-		}		
-	}
+	runtimeSql = buildRuntimeSql(settingPrefix, originSql);
 	runtimeResultInfo.userDbId = userDbId;
 	runtimeResultInfo.sql = runtimeSql;
 	auto bt = PerformUtil::begin();
 	try {		
 		QSqlStatement query = sqlService->tryExecuteSql(userDbId, runtimeSql);
 		loadRuntimeTables(userDbId, runtimeSql); 
-		loadRuntimeHeader(query);
+		Columns columns;
+		int nCols = query.getColumnCount();
+		for (int i = 0; i < nCols; i++) {
+			columns.push_back(query.getColumnName(i));
+		}
+		loadRuntimeHeader(columns);
 		int effectRows = loadRuntimeData(query);
 		runtimeResultInfo.execTime = PerformUtil::end(bt);
 		runtimeResultInfo.effectRows = effectRows;	
@@ -87,11 +91,67 @@ int ResultListPageAdapter::loadListView(uint64_t userDbId, std::wstring & sql)
 	return 0;
 }
 
+/**
+ * Load the result of the query that has been executed by QSqlExecutor in the worker thread,
+ * the first page has been fetched, if the query has more rows, it is kept opened by the executor, 
+ * the next page is fetched by the worker thread of the executor when the list view scrolls to the end.
+ * 
+ * @param userDbId - the user db id
+ * @param sql - the origin sql
+ * @param execResult - [in/out] the executed result, the columns and datas are moved to the adapter
+ * @return the rows
+ */
+int ResultListPageAdapter::loadListView(uint64_t userDbId, std::wstring & sql, QSqlExecResult & execResult)
+{
+	int nCols = static_cast<int>(runtimeColumns.size());
+	for (int i = nCols; i >=0 ; i--) {
+		dataView->DeleteColumn(i);
+	}
+	dataView->DeleteAllItems();
+	dataView->clearChangeVals();
+	dataView->destroySubItemElems();
+	closeRuntimeQuery();
+	runtimeSorter.reset();
+	runtimeTables.clear();
+	runtimeDatas.clear();
+	runtimeColumns.clear();
+	runtimeFilters.clear();
+	runtimeNewRows.clear();
+	resetRuntimeResultInfo();
+
+	runtimeUserDbId = userDbId;
+	originSql = sql;
+	runtimeSql = execResult.resultInfo.sql;
+	runtimeResultInfo = execResult.resultInfo;
+	if (runtimeResultInfo.code != 0) {
+		throw QSqlExecuteException(std::to_wstring(runtimeResultInfo.code), runtimeResultInfo.msg, runtimeSql);
+	}
+	if (runtimeSql.empty()) {
+		return 0;
+	}
+
+	loadRuntimeTables(userDbId, runtimeSql);
+	loadRuntimeHeader(execResult.columns);
+	runtimeDatas = std::move(execResult.datas);
+	int nRow = static_cast<int>(runtimeDatas.size());
+	runtimeFetchedRows = nRow;
+	runtimeHasMore = execResult.hasMore;
+	if (execResult.hasMore) {
+		runtimeExecutor = execResult.executor;
+		runtimeCursorId = execResult.cursorId;
+	}
+	dataView->SetItemCount(nRow);
+	dataView->changeAllItemsCheckState();
+	return nRow;
+}
+
 int ResultListPageAdapter::loadFilterListView()
 {
 	dataView->DeleteAllItems();
 	dataView->clearChangeVals();
 	dataView->destroySubItemElems();
+	closeRuntimeQuery();
+	runtimeSorter.reset();
 	runtimeTables.clear();
 	runtimeDatas.clear();
 	runtimeNewRows.clear();
@@ -166,10 +226,15 @@ bool ResultListPageAdapter::sortListView(int iSelItem)
 	}
 	headerCtrl.SetItem(iSelItem, &headerItem);
 		
-	// 4.sort the runtime datas	
-	sortRuntimeDatas(iSelItem - 1, down);
-
-	dataView->Invalidate(true);
+	// 4.sort the runtime datas, the rowid column is hidden in the list view
+	int index = (resultType == QUERY_TABLE_DATA || runtimeColumns.at(0) == L"_ct_sqlite_rowid") ? iSelItem : iSelItem - 1;
+	if (isSortRuntimeDatasInDb(index)) {
+		sortRuntimeDatasInDb(index, down);
+		return true;
+	}
+	if (sortRuntimeDatas(index, down)) {
+		dataView->Invalidate(true);
+	}
 	return true;
 }
 
@@ -185,7 +250,7 @@ LRESULT ResultListPageAdapter::fillDataInListViewSubItem(NMLVDISPINFO * pLvdi)
 	if (-1 == iItem)
 		return 0;
 
-	auto count = static_cast<int>(runtimeDatas.size());
+	auto count = getRuntimeItemCount();
 	if (!count || count <= iItem)
 		return 0;
 
@@ -205,19 +270,20 @@ LRESULT ResultListPageAdapter::fillDataInListViewSubItem(NMLVDISPINFO * pLvdi)
 		return 0;
 	}
 
-	auto iter = runtimeDatas.begin();
-	for (int i = 1; i < iItem + 1; i++) {
-		iter++;
-	}
-	RowItem & rowItem = *iter;
 	if (pLvdi->item.iSubItem > 0 && (pLvdi->item.mask & LVIF_TEXT)) {
-		std::wstring val;
+		if (!runtimeDatas.isLoaded(iItem)) {
+			// the evicted row is shown after the worker thread has fetched it again
+			if (pLvdi->item.cchTextMax > 0) {
+				pLvdi->item.pszText[0] = L'\0';
+			}
+			return 0;
+		}
+		// only the visible cell is converted to the text
 		if (resultType == QUERY_TABLE_DATA || runtimeColumns.at(0) == L"_ct_sqlite_rowid") { // ROW_ID
-			val = rowItem.at(pLvdi->item.iSubItem);
+			runtimeDatas.copyText(iItem, pLvdi->item.iSubItem, pLvdi->item.pszText, pLvdi->item.cchTextMax);
 		} else {
-			val = rowItem.at(pLvdi->item.iSubItem - 1);
+			runtimeDatas.copyText(iItem, pLvdi->item.iSubItem - 1, pLvdi->item.pszText, pLvdi->item.cchTextMax);
 		}
-		StringCchCopy(pLvdi->item.pszText, pLvdi->item.cchTextMax, val.c_str());
 	}
 
 	return 0;
@@ -240,16 +306,14 @@ void ResultListPageAdapter::loadRuntimeTables(uint64_t userDbId, std::wstring &
 	runtimeTables = SqlUtil::getTablesFromSelectSql(sql, allTables);
 }
 
-void ResultListPageAdapter::loadRuntimeHeader(QSqlStatement & query)
+void ResultListPageAdapter::loadRuntimeHeader(const Columns & columns)
 {
 	int n = dataView->GetHeader().GetItemCount();
 	for (int i = 0; i < n; i++) {
 		dataView->GetHeader().DeleteItem(i);
 	}
 	dataView->InsertColumn(0, L"", LVCFMT_LEFT, 26, -1, 0);
-	n = query.getColumnCount();
-	for (int i = 0; i < n; i++) {
-		std::wstring columnName = query.getColumnName(i);
+	for (auto & columnName : columns) {
 		if (!columnName.empty() && columnName != L"_ct_sqlite_rowid") {
 			int colIdx = dataView->GetHeader().GetItemCount();
 			dataView->InsertColumn(colIdx + 1, columnName.c_str(), LVCFMT_LEFT, 100);
@@ -286,20 +350,33 @@ void ResultListPageAdapter::clearHeaderSorted(int notSelItem)
 	}
 }
 
+/**
+ * Load the first page of the query to runtimeDatas, if the query has more rows, the remain rows are fetched 
+ * by the worker thread of adapterExecutor when the list view scrolls to the end, the query is executed again by its connection.
+ * 
+ * @param query - the executed query
+ * @return the fetched rows
+ */
 int ResultListPageAdapter::loadRuntimeData(QSqlStatement & query)
 {
-	CRect rectList;
-	dataView->GetClientRect(rectList);
+	closeRuntimeQuery();
+	runtimeDatas.clear();
+	runtimeDatas.setColumnCount(static_cast<int>(runtimeColumns.size()));
+	runtimeDatas.reserve(RESULT_FETCH_PAGE_ROWS);
 
-	int n = static_cast<int>(runtimeColumns.size());
-	while (query.executeStep()) {
-		RowItem rowItem;
-		for (int i = 0; i < n; i++) {
-			std::wstring columnVal = query.getColumn(i).isNull() ? L"< NULL >" : query.getColumn(i).getText();
-			rowItem.push_back(columnVal);
+	runtimeFetchedRows = 0;
+	while (runtimeFetchedRows < RESULT_FETCH_PAGE_ROWS && query.executeStep()) {
+		runtimeDatas.appendRow(query);
+		runtimeFetchedRows++;
+	}
+	if (runtimeFetchedRows == RESULT_FETCH_PAGE_ROWS) {
+		if (!adapterExecutor) {
+			adapterExecutor.reset(new QSqlExecutor());
 		}
-		runtimeDatas.push_back(rowItem);
+		runtimeExecutor = adapterExecutor.get();
+		runtimeHasMore = true;
 	}
+
 	int nRow = static_cast<int>(runtimeDatas.size());
 	// trigger CListViewCtrl message LVN_GETDISPINFO to parent HWND, it will call this->fillListViewItemData(NMLVDISPINFO * pLvdi)
 	dataView->SetItemCount(nRow);
@@ -307,7 +384,219 @@ int ResultListPageAdapter::loadRuntimeData(QSqlStatement & query)
 	return nRow;
 }
 
-void ResultListPageAdapter::loadLimitParams(LimitParams & limitParams)
+void ResultListPageAdapter::closeRuntimeQuery()
+{
+	runtimeHasMore = false;
+	if (runtimeExecutor) {
+		runtimeExecutor->closeCursor(runtimeCursorId);
+	}
+	runtimeExecutor = nullptr;
+	runtimeCursorId = 0;
+	runtimeFetchSeq = 0;
+	runtimeFetchFirstRow = -1;
+	runtimeItemCount = 0;
+}
+
+/**
+ * Close the opened query, so the pending statement will not block the DDL of the same connection(SQLITE_LOCKED) 
+ * or the writing statements of the other connections, the query kept by the executor will be executed again 
+ * by the worker connection when fetching the next page.
+ */
+void ResultListPageAdapter::releaseRuntimeQuery()
+{
+	if (runtimeExecutor) {
+		runtimeExecutor->closeCursor(runtimeCursorId);
+		runtimeCursorId = 0;
+	}
+}
+
+/**
+ * The item count of the list view, the rows before and after the window of runtimeDatas may have been evicted.
+ * 
+ * @return the item count
+ */
+int ResultListPageAdapter::getRuntimeItemCount()
+{
+	int nRow = static_cast<int>(runtimeDatas.size());
+	return runtimeItemCount > nRow ? runtimeItemCount : nRow;
+}
+
+/**
+ * The rows of runtimeDatas are not all in memory, the operations need all the rows must call loadAllRuntimeData() first.
+ */
+bool ResultListPageAdapter::isRuntimeDataEvicted()
+{
+	return runtimeDatas.getFirstRow() > 0 || runtimeItemCount > static_cast<int>(runtimeDatas.size());
+}
+
+/**
+ * Handle the LVN_ODCACHEHINT of the list view, fetch the next page by the worker thread of runtimeExecutor 
+ * if the list view will show the last rows, or load a new window of rows if it jumps to the evicted rows.
+ * 
+ * @param iFrom - the first item index of the cache hint
+ * @param iTo - the last item index of the cache hint
+ */
+void ResultListPageAdapter::prepareRuntimeData(int iFrom, int iTo)
+{
+	if (!runtimeExecutor || (!hasMoreRuntimeData() && !isRuntimeDataEvicted())) {
+		return;
+	}
+	int nRow = static_cast<int>(runtimeDatas.size());
+	if (iFrom < runtimeDatas.getFirstRow() || (iFrom > nRow + RESULT_FETCH_PAGE_ROWS && runtimeNewRows.empty())) {
+		// the list view jumps to the rows that have been evicted or are far from the loaded rows
+		int firstRow = iFrom > RESULT_WINDOW_ROWS / 4 ? iFrom - RESULT_WINDOW_ROWS / 4 : 0;
+		requestRuntimeData(iTo - firstRow + RESULT_FETCH_PAGE_ROWS, firstRow);
+		return;
+	}
+	if (!hasMoreRuntimeData() || iTo < nRow - RESULT_FETCH_PAGE_ROWS / 5) {
+		return;
+	}
+	requestRuntimeData((iTo - nRow) + RESULT_FETCH_PAGE_ROWS);
+	evictRuntimeData(iFrom);
+}
+
+/**
+ * Evict the rows far before the visible rows when the loaded rows exceed RESULT_WINDOW_ROWS, so the memory of 
+ * a large result is bounded while the list view scrolls down. The evicted rows are fetched again if the list view
+ * scrolls back to them. The new rows and the sorted rows are never evicted.
+ * 
+ * @param iFrom - the first visible item index
+ */
+void ResultListPageAdapter::evictRuntimeData(int iFrom)
+{
+	int nLoaded = static_cast<int>(runtimeDatas.size()) - runtimeDatas.getFirstRow();
+	if (nLoaded <= RESULT_WINDOW_ROWS || !runtimeNewRows.empty() || runtimeSorter) {
+		return;
+	}
+	int nRows = nLoaded - RESULT_WINDOW_ROWS / 2;
+	int nBefore = iFrom - RESULT_FETCH_PAGE_ROWS - runtimeDatas.getFirstRow();
+	nRows = nRows < nBefore ? nRows : nBefore;
+	if (nRows <= 0) {
+		return;
+	}
+	runtimeDatas.evictRows(nRows);
+}
+
+/**
+ * Fetch all the remain rows by the worker thread of runtimeExecutor, and fetch the evicted rows again, 
+ * call it before the operations need all the rows, such as sort/copy/export.
+ * 
+ * @return the total rows of runtimeDatas
+ */
+int ResultListPageAdapter::loadAllRuntimeData()
+{
+	if (!runtimeExecutor || (!hasMoreRuntimeData() && !isRuntimeDataEvicted())) {
+		return static_cast<int>(runtimeDatas.size());
+	}
+	// wait for the running page, then wait for the worker thread fetching all the remain rows
+	if (runtimeFetchSeq) {
+		runtimeExecutor->waitFetch();
+		finishFetchRuntimeData(runtimeFetchSeq);
+	}
+	if (hasMoreRuntimeData() || isRuntimeDataEvicted()) {
+		requestRuntimeData(-1, runtimeDatas.getFirstRow() ? 0 : -1);
+		if (!runtimeFetchSeq) {
+			QPopAnimate::warn(parentHwnd, S(L"query-is-running"));
+			return static_cast<int>(runtimeDatas.size());
+		}
+		runtimeExecutor->waitFetch();
+		finishFetchRuntimeData(runtimeFetchSeq);
+	}
+	return static_cast<int>(runtimeDatas.size());
+}
+
+/**
+ * Request the rows of the query from the worker thread of runtimeExecutor, the rows are read by the connection 
+ * that has executed the query and appended in finishFetchRuntimeData(), so the list view keeps responsive.
+ * If the worker thread is busy, the rows are requested again by the next LVN_ODCACHEHINT.
+ * 
+ * @param nRows - the max rows to fetch, -1 means fetch all the remain rows
+ * @param firstRow - the fetched rows replace runtimeDatas beginning from this row, -1 means append the next rows
+ */
+void ResultListPageAdapter::requestRuntimeData(int nRows, int firstRow)
+{
+	if (!runtimeExecutor || runtimeFetchSeq) {
+		return;
+	}
+	std::wstring dbPath;
+	try {
+		dbPath = databaseService->getUserDb(runtimeUserDbId).path;
+	} catch (QSqlExecuteException &ex) {
+		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
+		QPopAnimate::report(ex);
+		return;
+	}
+	if (firstRow >= 0) {
+		// the opened query can not go back, execute the query again and skip the rows before the window
+		runtimeExecutor->closeCursor(runtimeCursorId);
+		runtimeCursorId = 0;
+	}
+	runtimeFetchFirstRow = firstRow;
+	runtimeFetchSeq = runtimeExecutor->fetch(parentHwnd, runtimeUserDbId, dbPath, runtimeCursorId, runtimeSql, 
+		firstRow >= 0 ? firstRow : runtimeFetchedRows, nRows);
+}
+
+/**
+ * Append the rows that the worker thread of runtimeExecutor has fetched, handle the MSG_RESULT_FETCHED_ID message.
+ * 
+ * @param fetchSeq - the sequence of the fetch, the result is ignored if it is not the running fetch of this adapter
+ */
+void ResultListPageAdapter::finishFetchRuntimeData(uint32_t fetchSeq)
+{
+	if (!runtimeExecutor || !fetchSeq || fetchSeq != runtimeFetchSeq) {
+		return;
+	}
+	runtimeFetchSeq = 0;
+	std::unique_ptr<QSqlExecResult> result = runtimeExecutor->takeFetchResult(fetchSeq);
+	if (!result) {
+		return;
+	}
+	int itemCount = getRuntimeItemCount();
+	runtimeCursorId = result->cursorId;
+	runtimeHasMore = result->hasMore;
+	if (result->resultInfo.code) {
+		if (!result->isCanceled) {
+			QSqlExecuteException ex(std::to_wstring(result->resultInfo.code), result->resultInfo.msg, runtimeSql);
+			QPopAnimate::report(ex);
+		}
+	} else if (!runtimeDatas.empty() && result->datas.getColumnCount() != runtimeDatas.getColumnCount()) {
+		// the columns of the result have been changed by the DDL, the remain or evicted rows will not be fetched
+		closeRuntimeQuery();
+	} else if (runtimeFetchFirstRow >= 0 || runtimeDatas.empty()) {
+		// the new window of rows, or the first page of the sorted query
+		bool isFirstPage = runtimeDatas.empty();
+		runtimeDatas = std::move(result->datas);
+		runtimeDatas.setFirstRow(runtimeFetchFirstRow > 0 ? runtimeFetchFirstRow : 0);
+		runtimeFetchedRows = runtimeDatas.size();
+		if (isFirstPage) {
+			runtimeResultInfo.execTime = result->resultInfo.execTime;
+			runtimeResultInfo.transferTime = result->resultInfo.transferTime;
+			runtimeResultInfo.totalTime = result->resultInfo.totalTime;
+			runtimeResultInfo.effectRows = runtimeFetchedRows;
+			dataView->SetItemCount(runtimeFetchedRows);
+			dataView->changeAllItemsCheckState();
+		} else {
+			// the edited values of the reloaded rows
+			for (auto & item : dataView->getChangedVals()) {
+				if (runtimeDatas.isLoaded(item.iItem)) {
+					runtimeDatas.setString(item.iItem, item.iSubItem - 1, item.newVal);
+				}
+			}
+			dataView->Invalidate(true);
+		}
+	} else {
+		runtimeDatas.appendRows(result->datas);
+		runtimeFetchedRows += result->datas.size();
+	}
+	runtimeFetchFirstRow = -1;
+	// the rows after the window are still in the list view
+	runtimeItemCount = itemCount > runtimeDatas.size() ? itemCount : 0;
+	int nRow = getRuntimeItemCount();
+	dataView->SetItemCountEx(nRow, LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+	::PostMessage(parentHwnd, Config::MSG_RESULT_ROWS_CHANGE_ID, WPARAM(nRow), LPARAM(hasMoreRuntimeData() ? 0 : 1));
+}
+
+void ResultListPageAdapter::loadLimitParams(const std::wstring & settingPrefix, LimitParams & limitParams)
 {
 	std::wstring limitChecked = SettingService::getInstance()->getSysInit(settingPrefix + L"limit-checked");
 	std::wstring offset = SettingService::getInstance()->getSysInit(settingPrefix + L"limit-offset");
@@ -319,6 +608,37 @@ void ResultListPageAdapter::loadLimitParams(LimitParams & limitParams)
 	limitParams.rows = std::stoi(rows);
 }
 
+/**
+ * The sql that really executes, the LIMIT clause of the settings is appended if the select sql has no LIMIT clause.
+ * 
+ * @param settingPrefix - the prefix of the limit settings, QUERY_SQL_RESULT is empty
+ * @param sql - the origin sql
+ * @return the runtime sql
+ */
+std::wstring ResultListPageAdapter::buildRuntimeSql(const std::wstring & settingPrefix, const std::wstring & sql)
+{
+	std::wstring runtimeSql = sql;
+	if (!runtimeSql.empty() && !SqlUtil::isPragmaStmt(runtimeSql, false) && !SqlUtil::hasLimitClause(runtimeSql)) {
+		appendLimitClause(settingPrefix, runtimeSql);
+	}
+	return runtimeSql;
+}
+
+/**
+ * Append the LIMIT/OFFSET clause of the limit settings to the sql.
+ * 
+ * @param sql - [in/out] the select sql
+ */
+void ResultListPageAdapter::appendLimitClause(const std::wstring & settingPrefix, std::wstring & sql)
+{
+	LimitParams limitParams;
+	loadLimitParams(settingPrefix, limitParams);
+	if (limitParams.checked) {
+		sql.append(L" LIMIT ").append(std::to_wstring(limitParams.rows))
+			.append(L" OFFSET ").append(std::to_wstring(limitParams.offset));
+	}
+}
+
 /**
  * if the row of index=iItem is selected.
  * 
@@ -347,7 +667,7 @@ bool ResultListPageAdapter::getIsChecked(int iItem)
  * 
  * @return new runtime sql
  */
-std::wstring ResultListPageAdapter::buildRungtimeSqlWithFilters()
+std::wstring ResultListPageAdapter::buildRungtimeSqlWithFilters(bool withLimit)
 {
 	if (runtimeFilters.empty() || originSql.empty()) {
 		return originSql;
@@ -405,13 +725,8 @@ std::wstring ResultListPageAdapter::buildRungtimeSqlWithFilters()
 		}		
 	}
 
-	if (!SqlUtil::hasLimitClause(originSql)) {
-		LimitParams limitParams;
-		loadLimitParams(limitParams);
-		if (limitParams.checked) {
-			newSql.append(L" LIMIT ").append(std::to_wstring(limitParams.rows))
-				.append(L" OFFSET ").append(std::to_wstring(limitParams.offset));
-		}		
+	if (withLimit && !SqlUtil::hasLimitClause(originSql)) {
+		appendLimitClause(settingPrefix, newSql);
 	}
 	
 	return newSql;
@@ -424,12 +739,14 @@ RowItem ResultListPageAdapter::getFirstSelectdRowItem()
 	}
 	
 	int nSelItem = -1;
-	if ((nSelItem = dataView->GetNextItem(nSelItem, LVNI_SELECTED)) != -1) {
-		DataList::iterator itor = runtimeDatas.begin();		
-		for (int i = 0; i < nSelItem && itor != runtimeDatas.end(); i++) {
-			itor++;
-		}
-		return *itor;
+	if ((nSelItem = dataView->GetNextItem(nSelItem, LVNI_SELECTED)) == -1 || nSelItem >= getRuntimeItemCount()) {
+		return RowItem();
+	}
+	if (!runtimeDatas.isLoaded(nSelItem)) {
+		loadAllRuntimeData();
+	}
+	if (runtimeDatas.isLoaded(nSelItem)) {
+		return runtimeDatas.getRowItem(nSelItem);
 	}
 	return RowItem();
 }
@@ -450,16 +767,20 @@ DataList ResultListPageAdapter::getSelectedDatas()
 		return DataList();
 	}
 	DataList result;
+	std::vector<int> nSelItems;
+	bool hasEvictedRow = false;
 	int nSelItem = -1;
 	while ((nSelItem = dataView->GetNextItem(nSelItem, LVNI_SELECTED)) != -1) {
-		DataList::iterator itor = runtimeDatas.begin();
-		for (int i = 0; i < nSelItem && itor != runtimeDatas.end(); i++) {
-			itor++;
-		}
-		if (itor != runtimeDatas.end()) {
-			result.push_back(*itor);
+		nSelItems.push_back(nSelItem);
+		hasEvictedRow = hasEvictedRow || !runtimeDatas.isLoaded(nSelItem);
+	}
+	if (hasEvictedRow) {
+		loadAllRuntimeData();
+	}
+	for (int iItem : nSelItems) {
+		if (runtimeDatas.isLoaded(iItem)) {
+			result.push_back(runtimeDatas.getRowItem(iItem));
 		}
-		
 	}
 	return result;
 }
@@ -494,14 +815,14 @@ void ResultListPageAdapter::setRuntimeColumns(const Columns & columns)
 	runtimeColumns = columns;
 }
 
-const DataList & ResultListPageAdapter::getRuntimeDatas()
+const QResultSet & ResultListPageAdapter::getRuntimeDatas()
 {
 	return runtimeDatas;
 }
 
 void ResultListPageAdapter::setRuntimeDatas(const DataList & dataList)
 {
-	runtimeDatas = dataList;
+	runtimeDatas = QResultSet(dataList);
 }
 
 /**
@@ -575,6 +896,7 @@ bool ResultListPageAdapter::isRuntimeFiltersEmpty()
 
 void ResultListPageAdapter::copyAllRowsToClipboard()
 {
+	loadAllRuntimeData();
 	int n = static_cast<int>(runtimeColumns.size());
 	bool hasRowId = runtimeColumns.at(0) == L"_ct_sqlite_rowid";
 
@@ -596,16 +918,12 @@ void ResultListPageAdapter::copyAllRowsToClipboard()
 	oss << endl;
 
 	// 2.write the datas to stringstream
-	n = 0;	
-	for (auto & vals : runtimeDatas) {
-		if (vals.empty()) {
-			continue;
-		}
-		
-		int i = 0;
-		for (auto & val : vals) {
+	int nRows = runtimeDatas.size();
+	int nVals = runtimeDatas.getColumnCount();
+	std::wstring rval; // reused by every cell, no allocation after it is big enough
+	for (int row = 0; row < nRows; row++) {
+		for (int i = 0; i < nVals; i++) {
 			if (hasRowId && i == 0) {
-				i++;
 				continue;
 			}
 
@@ -615,9 +933,12 @@ void ResultListPageAdapter::copyAllRowsToClipboard()
 				oss << L",";
 			}
 
-			std::wstring rval = StringUtil::escape(val);
-			oss << L'"' << rval << L'"';
-			i++;
+			runtimeDatas.getString(row, i, rval);
+			if (rval.find_first_of(L"\\\"\r\n") == std::wstring::npos) {
+				oss << L'"' << rval << L'"';
+			} else {
+				oss << L'"' << StringUtil::escape(rval) << L'"';
+			}
 		}
 		oss << endl;
 	}
@@ -687,6 +1008,7 @@ void ResultListPageAdapter::copyAllRowsAsSql()
 	if (runtimeTables.empty() || runtimeTables.size() > 1) {
 		return ;
 	}
+	loadAllRuntimeData();
 	
 	std::wstring & tbl = runtimeTables.at(0);
 	int n = static_cast<int>(runtimeColumns.size());
@@ -695,10 +1017,9 @@ void ResultListPageAdapter::copyAllRowsAsSql()
 	std::wostringstream oss;
 	// 1.write the data to stringstream
 	n = 0;
-	for (auto & vals : runtimeDatas) {
-		if (vals.empty()) {
-			continue;
-		}
+	int nRows = runtimeDatas.size();
+	std::wstring val; // reused by every cell, no allocation after it is big enough
+	for (int row = 0; row < nRows; row++) {
 		int i = 0;
 		std::wostringstream dataSql, columnStmt, valuesStmt;
 		dataSql << L"INSERT INTO " << tbl << L' ';
@@ -711,7 +1032,10 @@ void ResultListPageAdapter::copyAllRowsAsSql()
 				i++;
 				continue;
 			}
-			std::wstring val = StringUtil::escapeSql(vals.at(i));
+			runtimeDatas.getString(row, i, val);
+			if (val.find(L'\'') != std::wstring::npos) {
+				val = StringUtil::escapeSql(val);
+			}
 
 			if (hasRowId && i > 1) {
 				columnStmt << L", ";
@@ -721,7 +1045,7 @@ void ResultListPageAdapter::copyAllRowsAsSql()
 				valuesStmt <<  L", ";
 			}
 			columnStmt << L"\"" << column << "\"";
-			if (val == L"< AUTO >" || val == L"< NULL >") {
+			if (runtimeDatas.isNull(row, i) || val == L"< AUTO >") {
 				valuesStmt << L"NULL";
 			} else {
 				valuesStmt << L"'" << val <<  L"'";
@@ -813,14 +1137,8 @@ void ResultListPageAdapter::setSettingPrefix(std::wstring &prefix)
 void ResultListPageAdapter::changeRuntimeDatasItem(int iItem, int iSubItem, std::wstring & origText, std::wstring & newText)
 {
 	ATLASSERT(iItem >= 0 && iSubItem > 0);
-	auto iter = runtimeDatas.begin();
-	
-	for (int i = 0; i < iItem; i++) {
-		iter++;
-	}
-	RowItem & rowItem = *iter;
 	// rowItem.index = listView.row.iSubItem
-	rowItem[iSubItem] = newText;
+	runtimeDatas.setString(iItem, iSubItem, newText);
 }
 
 void ResultListPageAdapter::invalidateSubItem(int iItem, int iSubItem)
@@ -835,6 +1153,9 @@ void ResultListPageAdapter::createNewRow()
 	if (runtimeColumns.empty()) {
 		return;
 	}
+	// the new row must be appended after all the rows of the query
+	loadAllRuntimeData();
+	runtimeSorter.reset();
 	// 1.create a empty row and push it to runtimeDatas list
 	RowItem row;
 	std::wstring primaryKey;
@@ -855,7 +1176,7 @@ void ResultListPageAdapter::createNewRow()
 		}
 		
 	}
-	runtimeDatas.push_back(row);
+	runtimeDatas.appendRow(row);
 
 	// 2.update the item count and selected the new row	
 	n = static_cast<int>(runtimeDatas.size());
@@ -872,6 +1193,9 @@ void ResultListPageAdapter::copyNewRow()
 	if (runtimeColumns.empty()) {
 		return;
 	}
+	// the new row must be appended after all the rows of the query
+	loadAllRuntimeData();
+	runtimeSorter.reset();
 	// 1.copy selected row and push it to runtimeDatas list
 	RowItem row = getFirstSelectdRowItem();
 	if (row.empty()) {
@@ -891,7 +1215,7 @@ void ResultListPageAdapter::copyNewRow()
 	} else if (!hasRowId && primaryKey == runtimeColumns.at(0)) {
 		row[0] = L"< AUTO >";
 	}
-	runtimeDatas.push_back(row);
+	runtimeDatas.appendRow(row);
 	int n = static_cast<int>(runtimeDatas.size());
 	runtimeNewRows.push_back(n-1); // runtimeDatas index
 	dataView->SetItemCount(n);
@@ -906,225 +1230,263 @@ void ResultListPageAdapter::copyNewRow()
  * save the change data includes:
  * 1.The changeVals from QListView::getChangeVals
  * 2.The runtimeDates index from runtimeNewRows 
+ * All the changes are applied in one transaction, nothing is saved if any row has error.
  * 
  * @return 
  */
 bool ResultListPageAdapter::save()
 {
-	// 1.The changeVals from QListViewCtrl::getChangeVals function
-	bool ret = saveChangeVals();
-	if (!ret) {
-		return ret;
+	RowChanges rowChanges;
+	try {
+		// 1.The changeVals from QListViewCtrl::getChangeVals function
+		makeUpdateRowChanges(rowChanges);
+		// 2. The runtimeNewRows that it save runtimeDatas index  
+		makeInsertRowChanges(rowChanges);
+	} catch (QSqlExecuteException &ex) {
+		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
+		QPopAnimate::report(ex);
+		return false;
 	}
-	// 2. The runtimeNewRows that it save runtimeDatas index  
-	ret = saveNewRows();
-	if (!ret) {
-		return ret;
+	
+	if (!applyRowChanges(rowChanges)) {
+		return false;
+	}
+
+	// clear changes and new rows
+	dataView->clearChangeVals();
+	if (!runtimeNewRows.empty()) {
+		runtimeNewRows.clear();
+		try {
+			loadFilterListView();
+		} catch (QSqlExecuteException &ex) {
+			QPopAnimate::report(ex);
+		}
+		sendExecSqlMessage(runtimeResultInfo);
 	}
 	QPopAnimate::success(parentHwnd, S(L"save-success-text"));
 	return true;
 }
 
 /**
- * The changeVals from QListViewCtrl::getChangeVals function will be save.
+ * The changeVals from QListViewCtrl::getChangeVals function are grouped by row, 
+ * one UPDATE for each row that sets all the changed columns of the row.
  * 
+ * @param rowChanges - [out] the row changes
  */
-bool ResultListPageAdapter::saveChangeVals()
+void ResultListPageAdapter::makeUpdateRowChanges(RowChanges & rowChanges)
 {
-	SubItemValues changeVals = dataView->getChangedVals();
-	SubItemValues errorChanges;
+	const SubItemValues & changeVals = dataView->getChangedVals();
 	if (changeVals.empty()) {
-		return true;
+		return;
+	}
+	// iItem will be excludes if it's in the vector rumtimeNewRows
+	std::unordered_set<int> newRows(runtimeNewRows.begin(), runtimeNewRows.end());
+	// key - iItem, value - (key - iSubItem, value - the changed subItem), the rows and columns are in order
+	std::map<int, std::map<int, const SubItemValue *>> rowChangeVals;
+	for (auto & subItemVal : changeVals) {
+		if (newRows.count(subItemVal.iItem)) {
+			continue;
+		}
+		rowChangeVals[subItemVal.iItem][subItemVal.iSubItem] = &subItemVal;
+	}
+	if (rowChangeVals.empty()) {
+		return;
 	}
-	// BEGIN A TRANSACTION
-	std::wstring sql = L"BEGIN;";
-	tableService->execBySql(runtimeUserDbId, sql);
-	std::wstring sqlSuccess = sql;
-
-	// sql log
-	resetRuntimeResultInfo();
-	runtimeResultInfo.userDbId = runtimeUserDbId;
 
-	auto _begin = PerformUtil::begin();
-	int effectRows = 0;
-	for (auto subItemVal : changeVals) {
-		int iItem = subItemVal.iItem;
-		int iSubItem = subItemVal.iSubItem;
-
-		//iItem will be excludes if it's in the vector rumtimeNewRows
-		auto iterItem = std::find(runtimeNewRows.begin(), runtimeNewRows.end(), iItem);
-		if (iterItem != runtimeNewRows.end()) {
+	std::wstring primaryKey = getRuntimePrimaryKey();
+	for (auto & rowIter : rowChangeVals) {
+		RowChange rowChange;
+		rowChange.type = ROW_CHANGE_UPDATE;
+		rowChange.iItem = rowIter.first;
+		if (!makeRowChangeKeys(rowChange.iItem, primaryKey, rowChange.keys)) {
 			continue;
 		}
+		for (auto & subItemIter : rowIter.second) {
+			RowChangeValue value;
+			value.column = runtimeColumns.at(getRuntimeColumnIndex(subItemIter.first));
+			value.val = subItemIter.second->newVal;
+			value.type = value.val == L"< NULL >" ? ROW_VALUE_NULL : ROW_VALUE_TEXT;
+			rowChange.values.push_back(value);
+		}
+		rowChanges.push_back(rowChange);
+	}
+}
 
-		auto iter = runtimeDatas.begin();
-		for (int i = 0; i < iItem ; i++) {
-			iter++;
+/**
+ * The runtimeDates index from runtimeNewRows, one INSERT for each new row.
+ * 
+ * @param rowChanges - [out] the row changes
+ */
+void ResultListPageAdapter::makeInsertRowChanges(RowChanges & rowChanges)
+{
+	if (runtimeNewRows.empty()) {
+		return;
+	}
+	// the rowid column is not inserted
+	int firstCol = runtimeColumns.at(0) == L"_ct_sqlite_rowid" ? 1 : 0;
+	int n = static_cast<int>(runtimeColumns.size());
+	for (auto nItem : runtimeNewRows) {
+		RowChange rowChange;
+		rowChange.type = ROW_CHANGE_INSERT;
+		rowChange.iItem = nItem;
+		for (int i = firstCol; i < n; i++) {
+			RowChangeValue value;
+			value.column = runtimeColumns.at(i);
+			value.val = runtimeDatas.getString(nItem, i);
+			if (runtimeDatas.isNull(nItem, i) || value.val == L"< AUTO >" || value.val == L"< NULL >") {
+				value.type = ROW_VALUE_NULL;
+			} else {
+				value.type = toRowValueType(runtimeDatas.getType(nItem, i));
+			}
+			rowChange.values.push_back(value);
 		}
-		// this row change vals vector
-		SubItemValues rowChangeVals = dataView->getRowChangedVals(iItem);
-		RowItem & rowItem = *iter;
-		std::wstring tblName = runtimeTables.at(0);
-		
-		std::wstring whereClause;
-		int nSelSubItem = iSubItem;
-		std::wstring & origVal = subItemVal.origVal;
-		
-		whereClause = SqlUtil::makeWhereClauseByRowId(runtimeColumns, rowItem);
-		std::wstring newVal = StringUtil::escapeSql(subItemVal.newVal);
-		std::wstring sqlUpdate(L"UPDATE ");
-		sqlUpdate.append(quo).append(tblName).append(quo)
-			.append(L" SET ").append(quo)
-			.append(runtimeColumns.at(nSelSubItem)).append(quo)
-			.append(L"=")
-			.append(qua).append(newVal).append(qua)
-			.append(whereClause);
+		rowChanges.push_back(rowChange);
+	}
+}
 
-		try {
-			tableService->execBySql(runtimeUserDbId, sqlUpdate);
-			effectRows++;
-			sqlSuccess.append(lbrk).append(sqlUpdate).append(edl);
-		}  catch (QSqlExecuteException &ex) {
-			// ROLLBACK
-			sql = L"ROLLBACK;";
-			tableService->execBySql(runtimeUserDbId, sql);
-
-			errorChanges.push_back(subItemVal);
-			Q_ERROR(L"query db has error, code:{}, msg:{}, sql:{}", ex.getCode(), ex.getMsg(), sqlUpdate);
-			dataView->SelectItem(subItemVal.iItem);
-			dataView->createOrShowEditor(subItemVal.iItem, subItemVal.iSubItem);
-
-			ex.setRollBack(true);
-			QPopAnimate::report(ex);
+/**
+ * Make the keys of WHERE clause that locate the row in the table, the keys are:
+ * 1.ROWID if the runtime columns has the rowid column
+ * 2.The primary key if the table has primary key
+ * 3.All the columns 
+ * The original values before changed are used for the primary key and the columns.
+ * 
+ * @param iItem - the runtimeDatas index
+ * @param primaryKey - the primary key column, empty if the table has no primary key
+ * @param keys - [out] the keys
+ * @return false if the row can't be located, such as the primary key value is < AUTO > / NULL
+ */
+bool ResultListPageAdapter::makeRowChangeKeys(int iItem, const std::wstring & primaryKey, RowChangeValues & keys)
+{
+	if (runtimeColumns.at(0) == L"_ct_sqlite_rowid") {
+		RowChangeValue key;
+		key.column = L"ROWID";
+		key.val = std::to_wstring(runtimeDatas.getInt64(iItem, 0));
+		key.type = ROW_VALUE_INTEGER;
+		keys.push_back(key);
+		return true;
+	}
 
-			// SQL LOG
-			runtimeResultInfo.sql = sqlUpdate;
-			runtimeResultInfo.execTime = PerformUtil::end(_begin);
-			runtimeResultInfo.transferTime = PerformUtil::end(_begin);
-			runtimeResultInfo.totalTime = PerformUtil::end(_begin);
-			runtimeResultInfo.code = std::stoi( ex.getCode());
-			runtimeResultInfo.msg = ex.getMsg();
-			sendExecSqlMessage(runtimeResultInfo, true);
+	// this row change vals vector
+	SubItemValues rowChangedVals = dataView->getRowChangedVals(iItem);
+	int n = static_cast<int>(runtimeColumns.size());
+	for (int i = 0; i < n; i++) {
+		auto & column = runtimeColumns.at(i);
+		if (!primaryKey.empty() && column != primaryKey) {
+			continue;
+		}
+		RowChangeValue key;
+		key.column = column;
+		auto iter = std::find_if(rowChangedVals.begin(), rowChangedVals.end(), [&](SubItemValue & subItem) {
+			return getRuntimeColumnIndex(subItem.iSubItem) == i;
+		});
+		if (iter != rowChangedVals.end()) {
+			key.val = (*iter).origVal;
+			key.type = key.val == L"< NULL >" ? ROW_VALUE_NULL : ROW_VALUE_TEXT;
+		} else {
+			key.val = runtimeDatas.getString(iItem, i);
+			key.type = toRowValueType(runtimeDatas.getType(iItem, i));
+		}
+		// this row data must be a new data ,database no record before save the row data.
+		if (!primaryKey.empty() && (key.type == ROW_VALUE_NULL || key.val == L"< AUTO >")) {
 			return false;
 		}
+		keys.push_back(key);
 	}
-
-	// commit all the executed sqls by tableService
-	sql = L"COMMIT;";
-	tableService->execBySql(runtimeUserDbId, sql);
-	sqlSuccess.append(lbrk).append(sql);
-	runtimeResultInfo.sql = sqlSuccess;
-	runtimeResultInfo.effectRows = effectRows;
-	runtimeResultInfo.execTime = PerformUtil::end(_begin);
-	runtimeResultInfo.transferTime = PerformUtil::end(_begin);
-	runtimeResultInfo.totalTime = PerformUtil::end(_begin);
-	sendExecSqlMessage(runtimeResultInfo, true);
-
-	// clear changes
-	dataView->clearChangeVals();
-
-	// restore the changeVals if has error
-	if (!errorChanges.empty()) {
-		dataView->setChangedVals(errorChanges);
-		return false;
-	} 
-	return true;
+	return !keys.empty();
 }
 
 /**
- * The runtimeDates index from runtimeNewRows.
+ * Apply the row changes in one transaction and send the sql log, 
+ * if any row has error, all the changes are rolled back, the failed rows are reported and the first failed row is selected.
  * 
+ * @param rowChanges - the row changes
+ * @return true if all the changes are applied
  */
-bool ResultListPageAdapter::saveNewRows()
+bool ResultListPageAdapter::applyRowChanges(RowChanges & rowChanges)
 {
-	if (runtimeNewRows.empty()) {
+	if (rowChanges.empty()) {
 		return true;
 	}
-	std::vector<int> errorNewRows;
-	std::wstring tblName = runtimeTables.at(0);
-
-	// BEGIN A TRASACTION	
-	std::wstring sql = L"BEGIN;";
-	tableService->execBySql(runtimeUserDbId, sql);
-	std::wstring sqlSuccess = sql;
+	std::wstring & tblName = runtimeTables.at(0);
+	// the query kept by the executor holds the SHARED lock of its connection, it would block the COMMIT
+	if (runtimeExecutor) {
+		releaseRuntimeQuery();
+	}
 
 	// sql log
 	resetRuntimeResultInfo();
 	runtimeResultInfo.userDbId = runtimeUserDbId;
 
 	auto _begin = PerformUtil::begin();
-	int effectRows = 0;
-	for (auto nItem : runtimeNewRows) {
-		auto itor = runtimeDatas.begin();
-		for (int i = 0; i < nItem; i++) {
-			itor++;
-		}
-		std::wstring colums = SqlUtil::makeInsertColumsClause(runtimeColumns);
-		std::wstring values = SqlUtil::makeInsertValuesClause(*itor);
-		if (colums.empty() || values.empty()) {
-			continue;
+	RowChangeErrors errors;
+	uint64_t effectRows = 0;
+	try {
+		effectRows = tableService->applyRowChanges(runtimeUserDbId, tblName, rowChanges, errors);
+	} catch (QSqlExecuteException &ex) {
+		// BEGIN or COMMIT has error
+		Q_ERROR(L"apply row changes has error, code:{}, msg:{}, sql:{}", ex.getCode(), ex.getMsg(), ex.getSql());
+		ex.setRollBack(true);
+		QPopAnimate::report(ex);
+		errors.clear();
+		RowChangeError error;
+		error.code = std::stoi(ex.getCode());
+		error.msg = ex.getMsg();
+		error.sql = ex.getSql();
+		errors.push_back(error);
+	}
+	runtimeResultInfo.execTime = PerformUtil::end(_begin);
+	runtimeResultInfo.transferTime = runtimeResultInfo.execTime;
+	runtimeResultInfo.totalTime = runtimeResultInfo.execTime;
+
+	if (errors.empty()) {
+		// one sql log per prepared statement that have been executed, with the count of rows it has applied
+		std::vector<std::wstring> sqls;
+		std::unordered_map<std::wstring, int> sqlRows;
+		for (auto & rowChange : rowChanges) {
+			std::wstring sql = tableService->getRowChangeSql(tblName, rowChange);
+			if (!sql.empty() && sqlRows[sql]++ == 0) {
+				sqls.push_back(sql);
+			}
 		}
-		
-		std::wstring sqlInsert(L"INSERT INTO ");
-		sqlInsert.append(quo).append(tblName).append(quo).append(colums).append(values);
-		
-		try {
-			tableService->execBySql(runtimeUserDbId, sqlInsert);
-			effectRows++;
-			sqlSuccess.append(lbrk).append(sqlInsert).append(edl);
-		}  catch (QSqlExecuteException &ex) {
-			// ROLLBACK
-			sql = L"ROLLBACK;";
-			tableService->execBySql(runtimeUserDbId, sql);
-
-			// select the error row
-			errorNewRows.push_back(nItem);
-			Q_ERROR(L"query db has error, code:{}, msg:{}, sql:{}", ex.getCode(), ex.getMsg(), sqlInsert);
-			dataView->SelectItem(nItem);
-			dataView->createOrShowEditor(nItem, 1);
-
-			ex.setRollBack(true);
-			QPopAnimate::report(ex);
-
-			// SQL LOG
-			runtimeResultInfo.sql = sqlInsert;
-			runtimeResultInfo.execTime = PerformUtil::end(_begin);
-			runtimeResultInfo.transferTime = PerformUtil::end(_begin);
-			runtimeResultInfo.totalTime = PerformUtil::end(_begin);
-			runtimeResultInfo.code = std::stoi( ex.getCode());
-			runtimeResultInfo.msg = ex.getMsg();
+		for (auto & sql : sqls) {
+			runtimeResultInfo.sql = sql + edl;
+			runtimeResultInfo.effectRows = sqls.size() == 1 ? static_cast<int>(effectRows) : sqlRows[sql];
 			sendExecSqlMessage(runtimeResultInfo, true);
-			return false;
 		}
+		return true;
 	}
-	// commit all the executed sqls by tableService
-	sql = L"COMMIT;";
-	tableService->execBySql(runtimeUserDbId, sql);
-	sqlSuccess.append(lbrk).append(sql);
-	runtimeResultInfo.sql = sqlSuccess;
-	runtimeResultInfo.effectRows = effectRows;
-	runtimeResultInfo.execTime = PerformUtil::end(_begin);
-	runtimeResultInfo.transferTime = PerformUtil::end(_begin);
-	runtimeResultInfo.totalTime = PerformUtil::end(_begin);
-	sendExecSqlMessage(runtimeResultInfo, true);
 
-	// clear new rows
-	runtimeNewRows.clear();
-
-	// reset the runtimeNewRows if has error
-	if (!errorNewRows.empty()) {
-		runtimeNewRows = errorNewRows;
-		return false;
+	// report all the failed rows
+	std::wstring errMsg, errSql;
+	for (auto & error : errors) {
+		if (error.iItem >= 0) {
+			errMsg.append(StringUtil::replace(S(L"save-row-error-text"), std::wstring(L"{row}"), std::to_wstring(error.iItem + 1)));
+		}
+		errMsg.append(error.msg).append(lbrk);
+		if (errSql.find(error.sql) == std::wstring::npos) {
+			errSql.append(error.sql).append(edl).append(lbrk);
+		}
 	}
-
-	try {
-		loadFilterListView();
-	} catch (QSqlExecuteException &ex) {
+	const RowChangeError & firstError = errors.front();
+	if (firstError.iItem >= 0) {
+		QSqlExecuteException ex(std::to_wstring(firstError.code), errMsg, errSql);
+		ex.setRollBack(true);
 		QPopAnimate::report(ex);
+
+		// select the first failed row and show the editor on the changed column
+		SubItemValues rowChangedVals = dataView->getRowChangedVals(firstError.iItem);
+		int iSubItem = rowChangedVals.empty() ? 1 : rowChangedVals.front().iSubItem;
+		dataView->SelectItem(firstError.iItem);
+		dataView->createOrShowEditor(firstError.iItem, iSubItem);
 	}
 
-	sendExecSqlMessage(runtimeResultInfo);
-	return true;
+	// SQL LOG
+	runtimeResultInfo.sql = errSql;
+	runtimeResultInfo.code = firstError.code;
+	runtimeResultInfo.msg = errMsg;
+	sendExecSqlMessage(runtimeResultInfo, true);
+	return false;
 }
 
 bool ResultListPageAdapter::remove(bool confirm)
@@ -1146,29 +1508,32 @@ bool ResultListPageAdapter::remove(bool confirm)
 	if (nSelItems.empty()) {
 		return false;
 	}
+	// the row indexes are changed after removing, so all the rows must be in memory
+	if (isRuntimeDataEvicted()) {
+		loadAllRuntimeData();
+		if (isRuntimeDataEvicted()) {
+			return false;
+		}
+	}
 
-	// 2.delete from runtimeDatas and database and dataView that the item begin from the last selected item
+	// 2.delete all the selected rows from database in one transaction
+	if (!removeRowsFromDb(nSelItems)) {
+		return false;
+	}
+
+	// 3.delete from runtimeDatas and dataView that the item begin from the last selected item
+	runtimeSorter.reset();
 	int n = static_cast<int>(nSelItems.size());
 	for (int i = n - 1; i >= 0; i--) {
 		nSelItem = nSelItems.at(i);
-		auto iter = runtimeDatas.begin();
-		for (int j = 0; j < nSelItem; j++) {
-			iter++;
-		}
-		RowItem & rowItem = (*iter);
-		// 2.1 delete row from database 
-		if (!removeRowFromDb(nSelItem, rowItem)) {
-			return false;
-		}
-
-		// 2.2 delete row from runtimeDatas vector 
-		runtimeDatas.erase(iter);
+		// 3.1 delete row from runtimeDatas vector 
+		runtimeDatas.eraseRow(nSelItem);
 
-		// 2.3 delete row from dataView
+		// 3.2 delete row from dataView
 		dataView->RemoveItem(nSelItem);
 	}
 
-	// 3.delete or subtract item index in runtimeNewRows and changeVals the item begin from the last selected item
+	// 4.delete or subtract item index in runtimeNewRows and changeVals the item begin from the last selected item
 	for (int i = n - 1; i >= 0; i--) {
 		nSelItem = nSelItems.at(i);
 		auto itor = runtimeNewRows.begin();
@@ -1194,77 +1559,73 @@ bool ResultListPageAdapter::remove(bool confirm)
 	return true;
 }
 
-int ResultListPageAdapter::removeRowFromDb(int nSelItem, RowItem & rowItem)
+/**
+ * Delete the rows from database by one prepared DELETE statement in one transaction, 
+ * the new rows that have not been saved are skipped.
+ * 
+ * @param nSelItems - the runtimeDatas index of the rows
+ * @return true if all the rows are deleted
+ */
+bool ResultListPageAdapter::removeRowsFromDb(const std::vector<int> & nSelItems)
 {
-	std::wstring & tblName = runtimeTables.at(0);
-
-	// if the nSelItem row 
-	auto iter = std::find(runtimeNewRows.begin(), runtimeNewRows.end(), nSelItem);
-	if (iter != runtimeNewRows.end()) {
-		return 1;
-	}
-
-	// this row change vals vector
-	SubItemValues rowChangedVals = dataView->getRowChangedVals(nSelItem);
-
-	// delete row from database 
-	std::wstring sqlDelete = L"DELETE FROM ";
-	std::wstring primaryKey;
+	std::unordered_set<int> newRows(runtimeNewRows.begin(), runtimeNewRows.end());
+	RowChanges rowChanges;
 	try {
-		primaryKey = tableService->getPrimaryKeyColumn(runtimeUserDbId, runtimeTables.at(0), runtimeColumns);
+		std::wstring primaryKey = getRuntimePrimaryKey();
+		for (auto nSelItem : nSelItems) {
+			if (newRows.count(nSelItem)) {
+				continue;
+			}
+			RowChange rowChange;
+			rowChange.type = ROW_CHANGE_DELETE;
+			rowChange.iItem = nSelItem;
+			if (!makeRowChangeKeys(nSelItem, primaryKey, rowChange.keys)) {
+				continue;
+			}
+			rowChanges.push_back(rowChange);
+		}
 	} catch (QSqlExecuteException &ex) {
 		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
 		QPopAnimate::report(ex);
-		return 1;
-	}
-	std::wstring whereClause;
-	if (primaryKey.empty()) {
-		whereClause = SqlUtil::makeWhereClause(runtimeColumns, rowItem, rowChangedVals);
-	}else {
-		// check the primary key value is < AUTO > / < NULL >
-		size_t n = runtimeColumns.size();
-		for (size_t i = 0; i < n; i++) {
-			auto & column = runtimeColumns.at(i);
-			auto & val = rowItem.at(i);
-			// this row data must be a new data ,database no record before save the row data.
-			if (primaryKey == column && (val == L"< AUTO >" || val == L"< NULL >")) {
-				return 1;
-			}
-		}
-		
-		whereClause = SqlUtil::makeWhereClauseByPrimaryKey(primaryKey, runtimeColumns, rowItem, rowChangedVals);
+		return false;
 	}
-	sqlDelete.append(quo).append(tblName).append(quo).append(whereClause);
-
-	// For record sql log
-	resetRuntimeResultInfo();
-	runtimeResultInfo.userDbId = runtimeUserDbId;
-	auto bt = PerformUtil::begin();
+	return applyRowChanges(rowChanges);
+}
 
-	int effectRows = 0;
-	try {
-		auto stmt = sqlService->tryExecuteSql(runtimeUserDbId, sqlDelete);
-		effectRows = stmt.exec();		
-			
-	} catch (SQLite::QSqlException &ex) {
-		std::wstring _err(L"Error:\r\n");
-		_err.append(ex.getErrorStr()).append(L"\r\nSQL:\r\n").append(sqlDelete);
-		Q_ERROR(L"query db has error, code:{}, msg:{}", ex.getErrorCode(), _err);
-		QMessageBox::confirm(parentHwnd, _err, S(L"yes"), S(L"no"));
+/**
+ * The primary key of the runtime table, only used when the runtime columns has not the rowid column.
+ */
+std::wstring ResultListPageAdapter::getRuntimePrimaryKey()
+{
+	if (runtimeColumns.at(0) == L"_ct_sqlite_rowid") {
+		return std::wstring();
+	}
+	return tableService->getPrimaryKeyColumn(runtimeUserDbId, runtimeTables.at(0), runtimeColumns);
+}
 
-		// For record sql log
-		runtimeResultInfo.code = ex.getErrorCode();
-		runtimeResultInfo.msg = ex.getErrorStr();
+/**
+ * The index of runtimeColumns/runtimeDatas for the iSubItem of dataView, the same as fillDataInListViewSubItem.
+ */
+int ResultListPageAdapter::getRuntimeColumnIndex(int iSubItem)
+{
+	if (resultType == QUERY_TABLE_DATA || runtimeColumns.at(0) == L"_ct_sqlite_rowid") {
+		return iSubItem;
 	}
+	return iSubItem - 1;
+}
 
-	// For record sql log
-	runtimeResultInfo.sql = sqlDelete;
-	runtimeResultInfo.effectRows = effectRows;	
-	runtimeResultInfo.execTime = PerformUtil::end(bt);
-	runtimeResultInfo.transferTime = PerformUtil::end(bt);
-	runtimeResultInfo.totalTime = PerformUtil::end(bt);
-	sendExecSqlMessage(runtimeResultInfo, true);
-	return effectRows;
+RowValueType ResultListPageAdapter::toRowValueType(QResultType resultType)
+{
+	switch (resultType) {
+	case QRESULT_NULL:
+		return ROW_VALUE_NULL;
+	case QRESULT_INTEGER:
+		return ROW_VALUE_INTEGER;
+	case QRESULT_FLOAT:
+		return ROW_VALUE_FLOAT;
+	default:
+		return ROW_VALUE_TEXT;
+	}
 }
 
 bool ResultListPageAdapter::isDirty()
@@ -1312,11 +1673,9 @@ bool ResultListPageAdapter::restoreChangeVals()
 	int n = static_cast<int>(changeVals.size());
 	for (int i = n - 1; i >= 0; i--) {
 		auto item = changeVals.at(i);
-		auto iter = runtimeDatas.begin();
-		for (int j = 0; j < item.iItem; j++) {
-			iter++;
+		if (runtimeDatas.isLoaded(item.iItem)) {
+			runtimeDatas.setString(item.iItem, item.iSubItem - 1, item.origVal);
 		}
-		(*iter).at(item.iSubItem - 1) = item.origVal;
 
 		// invalidate the subitem
 		invalidateSubItem(item.iItem, item.iSubItem);
@@ -1349,22 +1708,156 @@ void ResultListPageAdapter::resetRuntimeResultInfo()
 	runtimeResultInfo.msg.clear();
 }
 
-void ResultListPageAdapter::sortRuntimeDatas(int index, bool isDown)
+/**
+ * Sort the runtime datas by the column, the sort keys are computed once by QResultSorter.
+ * If the rows are more than RESULT_ASYNC_SORT_ROWS, the sort runs in a worker thread and the list view keeps responsive,
+ * the worker thread sends MSG_RESULT_SORTED_ID to parent window when it has done, then call finishSortRuntimeDatas().
+ * 
+ * @param index - the column index of runtimeDatas
+ * @param isDown - true is descending, false is ascending
+ * @return true if the runtime datas has been sorted, false if the sort runs in the worker thread
+ */
+bool ResultListPageAdapter::sortRuntimeDatas(int index, bool isDown)
 {	
-	runtimeDatas.sort([&index, &isDown](const RowItem & item1, const RowItem & item2) {
-		auto val1 = item1.at(index);
-		auto val2 = item2.at(index);
-		val1 = (val1 == L"< AUTO >" || val1 == L"< NULL >") ? L"" : val1;
-		val2 = (val2 == L"< AUTO >" || val2 == L"< NULL >") ? L"" : val2;
-		//Notice : don't verify if val1 and val2 is empty.
-		if (StringUtil::isDecimal(val1) && StringUtil::isDecimal(val2)) {
-			auto v1 = val1.empty() ? 0 : std::stold(val1);
-			auto v2 = val2.empty() ? 0 : std::stold(val2);
-			return isDown ? v1 > v2 : v1 < v2;
+	// the query that has more rows is sorted by SQLite, except the rows can't be re-queried, 
+	// such as the result of PRAGMA/EXPLAIN or the new rows are not saved, they are fetched at once
+	loadAllRuntimeData();
+	if (index < 0 || index >= runtimeDatas.getColumnCount() || isRuntimeDataEvicted()) {
+		return false;
+	}
+	// sort the row indexes of runtimeDatas, the cells of the columns don't move
+	auto sorter = std::make_shared<QResultSorter>(runtimeDatas, index);
+	if (runtimeDatas.size() < RESULT_ASYNC_SORT_ROWS) {
+		runtimeSorter.reset();
+		sorter->sort(isDown);
+		runtimeDatas.setRowIndexes(sorter->getRowIndexes());
+		return true;
+	}
+
+	// the result of the previous sort will be ignored if it has not done
+	runtimeSorter = sorter;
+	uint32_t sortSeq = ++runtimeSortSeq;
+	HWND hwnd = parentHwnd;
+	std::thread([sorter, isDown, sortSeq, hwnd]() {
+		sorter->sort(isDown);
+		::PostMessage(hwnd, Config::MSG_RESULT_SORTED_ID, WPARAM(sortSeq), NULL);
+	}).detach();
+	return false;
+}
+
+/**
+ * Apply the row indexes of the worker thread sorted, handle the MSG_RESULT_SORTED_ID message.
+ * 
+ * @param sortSeq - the sequence of the sort, the result is ignored if it is not the last sort
+ */
+void ResultListPageAdapter::finishSortRuntimeDatas(uint32_t sortSeq)
+{
+	if (!runtimeSorter || sortSeq != runtimeSortSeq) {
+		return;
+	}
+	auto sorter = runtimeSorter;
+	runtimeSorter.reset();
+	if (sorter->getRowIndexes().size() != static_cast<size_t>(runtimeDatas.size())) {
+		return;
+	}
+	runtimeDatas.setRowIndexes(sorter->getRowIndexes());
+	dataView->Invalidate(true);
+}
+
+/**
+ * Check the sort of column should be pushed down to SQLite.
+ * The query has more rows, so the remain rows are not fetched on the UI thread for sorting in memory,
+ * or for the select sql of single table, the rows are truncated by LIMIT settings, 
+ * or the rows are many and the column is ordered by an index, so SQLite reads the rows in order without sorting.
+ * 
+ * @param index - the column index of runtimeDatas
+ * @return 
+ */
+bool ResultListPageAdapter::isSortRuntimeDatasInDb(int index)
+{
+	if (index < 0 || index >= static_cast<int>(runtimeColumns.size())
+		|| !runtimeNewRows.empty() || !SqlUtil::isSelectSql(originSql) || StringUtil::startWith(originSql, L"explain", true)) {
+		return false;
+	}
+	if (hasMoreRuntimeData() || isRuntimeDataEvicted()) {
+		return true;
+	}
+	if (runtimeTables.size() != 1) {
+		return false;
+	}
+
+	if (!SqlUtil::hasLimitClause(originSql)) {
+		LimitParams limitParams;
+		loadLimitParams(settingPrefix, limitParams);
+		if (limitParams.checked && runtimeDatas.size() >= limitParams.rows) {
+			return true;
 		}
-		return isDown ? val1 > val2 : val1 < val2;
-	});
+	}
+
+	if (runtimeDatas.size() < RESULT_ASYNC_SORT_ROWS) {
+		return false;
+	}
+	try {
+		return tableService->isOrderedByIndex(runtimeUserDbId, runtimeTables.at(0), runtimeColumns.at(index));
+	} catch (QSqlExecuteException &ex) {
+		Q_ERROR(L"error{}, msg:{}", ex.getCode(), ex.getMsg());
+		return false;
+	}
 }
 
+/**
+ * Re-run the runtime sql with ORDER BY the column in the worker thread of the executor, 
+ * the rows are loaded by finishFetchRuntimeData() when the first page of the sorted query has been fetched.
+ * The result of the query page is sorted by the executor that has executed it, so the sorted query reads the same connection,
+ * the others are sorted by the executor of this adapter.
+ * The filters and the LIMIT settings are applied to the sorted rows, so the rows shown are the first rows of the order.
+ * 
+ * @param index - the column index of runtimeDatas
+ * @param isDown - true is descending, false is ascending
+ */
+void ResultListPageAdapter::sortRuntimeDatasInDb(int index, bool isDown)
+{
+	std::wstring sql = runtimeFilters.empty() ? originSql : buildRungtimeSqlWithFilters(false);
+	std::wstring sortedSql = SqlUtil::makeOrderBySelectSql(sql, index + 1, isDown);
+	if (sortedSql.empty()) {
+		return;
+	}
+	if (!SqlUtil::hasLimitClause(originSql)) {
+		appendLimitClause(settingPrefix, sortedSql);
+	}
 
+	QSqlExecutor * executor = runtimeExecutor;
+	if (!executor) {
+		if (!adapterExecutor) {
+			adapterExecutor.reset(new QSqlExecutor());
+		}
+		executor = adapterExecutor.get();
+	}
+	if (executor->isRunning()) {
+		QPopAnimate::warn(parentHwnd, S(L"query-is-running"));
+		return;
+	}
+	// the page fetching of the unsorted query is short, wait for it
+	executor->waitFetch();
+
+	dataView->DeleteAllItems();
+	dataView->clearChangeVals();
+	dataView->destroySubItemElems();
+	closeRuntimeQuery();
+	runtimeSorter.reset();
+	runtimeDatas.clear();
+	resetRuntimeResultInfo();
 
+	runtimeSql = sortedSql;
+	runtimeResultInfo.sql = runtimeSql;
+	runtimeResultInfo.userDbId = runtimeUserDbId;
+	runtimeExecutor = executor;
+	runtimeCursorId = 0;
+	runtimeFetchedRows = 0;
+	runtimeHasMore = true;
+	requestRuntimeData(RESULT_FETCH_PAGE_ROWS);
+	if (!runtimeFetchSeq) {
+		closeRuntimeQuery();
+	}
+	::PostMessage(parentHwnd, Config::MSG_RESULT_ROWS_CHANGE_ID, WPARAM(0), LPARAM(hasMoreRuntimeData() ? 0 : 1));
+}
\ No newline at end of file
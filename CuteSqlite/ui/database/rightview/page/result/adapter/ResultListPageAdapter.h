@@ -23,11 +23,15 @@
 #include <string>
 #include <list>
 #include <tuple>
+#include <memory>
 #include "ui/common/adapter/QAdapter.h"
 #include "core/service/db/SqlService.h"
 #include "core/service/db/DatabaseService.h"
 #include "core/service/db/TableService.h"
 #include "core/common/repository/QSqlStatement.h"
+#include "core/common/repository/QResultSet.h"
+#include "core/common/repository/QResultSorter.h"
+#include "core/common/repository/QSqlExecutor.h"
 #include "ui/common/listview/QListViewCtrl.h"
 
 /**
@@ -45,6 +49,12 @@ typedef enum {
 } ResultType;
 
 #define TABLE_DATA_SETTING_PREFIX L"table-data-"
+// the rows of one page fetched from the opened query when the list view scrolls
+#define RESULT_FETCH_PAGE_ROWS 500
+// the rows of the runtime datas that will be sorted in the worker thread
+#define RESULT_ASYNC_SORT_ROWS 50000
+// the max rows of a large result kept in memory, the rows far before the visible rows are evicted
+#define RESULT_WINDOW_ROWS 100000
 class ResultListPageAdapter : public QAdapter<ResultListPageAdapter, QListViewCtrl>
 {
 public:
@@ -52,14 +62,31 @@ public:
 	~ResultListPageAdapter();
 
 	int loadListView(uint64_t userDbId, std::wstring & sql);
+	// load the result that the query has been executed by QSqlExecutor
+	int loadListView(uint64_t userDbId, std::wstring & sql, QSqlExecResult & execResult);
+	// the sql that the query page really executes, append the LIMIT clause of the settings
+	static std::wstring buildRuntimeSql(const std::wstring & settingPrefix, const std::wstring & sql);
 	
 	// Add filters for result list
 	int loadFilterListView();
 
 	bool sortListView(int iItem);
+	void finishSortRuntimeDatas(uint32_t sortSeq);
 
 	// virtual list data load
 	LRESULT fillDataInListViewSubItem(NMLVDISPINFO * pLvdi);
+	// fetch the next page from the opened query when the list view needs the rows near the end, or fetch the evicted rows again
+	void prepareRuntimeData(int iFrom, int iTo);
+	// append the rows that the worker thread of QSqlExecutor has fetched
+	void finishFetchRuntimeData(uint32_t fetchSeq);
+	// fetch all the remain rows and the evicted rows, return the total rows
+	int loadAllRuntimeData();
+	// close the opened query before DDL, it will be reopened when fetching the next page
+	void releaseRuntimeQuery();
+	bool hasMoreRuntimeData() { return runtimeHasMore; }
+	// the item count of the list view, include the evicted rows
+	int getRuntimeItemCount();
+	bool isRuntimeDataEvicted();
 
 	RowItem getFirstSelectdRowItem();
 	int getFirstSelectdIndex();
@@ -73,7 +100,7 @@ public:
 	void setRuntimeTables(const UserTableStrings & val);
 	const Columns & getRuntimeColumns() ;
 	void setRuntimeColumns(const Columns & columns);
-	const DataList & getRuntimeDatas();
+	const QResultSet & getRuntimeDatas();
 	void setRuntimeDatas(const DataList & dataList);
 
 	void addListViewChangeVal(SubItemValue &subItemVal);
@@ -107,8 +134,6 @@ public:
 	bool remove(bool confirm=true);
 	bool cancel();
 
-	int removeRowFromDb(int nSelItem, RowItem & rowItem);
-
 	bool isDirty();
 
 	// query result info
@@ -127,7 +152,17 @@ private:
 
 	UserTableStrings runtimeTables;
 	Columns runtimeColumns;
-	DataList runtimeDatas;   // runtime data(s) for showing list view
+	QResultSet runtimeDatas;   // runtime data(s) for showing list view, random access by row index
+	bool runtimeHasMore = false; // the query has more rows to fetch by runtimeExecutor
+	QSqlExecutor * runtimeExecutor = nullptr; // the executor that has executed the query, the remain rows are fetched by its worker thread
+	uint32_t runtimeCursorId = 0; // the opened query kept by runtimeExecutor
+	uint32_t runtimeFetchSeq = 0; // the fetch running in the worker thread of runtimeExecutor, 0 if none
+	std::unique_ptr<QSqlExecutor> adapterExecutor; // fetch and sort the rows of the result that has not been executed by QSqlExecutor
+	int runtimeFetchedRows = 0; // the rows fetched from the query, skipped when the released query is reopened
+	int runtimeFetchFirstRow = -1; // the running fetch replaces runtimeDatas beginning from this row, -1 if it appends the next rows
+	int runtimeItemCount = 0; // the item count of the list view if the rows after runtimeDatas have been evicted, otherwise 0
+	std::shared_ptr<QResultSorter> runtimeSorter; // the sorter running in the worker thread
+	uint32_t runtimeSortSeq = 0;
 	std::vector<int> runtimeNewRows; // runtimeDatas index for create or copy a new row
 	ResultInfo runtimeResultInfo;
 
@@ -137,19 +172,31 @@ private:
 	std::wstring settingPrefix;
 
 	void loadRuntimeTables(uint64_t userDbId, std::wstring & sql);
-	void loadRuntimeHeader(QSqlStatement & query);
+	void loadRuntimeHeader(const Columns & columns);
 	void clearHeaderSorted(int notSelItem = -1);
 	int loadRuntimeData(QSqlStatement & query);
-	void loadLimitParams(LimitParams & limitParams);
+	void requestRuntimeData(int nRows, int firstRow = -1);
+	void evictRuntimeData(int iFrom);
+	void closeRuntimeQuery();
+	static void loadLimitParams(const std::wstring & settingPrefix, LimitParams & limitParams);
+	static void appendLimitClause(const std::wstring & settingPrefix, std::wstring & sql);
 
 	bool getIsChecked(int iItem);
 
-	std::wstring buildRungtimeSqlWithFilters();
+	std::wstring buildRungtimeSqlWithFilters(bool withLimit = true);
 
 	//save datas
-	bool saveChangeVals();
-	bool saveNewRows();
+	void makeUpdateRowChanges(RowChanges & rowChanges);
+	void makeInsertRowChanges(RowChanges & rowChanges);
+	bool makeRowChangeKeys(int iItem, const std::wstring & primaryKey, RowChangeValues & keys);
+	bool applyRowChanges(RowChanges & rowChanges);
+	bool removeRowsFromDb(const std::vector<int> & nSelItems);
+	std::wstring getRuntimePrimaryKey();
+	int getRuntimeColumnIndex(int iSubItem);
+	static RowValueType toRowValueType(QResultType resultType);
 	bool restoreChangeVals();
 	void resetRuntimeResultInfo();
-	void sortRuntimeDatas(int index, bool isDown);
+	bool sortRuntimeDatas(int index, bool isDown);
+	bool isSortRuntimeDatasInDb(int index);
+	void sortRuntimeDatasInDb(int index, bool isDown);
 };
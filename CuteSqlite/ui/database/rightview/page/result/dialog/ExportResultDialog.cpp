@@ -23,6 +23,7 @@
 #include "utils/FontUtil.h"
 #include "ui/common/message/QPopAnimate.h"
 #include "ui/common/message/QMessageBox.h"
+#include "core/common/repository/QSqlException.h"
 
 ExportResultDialog::ExportResultDialog(HWND parentHwnd, ResultListPageAdapter * adapter)
 {
@@ -916,55 +917,80 @@ void ExportResultDialog::OnClickYesButton(UINT uNotifyCode, int nID, HWND hwnd)
 	saveExportPath(exportPath);
 
 	HWND selHwnd = getSelExportFmtHwnd();
-	DataList datas = adapter->getRuntimeDatas();
 	Columns columns = adapter->getRuntimeColumns();
 	int exportRows = 0;
 	std::wstring fmt;
-	if (selHwnd == csvRadio.m_hWnd) {
-		ExportCsvParams csvParams;
-		if (!getExportCsvParams(csvParams)) {
-			yesButton.EnableWindow(true);
-			return ;
-		}
-		exportRows = exportResultService->exportToCsv(exportPath, columns, selectedColumns, datas, csvParams);
-		saveExportCsvParams(csvParams);
-		fmt = L"CSV";
-	} else if (selHwnd == jsonRadio.m_hWnd) { 
-		exportRows = exportResultService->exportToJson(exportPath, columns, selectedColumns, datas);
-		fmt = L"JSON";
-	} else if (selHwnd == htmlRadio.m_hWnd) { 
-		exportRows = exportResultService->exportToHtml(exportPath, columns, selectedColumns, datas);
-		fmt = L"HTML";
-	} else if (selHwnd == xmlRadio.m_hWnd) { 
-		exportRows = exportResultService->exportToXml(exportPath, columns, selectedColumns, datas);
-		fmt = L"XML";
-	} else if (selHwnd == excelXmlRadio.m_hWnd) {
-		ExportExcelParams excelParams;
-		if (!getExportExcelParams(excelParams)) {
-			yesButton.EnableWindow(true);
-			return ;
-		}
-		exportRows = exportResultService->exportToExcelXml(exportPath, columns, selectedColumns, datas, excelParams);
-		saveExportExcelParams(excelParams);
-		fmt = L"EXCEL";
-	} else if (selHwnd == sqlRadio.m_hWnd) {
-		ExportSqlParams sqlParams;
-		if (!getExportSqlParams(sqlParams)) {
-			yesButton.EnableWindow(true);
-			return ;
-		}
-		UserTableStrings tbls = adapter->getRuntimeTables();
-		if (tbls.empty() || tbls.size() > 1) {
-			QPopAnimate::error(m_hWnd, S(L"sql-notsupport-multitable-query-error"));
-			sqlRadio.SetFocus();
-			yesButton.EnableWindow(true);
-			return ;
+	try {
+		// export all the rows, if the list view has not fetched all the rows and has no changes, 
+		// the rows are read from the query directly and are not held in memory
+		std::unique_ptr<QSqlStatement> query;
+		std::unique_ptr<QResultCursor> cursor;
+		if (adapter->hasMoreRuntimeData() && !adapter->isDirty()) {
+			query.reset(new QSqlStatement(sqlService->tryExecuteSql(adapter->getRuntimeUserDbId(), adapter->getRuntimeSql())));
+			cursor.reset(new QSqlStatementCursor(*query));
+		} else {
+			adapter->loadAllRuntimeData();
+			cursor.reset(new QResultSetCursor(adapter->getRuntimeDatas()));
 		}
+		QResultCursor & datas = *cursor;
+		if (selHwnd == csvRadio.m_hWnd) {
+			ExportCsvParams csvParams;
+			if (!getExportCsvParams(csvParams)) {
+				yesButton.EnableWindow(true);
+				return ;
+			}
+			exportRows = exportResultService->exportToCsv(exportPath, columns, selectedColumns, datas, csvParams);
+			saveExportCsvParams(csvParams);
+			fmt = L"CSV";
+		} else if (selHwnd == jsonRadio.m_hWnd) { 
+			exportRows = exportResultService->exportToJson(exportPath, columns, selectedColumns, datas);
+			fmt = L"JSON";
+		} else if (selHwnd == htmlRadio.m_hWnd) { 
+			exportRows = exportResultService->exportToHtml(exportPath, columns, selectedColumns, datas);
+			fmt = L"HTML";
+		} else if (selHwnd == xmlRadio.m_hWnd) { 
+			exportRows = exportResultService->exportToXml(exportPath, columns, selectedColumns, datas);
+			fmt = L"XML";
+		} else if (selHwnd == excelXmlRadio.m_hWnd) {
+			ExportExcelParams excelParams;
+			if (!getExportExcelParams(excelParams)) {
+				yesButton.EnableWindow(true);
+				return ;
+			}
+			exportRows = exportResultService->exportToExcelXml(exportPath, columns, selectedColumns, datas, excelParams);
+			saveExportExcelParams(excelParams);
+			fmt = L"EXCEL";
+		} else if (selHwnd == sqlRadio.m_hWnd) {
+			ExportSqlParams sqlParams;
+			if (!getExportSqlParams(sqlParams)) {
+				yesButton.EnableWindow(true);
+				return ;
+			}
+			UserTableStrings tbls = adapter->getRuntimeTables();
+			if (tbls.empty() || tbls.size() > 1) {
+				QPopAnimate::error(m_hWnd, S(L"sql-notsupport-multitable-query-error"));
+				sqlRadio.SetFocus();
+				yesButton.EnableWindow(true);
+				return ;
+			}
 
-		UserTable userTable = adapter->getRuntimeUserTable(tbls.at(0));
-		exportRows = exportResultService->exportToSql(exportPath, userTable, columns, selectedColumns, datas, sqlParams);
-		saveExportSqlParams(sqlParams);
-		fmt = L"SQL";
+			UserTable userTable = adapter->getRuntimeUserTable(tbls.at(0));
+			exportRows = exportResultService->exportToSql(exportPath, userTable, columns, selectedColumns, datas, sqlParams);
+			saveExportSqlParams(sqlParams);
+			fmt = L"SQL";
+		}
+	} catch (SQLite::QSqlException &ex) {
+		std::wstring _err = ex.getErrorStr();
+		Q_ERROR(L"export the query result has error:{}, msg:{}", ex.getErrorCode(), _err);
+		QSqlExecuteException _ex(std::to_wstring(ex.getErrorCode()), _err, adapter->getRuntimeSql());
+		QPopAnimate::report(_ex);
+		yesButton.EnableWindow(true);
+		return ;
+	} catch (QRuntimeException &ex) {
+		Q_ERROR(L"export the query result has error:{}, msg:{}", ex.getCode(), ex.getMsg());
+		QPopAnimate::report(ex);
+		yesButton.EnableWindow(true);
+		return ;
 	}
 	
 	saveExportFmt(fmt);	
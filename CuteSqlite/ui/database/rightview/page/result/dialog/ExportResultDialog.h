@@ -47,6 +47,7 @@ private:
 	ResultListPageAdapter * adapter = nullptr;
 	SettingService * settingService = SettingService::getInstance();
 	ExportResultService * exportResultService = ExportResultService::getInstance();
+	SqlService * sqlService = SqlService::getInstance();
 
 	COLORREF lineColor = RGB(127, 127, 127);
 	CPen linePen = nullptr;
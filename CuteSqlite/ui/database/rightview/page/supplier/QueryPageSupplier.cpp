@@ -20,6 +20,7 @@
 #include "stdafx.h"
 #include "QueryPageSupplier.h"
 #include "utils/StringUtil.h"
+#include "utils/SqlLexer.h"
 #include "utils/ResourceUtil.h"
 
 
@@ -182,10 +183,9 @@ void QueryPageSupplier::splitToSqlVector(std::wstring sql)
 		return;
 	} 
 	
-	if (sql.find(L';') == std::wstring::npos) {
-		sqlVector.push_back(sql);
-		return ;
+	// the ";" in the strings, comments and trigger body doesn't split the statements
+	sqlVector = SqlLexer::splitStatements(sql, true);
+	for (auto & statement : sqlVector) {
+		StringUtil::convertQuotes(statement);
 	}
-
-	sqlVector = StringUtil::splitNotIn(sql, L";", L"BEGIN", L"END", L"TRANSACTION", true);
 }
@@ -314,7 +314,7 @@ std::pair<std::wstring,std::wstring> TableColumnsPageAdapter::generateInsertColu
 		if (iter == colsOrigDatas.end()) {
 			continue;
 		}
-		if (i > 0) {
+		if (!str1.empty()) {
 			str1.append(L",");
 			str2.append(L",");
 		}
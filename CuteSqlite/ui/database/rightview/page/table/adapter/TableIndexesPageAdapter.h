@@ -50,6 +50,7 @@ public:
 	void clickListViewSubItem(NMITEMACTIVATE * clickItem);
 	std::wstring generateConstraintsClause(bool hasAutoIncrement = false);
 	std::vector<std::wstring> generateCreateIndexesDDL(const std::wstring & schema, const std::wstring & tblName);
+	void generateOneCreateIndexDDL(const IndexInfo &item, const std::wstring & schema, const std::wstring &tblName, std::wstring &ss);
 	void changePrimaryKey(ColumnInfoList & pkColumns);
 	void deleteTableColumnName(const std::wstring & columnName);
 
@@ -75,7 +76,6 @@ private:
 	int getSelIndexType(const std::wstring & dataType);
 	void removeSelectedItem(int nSelItem);
 	void generateOneConstraintClause(const IndexInfo &item, bool hasAutoIncrement, std::wstring &ss);
-	void generateOneCreateIndexDDL(const IndexInfo &item, const std::wstring & schema, const std::wstring &tblName, std::wstring &ss);
 	
 	bool changeListViewCheckBox(int iItem, int iSubItem);
 	void refreshPreviewSql();
@@ -94,6 +94,7 @@ LRESULT GeneralSettingsView::OnChangeLanguageComboBox(UINT uNotifyCode, int nID,
 		}else {
 			settingSerivce->saveLanguagePath(savePath);
 			settingSerivce->getAllIniSetting(true); // ¼
+			Lang::load();
 		}
 		
 	} catch (QRuntimeException &e) {
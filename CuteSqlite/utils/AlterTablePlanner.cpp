@@ -0,0 +1,435 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   AlterTablePlanner.cpp
+ * @brief  Diff the original and runtime columns/indexes/foreign keys of the table structure page,
+ *         plan the native ALTER TABLE and index DDL statements, or a rebuild if SQLite can't alter it.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "AlterTablePlanner.h"
+#include <algorithm>
+#include <cwctype>
+#include "core/common/Lang.h"
+#include "utils/EntityUtil.h"
+#include "utils/SqlUtil.h"
+#include "utils/StringUtil.h"
+
+// the type of IndexInfo that is created by CREATE INDEX, the others are the constraints of CREATE TABLE
+#define ALTER_TABLE_INDEX_TYPE L"Index"
+
+AlterTablePlanner::AlterTablePlanner(const std::wstring & schema, const std::wstring & origTblName, const std::wstring & tblName)
+	: schema(schema), origTblName(origTblName), tblName(tblName)
+{
+}
+
+/**
+ * Plan the statements of altering table, the columns of original and runtime are matched by ColumnInfo::seq.
+ * SQLite can rename the table, rename/add/drop a column and drop/create the index without copying the rows,
+ * the others such as changing the type of a column or the constraints need to rebuild the table.
+ *
+ * @param origColumns - the columns loaded from db
+ * @param columns - the columns edited in TableColumnsPage
+ * @param origIndexes - the indexes and constraints loaded from db
+ * @param indexes - the indexes and constraints edited in TableIndexesPage
+ * @param origForeignKeys - the foreign keys loaded from db
+ * @param foreignKeys - the foreign keys edited in TableForeignkeysPage
+ * @return the plan
+ */
+AlterTablePlan AlterTablePlanner::plan(const ColumnInfoList & origColumns, const ColumnInfoList & columns,
+	const IndexInfoList & origIndexes, const IndexInfoList & indexes,
+	const ForeignKeyList & origForeignKeys, const ForeignKeyList & foreignKeys)
+{
+	renamedColumns.clear();
+	droppedColumns.clear();
+	addedColumns.clear();
+
+	std::wstring reason;
+	if (!diffColumns(origColumns, columns, reason)) {
+		return rebuild(reason);
+	}
+
+	// 1.The constraints in CREATE TABLE can't be altered, the renamed columns in them are updated by RENAME COLUMN
+	IndexInfoList origConstraints, constraints, origIdxes, idxes;
+	for (auto & item : origIndexes) {
+		if (isEmptyIndex(item)) {
+			continue;
+		}
+		if (item.type == ALTER_TABLE_INDEX_TYPE) {
+			origIdxes.push_back(renameColumns(item));
+		} else {
+			origConstraints.push_back(renameColumns(item));
+		}
+	}
+	for (auto & item : indexes) {
+		if (isEmptyIndex(item)) {
+			continue;
+		}
+		if (item.type == ALTER_TABLE_INDEX_TYPE) {
+			idxes.push_back(item);
+		} else {
+			constraints.push_back(item);
+		}
+	}
+	if (origConstraints.size() != constraints.size()) {
+		return rebuild(S(L"alter-table-rebuild-constraints-changed"));
+	}
+	for (size_t i = 0; i < constraints.size(); i++) {
+		if (!EntityUtil::compare(origConstraints.at(i), constraints.at(i))) {
+			return rebuild(StringUtil::replace(S(L"alter-table-rebuild-constraint-changed"), L"{constraint}",
+				constraints.at(i).type + L"(" + constraints.at(i).columns + L")"));
+		}
+	}
+
+	// 2.The foreign keys are in CREATE TABLE too
+	ForeignKeyList origFrks, frks;
+	for (auto & item : origForeignKeys) {
+		if (!item.columns.empty() || !item.referencedTable.empty()) {
+			origFrks.push_back(renameColumns(item));
+		}
+	}
+	for (auto & item : foreignKeys) {
+		if (!item.columns.empty() || !item.referencedTable.empty()) {
+			frks.push_back(item);
+		}
+	}
+	if (origFrks.size() != frks.size()) {
+		return rebuild(S(L"alter-table-rebuild-foreign-keys-changed"));
+	}
+	for (size_t i = 0; i < frks.size(); i++) {
+		if (!EntityUtil::compare(origFrks.at(i), frks.at(i))) {
+			return rebuild(StringUtil::replace(S(L"alter-table-rebuild-foreign-key-changed"), L"{foreignKey}", frks.at(i).name));
+		}
+	}
+
+	// 3.The changed index is dropped and created again
+	AlterTablePlan result;
+	IndexInfoList droppedIdxes, keptIdxes;
+	for (auto & origItem : origIdxes) {
+		auto iter = std::find_if(idxes.begin(), idxes.end(), [&origItem](const IndexInfo & item) {
+			return EntityUtil::compare(origItem, item);
+		});
+		if (iter == idxes.end()) {
+			droppedIdxes.push_back(origItem);
+		} else {
+			keptIdxes.push_back(origItem);
+		}
+	}
+	for (auto & item : idxes) {
+		auto iter = std::find_if(origIdxes.begin(), origIdxes.end(), [&item](const IndexInfo & origItem) {
+			return EntityUtil::compare(origItem, item);
+		});
+		if (iter == origIdxes.end()) {
+			result.createIndexes.push_back(item);
+		}
+	}
+
+	if (!verifyDroppedColumns(origColumns, keptIdxes, origConstraints, origFrks, reason)
+		|| !verifyAddedColumns(reason)) {
+		return rebuild(reason);
+	}
+
+	// 4.Generate the statements, the columns are dropped before renaming, so a column can be renamed to the dropped name
+	if (origTblName != tblName) {
+		result.sqls.push_back(L"ALTER TABLE " + formatTblName(origTblName) + L" RENAME TO " + quo + tblName + quo + edl);
+	}
+	std::wstring fmtTblName = formatTblName(tblName);
+	for (auto & item : droppedIdxes) {
+		std::wstring sql = L"DROP INDEX IF EXISTS ";
+		if (!schema.empty() && schema != L"main") {
+			sql.append(quo).append(schema).append(quo).append(dot);
+		}
+		sql.append(quo).append(item.name).append(quo).append(edl);
+		result.sqls.push_back(sql);
+	}
+	for (auto & name : droppedColumns) {
+		result.sqls.push_back(L"ALTER TABLE " + fmtTblName + L" DROP COLUMN " + quo + name + quo + edl);
+	}
+	for (auto & pair : renamedColumns) {
+		result.sqls.push_back(L"ALTER TABLE " + fmtTblName + L" RENAME COLUMN "
+			+ quo + pair.first + quo + L" TO " + quo + pair.second + quo + edl);
+	}
+	for (auto item : addedColumns) {
+		std::wstring sql = L"ALTER TABLE " + fmtTblName + L" ADD COLUMN ";
+		sql.append(quo).append(item->name).append(quo).append(blk).append(item->type);
+		if (item->notnull) {
+			sql.append(L" NOT NULL");
+		}
+		// ADD COLUMN doesn't allow the default value in parentheses
+		if (!item->defVal.empty()) {
+			sql.append(L" DEFAULT ").append(item->defVal);
+		}
+		if (!item->checks.empty()) {
+			sql.append(L" CHECK(").append(item->checks).append(L")");
+		}
+		sql.append(edl);
+		result.sqls.push_back(sql);
+	}
+	result.type = result.sqls.empty() && result.createIndexes.empty() ? ALTER_TABLE_NONE : ALTER_TABLE_NATIVE;
+	return result;
+}
+
+AlterTablePlan AlterTablePlanner::rebuild(const std::wstring & reason)
+{
+	AlterTablePlan result;
+	result.type = ALTER_TABLE_REBUILD;
+	result.reason = reason;
+	return result;
+}
+
+/**
+ * Match the runtime columns to the original columns, the kept columns must be in the original order,
+ * and the added columns must be after them, because ADD COLUMN appends the column to the end.
+ *
+ * @return false if the table must be rebuilt
+ */
+bool AlterTablePlanner::diffColumns(const ColumnInfoList & origColumns, const ColumnInfoList & columns, std::wstring & reason)
+{
+	std::vector<bool> isKept(origColumns.size(), false);
+	int lastOrigIndex = -1;
+	for (auto & item : columns) {
+		auto iter = std::find_if(origColumns.begin(), origColumns.end(), [&item](const ColumnInfo & origItem) {
+			return origItem.seq == item.seq;
+		});
+		if (iter == origColumns.end()) {
+			addedColumns.push_back(&item);
+			continue;
+		}
+		if (!addedColumns.empty()) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-added-column-not-last"), L"{column}", addedColumns.back()->name);
+			return false;
+		}
+		int origIndex = static_cast<int>(iter - origColumns.begin());
+		if (origIndex < lastOrigIndex) {
+			reason = S(L"alter-table-rebuild-columns-order-changed");
+			return false;
+		}
+		lastOrigIndex = origIndex;
+		isKept[origIndex] = true;
+		if (!isSameColumnDefine(*iter, item)) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-column-changed"), L"{column}", iter->name);
+			return false;
+		}
+		if (iter->name != item.name) {
+			renamedColumns[iter->name] = item.name;
+		}
+	}
+	if (lastOrigIndex == -1 && !origColumns.empty()) {
+		reason = S(L"alter-table-rebuild-all-columns-dropped");
+		return false;
+	}
+
+	size_t n = origColumns.size();
+	for (size_t i = 0; i < n; i++) {
+		if (!isKept[i]) {
+			droppedColumns.push_back(origColumns.at(i).name);
+		}
+	}
+
+	// RENAME COLUMN a TO b fails if the column b exists, such as swapping the names of two columns
+	for (auto & pair : renamedColumns) {
+		std::wstring upNewName = StringUtil::toupper(pair.second);
+		for (size_t i = 0; i < n; i++) {
+			auto & origName = origColumns.at(i).name;
+			if (isKept[i] && origName != pair.first && StringUtil::toupper(origName) == upNewName) {
+				reason = StringUtil::replace(S(L"alter-table-rebuild-column-renamed-to-other"), L"{column}", pair.first);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * DROP COLUMN fails if the column is PRIMARY KEY, UNIQUE, or used by the index, constraint or foreign key.
+ */
+bool AlterTablePlanner::verifyDroppedColumns(const ColumnInfoList & origColumns, const IndexInfoList & keptIndexes,
+	const IndexInfoList & origConstraints, const ForeignKeyList & origForeignKeys, std::wstring & reason)
+{
+	for (auto & name : droppedColumns) {
+		auto iter = std::find_if(origColumns.begin(), origColumns.end(), [&name](const ColumnInfo & item) {
+			return item.name == name;
+		});
+		if (iter != origColumns.end() && (iter->pk || iter->ai || iter->un)) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-dropped-column-is-key"), L"{column}", name);
+			return false;
+		}
+		for (auto & item : origConstraints) {
+			if (existsColumn(item.columns, name)) {
+				reason = StringUtil::replace(S(L"alter-table-rebuild-dropped-column-in-constraint"), L"{column}", name);
+				reason = StringUtil::replace(reason, L"{constraint}", item.type);
+				return false;
+			}
+		}
+		for (auto & item : keptIndexes) {
+			if (existsColumn(item.columns, name)) {
+				reason = StringUtil::replace(S(L"alter-table-rebuild-dropped-column-in-index"), L"{column}", name);
+				reason = StringUtil::replace(reason, L"{index}", item.name);
+				return false;
+			}
+		}
+		for (auto & item : origForeignKeys) {
+			if (existsColumn(item.columns, name)) {
+				reason = StringUtil::replace(S(L"alter-table-rebuild-dropped-column-in-foreign-key"), L"{column}", name);
+				reason = StringUtil::replace(reason, L"{foreignKey}", item.name);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * ADD COLUMN fails if the column is PRIMARY KEY or UNIQUE, or NOT NULL without a default value,
+ * or the default value is an expression, such as CURRENT_TIMESTAMP or (datetime('now')).
+ */
+bool AlterTablePlanner::verifyAddedColumns(std::wstring & reason)
+{
+	for (auto item : addedColumns) {
+		if (item->name.empty()) {
+			reason = S(L"alter-table-rebuild-added-column-no-name");
+			return false;
+		}
+		if (item->pk || item->ai || item->un) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-added-column-is-key"), L"{column}", item->name);
+			return false;
+		}
+		if (item->notnull && (item->defVal.empty() || StringUtil::toupper(item->defVal) == nil)) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-added-column-not-null"), L"{column}", item->name);
+			return false;
+		}
+		if (!item->defVal.empty() && !isLiteralDefault(item->defVal)) {
+			reason = StringUtil::replace(S(L"alter-table-rebuild-added-column-default-expr"), L"{column}", item->name);
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Replace the renamed column names in the comma separated columns, same as TableStructureSupplier does in the runtime indexes.
+ */
+std::wstring AlterTablePlanner::renameColumns(const std::wstring & columns) const
+{
+	if (renamedColumns.empty() || columns.empty()) {
+		return columns;
+	}
+	auto words = StringUtil::split(columns, cma);
+	for (auto & word : words) {
+		auto iter = renamedColumns.find(word);
+		if (iter != renamedColumns.end()) {
+			word = iter->second;
+		}
+	}
+	return StringUtil::implode(words, cma);
+}
+
+IndexInfo AlterTablePlanner::renameColumns(const IndexInfo & item) const
+{
+	IndexInfo result = item;
+	result.columns = renameColumns(item.columns);
+	return result;
+}
+
+ForeignKey AlterTablePlanner::renameColumns(const ForeignKey & item) const
+{
+	ForeignKey result = item;
+	result.columns = renameColumns(item.columns);
+	return result;
+}
+
+std::wstring AlterTablePlanner::formatTblName(const std::wstring & name) const
+{
+	std::wstring result;
+	if (!schema.empty() && schema != L"main") {
+		result.append(quo).append(schema).append(quo).append(dot);
+	}
+	result.append(quo).append(name).append(quo);
+	return result;
+}
+
+bool AlterTablePlanner::isSameColumnDefine(const ColumnInfo & item1, const ColumnInfo & item2)
+{
+	return item1.ai == item2.ai
+		&& item1.notnull == item2.notnull
+		&& item1.pk == item2.pk
+		&& item1.un == item2.un
+		&& item1.type == item2.type
+		&& item1.defVal == item2.defVal
+		&& item1.checks == item2.checks;
+}
+
+/**
+ * The default value of ADD COLUMN must be a constant, such as NULL, TRUE, 'str', X'0f', -1.5e3.
+ */
+bool AlterTablePlanner::isLiteralDefault(const std::wstring & defVal)
+{
+	std::wstring val = defVal;
+	StringUtil::trim(val);
+	if (val.empty()) {
+		return false;
+	}
+	std::wstring upVal = StringUtil::toupper(val);
+	if (upVal == nil || upVal == L"TRUE" || upVal == L"FALSE") {
+		return true;
+	}
+	size_t n = val.size();
+	if (n >= 2 && val.back() == L'\'' 
+		&& (val.front() == L'\'' || (n >= 3 && upVal.front() == L'X' && val.at(1) == L'\''))) {
+		return true;
+	}
+
+	size_t i = (val.front() == L'+' || val.front() == L'-') ? 1 : 0;
+	bool hasDigit = false, hasDot = false, hasExp = false;
+	for (; i < n; i++) {
+		wchar_t ch = upVal.at(i);
+		if (std::iswdigit(ch)) {
+			hasDigit = true;
+		} else if (ch == L'.' && !hasDot && !hasExp) {
+			hasDot = true;
+		} else if (ch == L'E' && hasDigit && !hasExp) {
+			hasExp = true;
+			hasDigit = false;
+			if (i + 1 < n && (upVal.at(i + 1) == L'+' || upVal.at(i + 1) == L'-')) {
+				i++;
+			}
+		} else {
+			return false;
+		}
+	}
+	return hasDigit;
+}
+
+bool AlterTablePlanner::existsColumn(const std::wstring & columns, const std::wstring & column)
+{
+	if (columns.empty()) {
+		return false;
+	}
+	std::wstring upColumn = StringUtil::toupper(column);
+	auto words = StringUtil::split(columns, cma);
+	for (auto & word : words) {
+		// such as "name DESC" or "name COLLATE NOCASE"
+		auto names = StringUtil::splitByBlank(word);
+		if (!names.empty() && StringUtil::toupper(StringUtil::cutQuotes(names.at(0))) == upColumn) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool AlterTablePlanner::isEmptyIndex(const IndexInfo & item)
+{
+	return item.type.empty() && item.columns.empty() && item.name.empty();
+}
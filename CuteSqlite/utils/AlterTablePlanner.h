@@ -0,0 +1,73 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   AlterTablePlanner.h
+ * @brief  Diff the original and runtime columns/indexes/foreign keys of the table structure page,
+ *         plan the native ALTER TABLE and index DDL statements, or a rebuild if SQLite can't alter it.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "core/entity/Entity.h"
+
+typedef enum {
+	ALTER_TABLE_NONE = 0,   // nothing changed
+	ALTER_TABLE_NATIVE,     // ALTER TABLE ... RENAME/ADD/DROP COLUMN and DROP/CREATE INDEX
+	ALTER_TABLE_REBUILD     // create a tmp table, copy the rows, drop the old table and rename
+} AlterTablePlanType;
+
+typedef struct _AlterTablePlan {
+	AlterTablePlanType type = ALTER_TABLE_NONE;
+	std::vector<std::wstring> sqls; // the native statements, in the executed order
+	IndexInfoList createIndexes;    // the indexes created after the native statements
+	std::wstring reason;            // why the table must be rebuilt
+} AlterTablePlan;
+
+class AlterTablePlanner
+{
+public:
+	AlterTablePlanner(const std::wstring & schema, const std::wstring & origTblName, const std::wstring & tblName);
+
+	AlterTablePlan plan(const ColumnInfoList & origColumns, const ColumnInfoList & columns,
+		const IndexInfoList & origIndexes, const IndexInfoList & indexes,
+		const ForeignKeyList & origForeignKeys, const ForeignKeyList & foreignKeys);
+private:
+	std::wstring schema;
+	std::wstring origTblName;
+	std::wstring tblName;
+
+	// the original column name => the new column name
+	std::unordered_map<std::wstring, std::wstring> renamedColumns;
+	std::vector<std::wstring> droppedColumns;
+	std::vector<const ColumnInfo *> addedColumns;
+
+	AlterTablePlan rebuild(const std::wstring & reason);
+	bool diffColumns(const ColumnInfoList & origColumns, const ColumnInfoList & columns, std::wstring & reason);
+	bool verifyDroppedColumns(const ColumnInfoList & origColumns, const IndexInfoList & keptIndexes,
+		const IndexInfoList & origConstraints, const ForeignKeyList & origForeignKeys, std::wstring & reason);
+	bool verifyAddedColumns(std::wstring & reason);
+
+	std::wstring renameColumns(const std::wstring & columns) const;
+	IndexInfo renameColumns(const IndexInfo & item) const;
+	ForeignKey renameColumns(const ForeignKey & item) const;
+	std::wstring formatTblName(const std::wstring & name) const;
+
+	static bool isSameColumnDefine(const ColumnInfo & item1, const ColumnInfo & item2);
+	static bool isLiteralDefault(const std::wstring & defVal);
+	static bool existsColumn(const std::wstring & columns, const std::wstring & column);
+	static bool isEmptyIndex(const IndexInfo & item);
+};
@@ -0,0 +1,202 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   ByteCodeProgram.cpp
+ * @brief  The explain rows of a statement decoded once to the instructions with integer opcode and operands,
+ *         with the address index and the def-use lists of registers, so the analysis needn't scan the rows again.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "ByteCodeProgram.h"
+#include <algorithm>
+#include <cerrno>
+#include <functional>
+#include <cwchar>
+
+// the registers out of range are ignored by the def-use lists
+#define BYTECODE_MAX_REGISTERS (1 << 20)
+
+const std::vector<int> ByteCodeProgram::emptyIndexes;
+
+ByteCodeProgram::ByteCodeProgram(const DataList & byteCodeList)
+{
+	decode(byteCodeList);
+	buildDefUse();
+}
+
+int ByteCodeProgram::indexOfAddr(int addr) const
+{
+	if (addr < 0 || addr >= static_cast<int>(addrIndexes.size())) {
+		return -1;
+	}
+	return addrIndexes.at(addr);
+}
+
+ByteCodeOp ByteCodeProgram::opcodeOfAddr(int addr) const
+{
+	int index = indexOfAddr(addr);
+	return index == -1 ? BC_OTHER : instructions.at(index).op;
+}
+
+const std::vector<int> & ByteCodeProgram::getDefs(int regNo) const
+{
+	if (regNo < 0 || regNo >= static_cast<int>(defs.size())) {
+		return emptyIndexes;
+	}
+	return defs.at(regNo);
+}
+
+const std::vector<int> & ByteCodeProgram::getUses(int regNo) const
+{
+	if (regNo < 0 || regNo >= static_cast<int>(uses.size())) {
+		return emptyIndexes;
+	}
+	return uses.at(regNo);
+}
+
+std::vector<int> ByteCodeProgram::getDefsBefore(int index, std::initializer_list<int> regNos) const
+{
+	std::vector<int> result;
+	for (int regNo : regNos) {
+		auto & regDefs = getDefs(regNo);
+		auto end = std::lower_bound(regDefs.begin(), regDefs.end(), index);
+		result.insert(result.end(), regDefs.begin(), end);
+	}
+	std::sort(result.begin(), result.end(), std::greater<int>());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+	return result;
+}
+
+void ByteCodeProgram::decode(const DataList & byteCodeList)
+{
+	instructions.reserve(byteCodeList.size());
+	for (auto & rowItem : byteCodeList) {
+		if (rowItem.size() <= EXP_COMMENT) {
+			continue;
+		}
+		ByteCodeInstruction instruction;
+		instruction.addr = toOperand(rowItem.at(EXP_ADDR));
+		instruction.op = ByteCodeUtil::toOpcode(rowItem.at(EXP_OPCODE));
+		instruction.p1 = toOperand(rowItem.at(EXP_P1));
+		instruction.p2 = toOperand(rowItem.at(EXP_P2));
+		instruction.p3 = toOperand(rowItem.at(EXP_P3));
+		instruction.p4 = toOperand(rowItem.at(EXP_P4));
+		instruction.p5 = toOperand(rowItem.at(EXP_P5));
+		instruction.row = &rowItem;
+		instructions.push_back(instruction);
+	}
+
+	// the addresses are 0..n-1 in the explain rows, so the address index is a vector
+	int n = size();
+	for (int i = 0; i < n; i++) {
+		int addr = instructions.at(i).addr;
+		if (addr < 0 || addr >= BYTECODE_MAX_REGISTERS) {
+			continue;
+		}
+		if (addr >= static_cast<int>(addrIndexes.size())) {
+			addrIndexes.resize(addr + 1, -1);
+		}
+		addrIndexes[addr] = i;
+	}
+}
+
+/**
+ * Build the def-use lists of registers for the opcodes that the analysis uses, see https://www.sqlite.org/opcode.html
+ */
+void ByteCodeProgram::buildDefUse()
+{
+	int n = size();
+	for (int i = 0; i < n; i++) {
+		auto & instruction = instructions.at(i);
+		switch (instruction.op) {
+		case BC_COLUMN: // r[P3] = column P2 of cursor P1
+			addRegisters(defs, instruction.p3, 1, i);
+			break;
+		case BC_ROWID: // r[P2] = rowid of cursor P1
+		case BC_IDX_ROWID:
+		case BC_INTEGER: // r[P2] = P1
+		case BC_REAL: // r[P2] = P4
+		case BC_STRING: // r[P2] = P4
+		case BC_STRING8:
+		case BC_BLOB:
+			addRegisters(defs, instruction.p2, 1, i);
+			break;
+		case BC_NULL: // r[P2..P3] = NULL
+			addRegisters(defs, instruction.p2,
+				instruction.p3 != BYTECODE_NULL_OPERAND && instruction.p3 > instruction.p2 ? instruction.p3 - instruction.p2 + 1 : 1, i);
+			break;
+		case BC_MAKE_RECORD: // r[P3] = mkrec(r[P1..P1+P2-1])
+			addRegisters(uses, instruction.p1, instruction.p2, i);
+			addRegisters(defs, instruction.p3, 1, i);
+			break;
+		case BC_RESULT_ROW: // output r[P1..P1+P2-1]
+			addRegisters(uses, instruction.p1, instruction.p2, i);
+			break;
+		case BC_SEEK_ROWID: // seek cursor P1 by the rowid in r[P3]
+		case BC_NOT_EXISTS:
+			addRegisters(uses, instruction.p3, 1, i);
+			break;
+		case BC_IF: // if r[P1] goto P2
+		case BC_IF_NOT:
+		case BC_IF_POS:
+			addRegisters(uses, instruction.p1, 1, i);
+			break;
+		default:
+			if (ByteCodeUtil::isSeekOp(instruction.op) || ByteCodeUtil::isIdxOp(instruction.op)) {
+				// the key is r[P3..P3+P4-1]
+				addRegisters(uses, instruction.p3, instruction.p4, i);
+			} else if (ByteCodeUtil::isCompareOp(instruction.op)) {
+				// compare r[P1] and r[P3]
+				addRegisters(uses, instruction.p1, 1, i);
+				if (instruction.p3 != instruction.p1) {
+					addRegisters(uses, instruction.p3, 1, i);
+				}
+			}
+			break;
+		}
+	}
+}
+
+void ByteCodeProgram::addRegisters(std::vector<std::vector<int>> & regIndexes, int regBegin, int regLen, int index)
+{
+	if (regBegin < 0 || regLen <= 0 || regLen == BYTECODE_NULL_OPERAND) {
+		return;
+	}
+	if (regBegin >= BYTECODE_MAX_REGISTERS || regLen > BYTECODE_MAX_REGISTERS - regBegin) {
+		return;
+	}
+	int regEnd = regBegin + regLen;
+	if (regEnd > static_cast<int>(regIndexes.size())) {
+		regIndexes.resize(regEnd);
+	}
+	for (int regNo = regBegin; regNo < regEnd; regNo++) {
+		regIndexes[regNo].push_back(index);
+	}
+}
+
+int ByteCodeProgram::toOperand(const std::wstring & val)
+{
+	if (val.empty() || val == L"< NULL >") {
+		return BYTECODE_NULL_OPERAND;
+	}
+	const wchar_t * begin = val.c_str();
+	wchar_t * end = nullptr;
+	errno = 0;
+	long n = std::wcstol(begin, &end, 10);
+	if (end == begin || *end != L'\0' || errno == ERANGE || n <= INT_MIN || n > INT_MAX) {
+		return BYTECODE_NULL_OPERAND;
+	}
+	return static_cast<int>(n);
+}
@@ -0,0 +1,76 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   ByteCodeProgram.h
+ * @brief  The explain rows of a statement decoded once to the instructions with integer opcode and operands,
+ *         with the address index and the def-use lists of registers, so the analysis needn't scan the rows again.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <climits>
+#include <initializer_list>
+#include <vector>
+#include <string>
+#include "core/entity/Entity.h"
+#include "ByteCodeUtil.h"
+
+// the operand is NULL, empty or not an integer
+#define BYTECODE_NULL_OPERAND INT_MIN
+
+typedef struct _ByteCodeInstruction {
+	int addr = BYTECODE_NULL_OPERAND;
+	ByteCodeOp op = BC_OTHER;
+	int p1 = BYTECODE_NULL_OPERAND;
+	int p2 = BYTECODE_NULL_OPERAND;
+	int p3 = BYTECODE_NULL_OPERAND;
+	int p4 = BYTECODE_NULL_OPERAND; // only if P4 is an integer
+	int p5 = BYTECODE_NULL_OPERAND;
+	const RowItem * row = nullptr; // the explain row, for the text of opcode, P4 and comment
+} ByteCodeInstruction;
+
+typedef std::vector<ByteCodeInstruction> ByteCodeInstructions;
+
+class ByteCodeProgram {
+public:
+	// The rows are referenced by the instructions, byteCodeList must outlive the program
+	explicit ByteCodeProgram(const DataList & byteCodeList);
+
+	int size() const { return static_cast<int>(instructions.size()); }
+	const ByteCodeInstruction & at(int index) const { return instructions.at(index); }
+
+	// Return the index of the instruction at the address, -1 if not found
+	int indexOfAddr(int addr) const;
+	// Return the opcode of the instruction at the address, BC_OTHER if not found
+	ByteCodeOp opcodeOfAddr(int addr) const;
+
+	// The indexes of instructions that write the register, in ascending order
+	const std::vector<int> & getDefs(int regNo) const;
+	// The indexes of instructions that read the register, in ascending order
+	const std::vector<int> & getUses(int regNo) const;
+	// The indexes of instructions before the index that write any of the registers, in descending order
+	std::vector<int> getDefsBefore(int index, std::initializer_list<int> regNos) const;
+private:
+	ByteCodeInstructions instructions;
+	std::vector<int> addrIndexes; // addr -> index, -1 if no instruction at the addr
+	std::vector<std::vector<int>> defs; // register no -> defs
+	std::vector<std::vector<int>> uses; // register no -> uses
+	static const std::vector<int> emptyIndexes;
+
+	void decode(const DataList & byteCodeList);
+	void buildDefUse();
+	void addRegisters(std::vector<std::vector<int>> & regIndexes, int regBegin, int regLen, int index);
+
+	static int toOperand(const std::wstring & val);
+};
@@ -19,23 +19,25 @@
  *********************************************************************/
 #include "stdafx.h"
 #include "ByteCodeUtil.h"
-#include "StringUtil.h"
+#include <unordered_map>
 
-const std::vector<std::wstring> ByteCodeUtil::seekOpCodes{L"SeekGT", L"SeekGE", L"SeekLT", L"SeekLE"};
-const std::vector<std::wstring> ByteCodeUtil::idxOpCodes{L"IdxGT", L"IdxGE", L"IdxLT", L"IdxLE"};
-const std::vector<std::wstring> ByteCodeUtil::compareOpCodes{L"Eq", L"Ne", L"Lt", L"Le", L"Gt", L"Ge"};
-
-bool ByteCodeUtil::isInSeekOpCodes(const std::wstring & opcode)
-{
-	return StringUtil::existsIn(opcode, seekOpCodes);
-}
-
-bool ByteCodeUtil::isInIdxOpCodes(const std::wstring & opcode)
-{
-	return StringUtil::existsIn(opcode, idxOpCodes);
-}
-
-bool ByteCodeUtil::isInCompareOpCodes(const std::wstring & opcode)
+ByteCodeOp ByteCodeUtil::toOpcode(const std::wstring & opcode)
 {
-	return StringUtil::existsIn(opcode, compareOpCodes);
+	static const std::unordered_map<std::wstring, ByteCodeOp> opcodes{
+		{ L"Init", BC_INIT }, { L"OpenRead", BC_OPEN_READ }, { L"OpenEphemeral", BC_OPEN_EPHEMERAL },
+		{ L"SorterOpen", BC_SORTER_OPEN }, { L"Rewind", BC_REWIND }, { L"Last", BC_LAST },
+		{ L"SeekEnd", BC_SEEK_END }, { L"Next", BC_NEXT }, { L"Prev", BC_PREV }, { L"Halt", BC_HALT },
+		{ L"Column", BC_COLUMN }, { L"Rowid", BC_ROWID }, { L"IdxRowid", BC_IDX_ROWID },
+		{ L"ResultRow", BC_RESULT_ROW }, { L"MakeRecord", BC_MAKE_RECORD }, { L"IdxInsert", BC_IDX_INSERT },
+		{ L"SorterInsert", BC_SORTER_INSERT }, { L"Sort", BC_SORT }, { L"SorterSort", BC_SORTER_SORT },
+		{ L"SeekRowid", BC_SEEK_ROWID }, { L"NotExists", BC_NOT_EXISTS },
+		{ L"If", BC_IF }, { L"IfNot", BC_IF_NOT }, { L"IfPos", BC_IF_POS },
+		{ L"Integer", BC_INTEGER }, { L"Real", BC_REAL }, { L"String", BC_STRING }, { L"String8", BC_STRING8 },
+		{ L"Blob", BC_BLOB }, { L"Null", BC_NULL },
+		{ L"SeekGT", BC_SEEK_GT }, { L"SeekGE", BC_SEEK_GE }, { L"SeekLT", BC_SEEK_LT }, { L"SeekLE", BC_SEEK_LE },
+		{ L"IdxGT", BC_IDX_GT }, { L"IdxGE", BC_IDX_GE }, { L"IdxLT", BC_IDX_LT }, { L"IdxLE", BC_IDX_LE },
+		{ L"Eq", BC_EQ }, { L"Ne", BC_NE }, { L"Lt", BC_LT }, { L"Le", BC_LE }, { L"Gt", BC_GT }, { L"Ge", BC_GE },
+	};
+	auto iter = opcodes.find(opcode);
+	return iter == opcodes.end() ? BC_OTHER : iter->second;
 }
@@ -21,13 +21,68 @@
 #include <vector>
 #include <string>
 
+// The opcodes of VDBE that are used by the analysis, the others are decoded to BC_OTHER
+typedef enum _ByteCodeOp {
+	BC_OTHER = 0,
+	BC_INIT,
+	BC_OPEN_READ,
+	BC_OPEN_EPHEMERAL,
+	BC_SORTER_OPEN,
+	BC_REWIND,
+	BC_LAST,
+	BC_SEEK_END,
+	BC_NEXT,
+	BC_PREV,
+	BC_HALT,
+	BC_COLUMN,
+	BC_ROWID,
+	BC_IDX_ROWID,
+	BC_RESULT_ROW,
+	BC_MAKE_RECORD,
+	BC_IDX_INSERT,
+	BC_SORTER_INSERT,
+	BC_SORT,
+	BC_SORTER_SORT,
+	BC_SEEK_ROWID,
+	BC_NOT_EXISTS,
+	BC_IF,
+	BC_IF_NOT,
+	BC_IF_POS,
+	BC_INTEGER,
+	BC_REAL,
+	BC_STRING,
+	BC_STRING8,
+	BC_BLOB,
+	BC_NULL,
+	// seek opcodes, keep the order for ByteCodeUtil::isSeekOp
+	BC_SEEK_GT,
+	BC_SEEK_GE,
+	BC_SEEK_LT,
+	BC_SEEK_LE,
+	// idx opcodes, keep the order for ByteCodeUtil::isIdxOp
+	BC_IDX_GT,
+	BC_IDX_GE,
+	BC_IDX_LT,
+	BC_IDX_LE,
+	// compare opcodes, keep the order for ByteCodeUtil::isCompareOp
+	BC_EQ,
+	BC_NE,
+	BC_LT,
+	BC_LE,
+	BC_GT,
+	BC_GE,
+} ByteCodeOp;
+
 class ByteCodeUtil {
 public:
-	static bool isInSeekOpCodes(const std::wstring & opcode);
-	static bool isInIdxOpCodes(const std::wstring & opcode);
-	static bool isInCompareOpCodes(const std::wstring & opcode);
-private:
-	static const std::vector<std::wstring> seekOpCodes;
-	static const std::vector<std::wstring> idxOpCodes;
-	static const std::vector<std::wstring> compareOpCodes;
+	static ByteCodeOp toOpcode(const std::wstring & opcode);
+
+	// seek opcodes: SeekGT/SeekGE/SeekLT/SeekLE
+	static bool isSeekOp(ByteCodeOp op) { return op >= BC_SEEK_GT && op <= BC_SEEK_LE; }
+	// idx opcodes: IdxGT/IdxGE/IdxLT/IdxLE
+	static bool isIdxOp(ByteCodeOp op) { return op >= BC_IDX_GT && op <= BC_IDX_LE; }
+	// compare opcodes: Eq/Ne/Lt/Le/Gt/Ge
+	static bool isCompareOp(ByteCodeOp op) { return op >= BC_EQ && op <= BC_GE; }
+	// the opcodes that load a constant value to register P2
+	static bool isConstantOp(ByteCodeOp op) { return op >= BC_INTEGER && op <= BC_BLOB; }
 };
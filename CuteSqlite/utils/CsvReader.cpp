@@ -0,0 +1,463 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   CsvReader.cpp
+ * @brief  Read the rows of the UTF-8 or UTF-16LE csv file or bytes by chunks, the chunk is decoded to UTF-16 once,
+ *         and the separators are found by SSE2 scanning, the fields are the slices of the chunk.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "CsvReader.h"
+#include <algorithm>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+#include "core/common/exception/QRuntimeException.h"
+#include "utils/Log.h"
+#include "utils/StringUtil.h"
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define CSV_READER_SSE2
+#endif
+
+CsvReader::CsvReader(const CsvOptions & options, size_t chunkSize)
+	: options(options), chunkSize(chunkSize)
+{
+	if (this->options.fieldTerminatedBy.empty()) {
+		this->options.fieldTerminatedBy = L",";
+	}
+}
+
+CsvReader::~CsvReader()
+{
+	close();
+}
+
+void CsvReader::open(const std::wstring & path)
+{
+	close();
+	errno_t _err;
+	wchar_t _err_buf[256] = { 0 };
+	_err = _wfopen_s(&file, path.c_str(), L"rb");
+	if (_err != 0 || file == NULL) {
+		file = nullptr;
+		_wcserror_s(_err_buf, 256, _err);
+		Q_ERROR(L"open csv file for reading has error:{}, path:{}", _err_buf, path);
+		throw QRuntimeException(std::to_wstring(_err), _err_buf);
+	}
+	filePath = path;
+	_fseeki64(file, 0, SEEK_END);
+	fileSize = static_cast<uint64_t>(_ftelli64(file));
+	_fseeki64(file, 0, SEEK_SET);
+
+	// skip the BOM of UTF-8 or UTF-16LE
+	char bom[3] = { 0 };
+	size_t n = fread(bom, 1, 3, file);
+	size_t bomSize = getBomSize(bom, n, options.isUtf16);
+	_fseeki64(file, static_cast<__int64>(bomSize), SEEK_SET);
+	reset(bomSize);
+}
+
+void CsvReader::open(const char * data, size_t len)
+{
+	close();
+	memData = data;
+	memLen = len;
+	memPos = 0;
+	fileSize = len;
+	reset(0);
+}
+
+void CsvReader::close()
+{
+	if (!file && !memData) {
+		return;
+	}
+	if (file) {
+		fclose(file);
+		file = nullptr;
+	}
+	memData = nullptr;
+	memLen = memPos = 0;
+	std::vector<char>().swap(bytes);
+	std::vector<wchar_t>().swap(buffer);
+}
+
+size_t CsvReader::getBomSize(const char * data, size_t len, bool isUtf16)
+{
+	const unsigned char * bom = reinterpret_cast<const unsigned char *>(data);
+	if (isUtf16 && len >= 2 && bom[0] == 0xFF && bom[1] == 0xFE) {
+		return 2;
+	} 
+	if (!isUtf16 && len >= 3 && bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF) {
+		return 3;
+	}
+	return 0;
+}
+
+void CsvReader::reset(uint64_t bomSize)
+{
+	isEof = false;
+	bytes.resize(chunkSize + 4);
+	bytesLen = 0;
+	decodedBytes = bomSize;
+	buffer.resize(chunkSize + 8);
+	dataBegin = dataEnd = 0;
+	consumedChars = decodedChars = 0;
+	readLines = rowLine = 0;
+}
+
+size_t CsvReader::readBytes(char * dest, size_t n)
+{
+	if (file) {
+		return fread(dest, 1, n, file);
+	}
+	size_t len = (std::min)(n, memLen - memPos);
+	if (len) {
+		std::memcpy(dest, memData + memPos, len);
+		memPos += len;
+	}
+	return len;
+}
+
+bool CsvReader::readRow(CsvFields & fields)
+{
+	if (!file && !memData) {
+		return false;
+	}
+	for (;;) {
+		size_t rowEnd = 0;
+		int ret = parseRow(fields, rowEnd);
+		if (ret == 0) {
+			// the row is not complete in the buffer, it is parsed again after reading the next chunk
+			fillBuffer();
+			continue;
+		}
+		if (ret < 0) {
+			return false;
+		}
+		uint64_t lineBegin = readLines + 1;
+		readLines += std::count(buffer.data() + dataBegin, buffer.data() + rowEnd, options.lineTerminatedBy);
+		consumedChars += rowEnd - dataBegin;
+		dataBegin = rowEnd;
+		if (!isBlankRow(fields)) {
+			rowLine = lineBegin;
+			return true;
+		}
+	}
+}
+
+bool CsvReader::readRow(RowItem & rowItem)
+{
+	if (!readRow(rowFields)) {
+		return false;
+	}
+	size_t n = rowFields.size();
+	rowItem.resize(n);
+	for (size_t i = 0; i < n; i++) {
+		toString(rowFields[i], rowItem[i]);
+	}
+	return true;
+}
+
+/**
+ * Convert the field to string, the blanks around the field and the enclosed chars are removed,
+ * the escaped enclosed chars are unescaped, such as "a\"b" or "a""b" is a"b.
+ */
+void CsvReader::toString(const CsvField & field, std::wstring & out) const
+{
+	const wchar_t * b = field.data;
+	const wchar_t * e = field.data + field.len;
+	while (b < e && std::iswspace(*b)) {
+		b++;
+	}
+	while (e > b && std::iswspace(*(e - 1))) {
+		e--;
+	}
+	const wchar_t quote = options.enclosedBy;
+	bool isEnclosed = field.isEnclosed && e - b >= 2 && *b == quote && *(e - 1) == quote;
+	if (isEnclosed) {
+		b++;
+		e--;
+	}
+	if (!field.isEscaped) {
+		out.assign(b, e);
+	} else {
+		out.clear();
+		out.reserve(e - b);
+		for (const wchar_t * p = b; p < e; p++) {
+			if (*p == options.escapedBy && p + 1 < e && *(p + 1) == quote) {
+				p++;
+			}
+			out.push_back(*p);
+		}
+	}
+	if (options.nullAsKeyword && !isEnclosed && (out == L"NULL" || out == L"null")) {
+		out = CSV_NULL_FIELD;
+	}
+}
+
+uint64_t CsvReader::getReadBytes() const
+{
+	if (options.isUtf16) {
+		return (decodedBytes - decodedChars * 2) + consumedChars * 2;
+	}
+	// the bytes of UTF-8 char are 1 ~ 4, estimate them by the average of decoded chunks
+	return decodedChars ? decodedBytes * consumedChars / decodedChars : 0;
+}
+
+/**
+ * Move the unread chars to the begin of buffer, then read and decode the next chunk of file after them.
+ * 
+ * @return false if the end of file
+ */
+bool CsvReader::fillBuffer()
+{
+	if (dataBegin > 0) {
+		size_t len = dataEnd - dataBegin;
+		if (len) {
+			std::memmove(buffer.data(), buffer.data() + dataBegin, len * sizeof(wchar_t));
+		}
+		dataBegin = 0;
+		dataEnd = len;
+	}
+	if (isEof) {
+		return false;
+	}
+
+	size_t n = readBytes(bytes.data() + bytesLen, chunkSize);
+	size_t total = bytesLen + n;
+	if (n < chunkSize) {
+		isEof = true;
+	}
+
+	// decode the complete chars only, the rest bytes are decoded with the next chunk
+	size_t complete = total;
+	if (options.isUtf16) {
+		complete = total & ~static_cast<size_t>(1);
+	} else if (!isEof) {
+		for (size_t k = 1; k <= 4 && k <= total; k++) {
+			unsigned char ch = static_cast<unsigned char>(bytes[total - k]);
+			if ((ch & 0xC0) == 0x80) {
+				continue; // continuation byte
+			}
+			size_t need = ch < 0x80 ? 1 : ch >= 0xF0 ? 4 : ch >= 0xE0 ? 3 : ch >= 0xC0 ? 2 : 1;
+			if (need > k) {
+				complete = total - k;
+			}
+			break;
+		}
+	}
+
+	// a row longer than the buffer makes the buffer grow
+	if (buffer.size() < dataEnd + complete + 8) {
+		buffer.resize((std::max)(buffer.size() * 2, dataEnd + complete + 8));
+	}
+	size_t chars = decode(bytes.data(), complete, buffer.data() + dataEnd);
+	dataEnd += chars;
+	decodedChars += chars;
+	decodedBytes += complete;
+
+	bytesLen = total - complete;
+	if (bytesLen) {
+		std::memmove(bytes.data(), bytes.data() + complete, bytesLen);
+	}
+	return chars > 0;
+}
+
+size_t CsvReader::decode(const char * src, size_t len, wchar_t * dest)
+{
+	if (!len) {
+		return 0;
+	}
+	if (options.isUtf16) {
+		std::memcpy(dest, src, len);
+		return len / 2;
+	}
+	// the UTF-16 chars are never more than the UTF-8 bytes
+	return StringUtil::utf8ToUtf16(src, len, dest);
+}
+
+/**
+ * Parse the row from dataBegin, the line terminator in the enclosed field is a part of the field.
+ * 
+ * @param fields - the fields of the row
+ * @param rowEnd - the position after the line terminator
+ * @return 1 - parsed a row, 0 - the row is not complete in the buffer, -1 - the end of file
+ */
+int CsvReader::parseRow(CsvFields & fields, size_t & rowEnd)
+{
+	fields.clear();
+	const wchar_t * begin = buffer.data() + dataBegin;
+	const wchar_t * end = buffer.data() + dataEnd;
+	if (begin == end) {
+		return isEof ? -1 : 0;
+	}
+
+	const std::wstring & delim = options.fieldTerminatedBy;
+	const size_t delimLen = delim.size();
+	const wchar_t delim0 = delim.at(0);
+	const wchar_t term = options.lineTerminatedBy;
+	const wchar_t quote = options.enclosedBy;
+	const wchar_t escape = quote ? options.escapedBy : 0;
+	// the chars found by findAny(), the unused one is replaced by the used one
+	const wchar_t outQuote = quote ? quote : delim0;
+	const wchar_t outEscape = (escape && escape != quote) ? escape : outQuote;
+	const wchar_t inEscape = escape ? escape : quote;
+
+	CsvField field;
+	field.data = begin;
+	bool isInQuote = false;
+	const wchar_t * p = begin;
+	for (;;) {
+		p = isInQuote ? findAny(p, end, quote, inEscape, quote, quote)
+			: findAny(p, end, delim0, term, outQuote, outEscape);
+		if (p == end) {
+			if (!isEof) {
+				return 0;
+			}
+			// the last row without line terminator
+			const wchar_t * fieldEnd = p;
+			if (term == L'\n' && fieldEnd > field.data && *(fieldEnd - 1) == L'\r') {
+				fieldEnd--;
+			}
+			field.len = fieldEnd - field.data;
+			fields.push_back(field);
+			rowEnd = dataEnd;
+			return 1;
+		}
+
+		wchar_t ch = *p;
+		if (isInQuote) {
+			if (ch == escape && escape != quote) {
+				// the char after escape char is not the end of enclosed field
+				if (p + 1 == end && !isEof) {
+					return 0;
+				}
+				field.isEscaped = true;
+				p = (std::min)(p + 2, end);
+				continue;
+			}
+			if (escape == quote) {
+				if (p + 1 == end && !isEof) {
+					return 0;
+				}
+				if (p + 1 < end && *(p + 1) == quote) {
+					field.isEscaped = true;
+					p += 2;
+					continue;
+				}
+			}
+			isInQuote = false;
+			p++;
+			continue;
+		}
+
+		if (ch == term) {
+			const wchar_t * fieldEnd = p;
+			if (term == L'\n' && fieldEnd > field.data && *(fieldEnd - 1) == L'\r') {
+				fieldEnd--;
+			}
+			field.len = fieldEnd - field.data;
+			fields.push_back(field);
+			rowEnd = p + 1 - buffer.data();
+			return 1;
+		}
+		if (quote && ch == quote) {
+			isInQuote = true;
+			field.isEnclosed = true;
+			p++;
+			continue;
+		}
+		if (escape && escape != quote && ch == escape) {
+			if (p + 1 == end && !isEof) {
+				return 0;
+			}
+			field.isEscaped = true;
+			p = (std::min)(p + 2, end);
+			continue;
+		}
+
+		// ch == delim0, the field terminator may be more than one char
+		if (delimLen > 1) {
+			if (static_cast<size_t>(end - p) < delimLen) {
+				if (!isEof) {
+					return 0;
+				}
+				p++;
+				continue;
+			}
+			if (std::wmemcmp(p, delim.data(), delimLen) != 0) {
+				p++;
+				continue;
+			}
+		}
+		field.len = p - field.data;
+		fields.push_back(field);
+		p += delimLen;
+		field = CsvField();
+		field.data = p;
+	}
+}
+
+bool CsvReader::isBlankRow(const CsvFields & fields)
+{
+	if (fields.size() != 1) {
+		return false;
+	}
+	const CsvField & field = fields.front();
+	for (size_t i = 0; i < field.len; i++) {
+		if (!std::iswspace(field.data[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Find the first char that is one of a, b, c, d, the 8 chars are compared once by SSE2.
+ * 
+ * @return the position of the found char, or end if not found
+ */
+const wchar_t * CsvReader::findAny(const wchar_t * p, const wchar_t * end, wchar_t a, wchar_t b, wchar_t c, wchar_t d)
+{
+#ifdef CSV_READER_SSE2
+	static_assert(sizeof(wchar_t) == 2, "the SSE2 scanning needs the UTF-16 wchar_t");
+	const __m128i va = _mm_set1_epi16(static_cast<short>(a));
+	const __m128i vb = _mm_set1_epi16(static_cast<short>(b));
+	const __m128i vc = _mm_set1_epi16(static_cast<short>(c));
+	const __m128i vd = _mm_set1_epi16(static_cast<short>(d));
+	while (end - p >= 8) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, va), _mm_cmpeq_epi16(v, vb)),
+			_mm_or_si128(_mm_cmpeq_epi16(v, vc), _mm_cmpeq_epi16(v, vd)));
+		int mask = _mm_movemask_epi8(m);
+		if (mask) {
+			unsigned long idx;
+			_BitScanForward(&idx, static_cast<unsigned long>(mask));
+			return p + (idx >> 1);
+		}
+		p += 8;
+	}
+#endif
+	for (; p < end; p++) {
+		wchar_t ch = *p;
+		if (ch == a || ch == b || ch == c || ch == d) {
+			return p;
+		}
+	}
+	return end;
+}
@@ -0,0 +1,118 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   CsvReader.h
+ * @brief  Read the rows of the UTF-8 or UTF-16LE csv file by chunks, the chunk is decoded to UTF-16 once,
+ *         and the separators are found by SSE2 scanning, the fields are the slices of the chunk.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "core/entity/Entity.h"
+
+// the bytes read from the csv file once
+#define CSV_READ_CHUNK_SIZE (4 * 1024 * 1024)
+// the field that is NULL if CsvOptions::nullAsKeyword is true, same as the other import/export
+#define CSV_NULL_FIELD L"< NULL >"
+
+typedef struct _CsvOptions {
+	std::wstring fieldTerminatedBy = L",";
+	wchar_t enclosedBy = L'"';     // 0 - the fields are not enclosed
+	wchar_t escapedBy = L'"';      // 0 - no escape, same as enclosedBy - the enclosed char is doubled, such as "a""b"
+	wchar_t lineTerminatedBy = L'\n'; // '\n' for LF and CRLF, '\r' for CR
+	bool nullAsKeyword = false;    // the field NULL or null is CSV_NULL_FIELD
+	bool isUtf16 = false;          // UTF-16LE, otherwise UTF-8
+} CsvOptions;
+
+// the slice of the chunk, valid until the next CsvReader::readRow()
+typedef struct _CsvField {
+	const wchar_t * data = nullptr;
+	size_t len = 0;
+	bool isEnclosed = false;  // has the enclosed char
+	bool isEscaped = false;   // has the escaped char, must be unescaped by CsvReader::toString()
+} CsvField;
+
+typedef std::vector<CsvField> CsvFields;
+
+class CsvReader
+{
+public:
+	CsvReader(const CsvOptions & options, size_t chunkSize = CSV_READ_CHUNK_SIZE);
+	~CsvReader();
+
+	// open the file, throw QRuntimeException if the file can't be opened
+	void open(const std::wstring & path);
+	// open the bytes in memory without BOM, such as a chunk of the file, the bytes must be valid until close()
+	void open(const char * data, size_t len);
+	void close();
+
+	// Read the fields of next row, the blank lines are skipped, return false at the end of file
+	bool readRow(CsvFields & fields);
+	// Read the next row and convert the fields to strings, return false at the end of file
+	bool readRow(RowItem & rowItem);
+	// Convert the field to string, the enclosed chars are removed and the escaped chars are unescaped
+	void toString(const CsvField & field, std::wstring & out) const;
+
+	uint64_t getFileSize() const { return fileSize; }
+	// the bytes of the rows have been read
+	uint64_t getReadBytes() const;
+	// the line number (from 1) where the last read row begins, the blank lines and the line breaks in the fields are counted
+	uint64_t getRowLine() const { return rowLine; }
+	// the line terminators of the rows have been read, include the skipped blank lines
+	uint64_t getReadLines() const { return readLines; }
+
+	// the bytes of UTF-8 or UTF-16LE BOM at the begin of bytes, 0 if no BOM
+	static size_t getBomSize(const char * data, size_t len, bool isUtf16);
+private:
+	CsvOptions options;
+	size_t chunkSize;
+
+	FILE * file = nullptr;
+	std::wstring filePath;
+	// the bytes in memory if opened by open(data, len)
+	const char * memData = nullptr;
+	size_t memLen = 0;
+	size_t memPos = 0;
+	uint64_t fileSize = 0;
+	bool isEof = false;
+
+	// the bytes read but not decoded yet, such as the incomplete UTF-8 sequence at the end of chunk
+	std::vector<char> bytes;
+	size_t bytesLen = 0;
+	uint64_t decodedBytes = 0;
+
+	// the decoded chars, the chars before dataBegin have been read
+	std::vector<wchar_t> buffer;
+	size_t dataBegin = 0;
+	size_t dataEnd = 0;
+	// the decoded bytes of every char is unknown for UTF-8, so the read bytes are estimated by the chars
+	uint64_t consumedChars = 0;
+	uint64_t decodedChars = 0;
+	uint64_t readLines = 0;
+	uint64_t rowLine = 0;
+
+	CsvFields rowFields;
+
+	void reset(uint64_t bomSize);
+	size_t readBytes(char * dest, size_t n);
+	bool fillBuffer();
+	size_t decode(const char * src, size_t len, wchar_t * dest);
+	int parseRow(CsvFields & fields, size_t & rowEnd);
+	static bool isBlankRow(const CsvFields & fields);
+	static const wchar_t * findAny(const wchar_t * p, const wchar_t * end, wchar_t a, wchar_t b, wchar_t c, wchar_t d);
+};
@@ -0,0 +1,248 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   SqlLexer.cpp
+ * @brief  Single pass tokenizer of SQLite statements.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "SqlLexer.h"
+#include <cwctype>
+#include "StringUtil.h"
+
+SqlTokens SqlLexer::tokenize(const std::wstring & sql)
+{
+	SqlTokens tokens;
+	size_t pos = 0;
+	int depth = 0;
+	SqlToken token;
+	while (nextToken(sql, pos, token)) {
+		if (token.type == SQL_TOKEN_OPERATOR && sql[token.pos] == L'(') {
+			token.depth = depth++;
+		} else if (token.type == SQL_TOKEN_OPERATOR && sql[token.pos] == L')') {
+			depth = depth > 0 ? depth - 1 : 0;
+			token.depth = depth;
+		} else {
+			token.depth = depth;
+		}
+		tokens.push_back(token);
+	}
+	return tokens;
+}
+
+/**
+ * Split the sql to statements, the trigger body is recognized by the same state machine as sqlite3_complete(),
+ * so the ";" between "CREATE TRIGGER ... BEGIN" and "END;" doesn't end the statement.
+ * 
+ * @param sql - the sql of multiple statements
+ * @param bTrim - trim the statement
+ * @return the statements without the ending ";", the statement that has only comments is skipped
+ */
+std::vector<std::wstring> SqlLexer::splitStatements(const std::wstring & sql, bool bTrim /*= true*/)
+{
+	// the tokens of the state machine
+	enum { TK_SEMI = 0, TK_OTHER, TK_EXPLAIN, TK_CREATE, TK_TEMP, TK_TRIGGER, TK_END };
+	// the states: 0 - INVALID, 1 - START, 2 - NORMAL, 3 - EXPLAIN, 4 - CREATE, 5 - TRIGGER, 6 - SEMI, 7 - END
+	static const unsigned char trans[8][7] = {
+		/*            SEMI OTHER EXPLAIN CREATE TEMP TRIGGER END */
+		/* INVALID */ { 1,   2,    3,      4,     2,   2,      2 },
+		/* START   */ { 1,   2,    3,      4,     2,   2,      2 },
+		/* NORMAL  */ { 1,   2,    2,      2,     2,   2,      2 },
+		/* EXPLAIN */ { 1,   3,    2,      4,     2,   2,      2 },
+		/* CREATE  */ { 1,   2,    2,      2,     4,   5,      2 },
+		/* TRIGGER */ { 6,   5,    5,      5,     5,   5,      5 },
+		/* SEMI    */ { 6,   5,    5,      5,     5,   5,      7 },
+		/* END     */ { 1,   5,    5,      5,     5,   5,      5 },
+	};
+
+	std::vector<std::wstring> result;
+	auto pushStatement = [&](size_t begin, size_t end) {
+		std::wstring statement = sql.substr(begin, end - begin);
+		if (bTrim) {
+			StringUtil::trim(statement);
+		}
+		if (!statement.empty()) {
+			result.push_back(statement);
+		}
+	};
+
+	size_t pos = 0, begin = 0;
+	int state = 0;
+	bool hasToken = false; // the statement has token except the comments
+	SqlToken token;
+	while (nextToken(sql, pos, token)) {
+		int tk = TK_OTHER;
+		if (token.type == SQL_TOKEN_OPERATOR && sql[token.pos] == L';') {
+			tk = TK_SEMI;
+		} else if (token.type == SQL_TOKEN_WORD) {
+			if (isWord(sql, token, L"EXPLAIN")) {
+				tk = TK_EXPLAIN;
+			} else if (isWord(sql, token, L"CREATE")) {
+				tk = TK_CREATE;
+			} else if (isWord(sql, token, L"TEMP") || isWord(sql, token, L"TEMPORARY")) {
+				tk = TK_TEMP;
+			} else if (isWord(sql, token, L"TRIGGER")) {
+				tk = TK_TRIGGER;
+			} else if (isWord(sql, token, L"END")) {
+				tk = TK_END;
+			}
+		}
+		state = trans[state][tk];
+		if (tk != TK_SEMI) {
+			hasToken = true;
+			continue;
+		}
+		if (state == 1) {
+			if (hasToken) {
+				pushStatement(begin, token.pos);
+			}
+			begin = token.pos + token.len;
+			hasToken = false;
+		}
+	}
+	if (hasToken) {
+		pushStatement(begin, sql.size());
+	}
+	return result;
+}
+
+bool SqlLexer::isWord(const std::wstring & sql, const SqlToken & token, const wchar_t * upWord)
+{
+	if (token.type != SQL_TOKEN_WORD) {
+		return false;
+	}
+	size_t i = 0;
+	for (; i < token.len; i++) {
+		wchar_t ch = sql[token.pos + i];
+		if (!upWord[i] || (ch >= L'a' && ch <= L'z' ? ch - (L'a' - L'A') : ch) != upWord[i]) {
+			return false;
+		}
+	}
+	return !upWord[i];
+}
+
+bool SqlLexer::isOperator(const std::wstring & sql, const SqlToken & token, wchar_t op)
+{
+	return token.type == SQL_TOKEN_OPERATOR && sql[token.pos] == op;
+}
+
+std::wstring SqlLexer::getIdentifier(const std::wstring & sql, const SqlToken & token)
+{
+	if (token.type != SQL_TOKEN_QUOTED_ID || token.len < 2) {
+		return sql.substr(token.pos, token.len);
+	}
+	wchar_t quote = sql[token.pos];
+	wchar_t endQuote = quote == L'[' ? L']' : quote;
+	std::wstring id;
+	size_t end = token.pos + token.len - (sql[token.pos + token.len - 1] == endQuote ? 1 : 0);
+	for (size_t i = token.pos + 1; i < end; i++) {
+		id.push_back(sql[i]);
+		// the doubled quote is the escaped quote
+		if (quote != L'[' && sql[i] == quote && i + 1 < end && sql[i + 1] == quote) {
+			i++;
+		}
+	}
+	return id;
+}
+
+std::wstring SqlLexer::getText(const std::wstring & sql, const SqlToken & beginToken, const SqlToken & endToken)
+{
+	return sql.substr(beginToken.pos, endToken.pos + endToken.len - beginToken.pos);
+}
+
+bool SqlLexer::nextToken(const std::wstring & sql, size_t & pos, SqlToken & token)
+{
+	size_t n = sql.size();
+	while (pos < n) {
+		wchar_t ch = sql[pos];
+		// spaces
+		if (ch == L' ' || ch == L'\t' || ch == L'\n' || ch == L'\r' || ch == L'\f' || ch == L'\v') {
+			pos++;
+			continue;
+		}
+		// -- comment
+		if (ch == L'-' && pos + 1 < n && sql[pos + 1] == L'-') {
+			pos = sql.find(L'\n', pos + 2);
+			pos = pos == std::wstring::npos ? n : pos + 1;
+			continue;
+		}
+		// /* comment */
+		if (ch == L'/' && pos + 1 < n && sql[pos + 1] == L'*') {
+			pos = sql.find(L"*/", pos + 2);
+			pos = pos == std::wstring::npos ? n : pos + 2;
+			continue;
+		}
+
+		size_t begin = pos;
+		token.pos = begin;
+		if (ch == L'\'' || ch == L'"' || ch == L'`' || ch == L'[' 
+			|| ((ch == L'x' || ch == L'X') && pos + 1 < n && sql[pos + 1] == L'\'')) {
+			// string, blob or quoted identifier, the unterminated one ends at the end of sql
+			if (ch == L'x' || ch == L'X') {
+				pos++;
+				ch = L'\'';
+			}
+			wchar_t endQuote = ch == L'[' ? L']' : ch;
+			pos++;
+			while (pos < n) {
+				if (sql[pos++] != endQuote) {
+					continue;
+				}
+				if (endQuote != L']' && pos < n && sql[pos] == endQuote) {
+					pos++; // the doubled quote
+					continue;
+				}
+				break;
+			}
+			token.type = ch == L'\'' ? SQL_TOKEN_STRING : SQL_TOKEN_QUOTED_ID;
+		} else if (iswdigit(ch) || (ch == L'.' && pos + 1 < n && iswdigit(sql[pos + 1]))) {
+			// 123, 1.5e-3, 0x1F
+			while (pos < n) {
+				wchar_t c = sql[pos];
+				if ((c == L'e' || c == L'E') && pos + 1 < n && (sql[pos + 1] == L'+' || sql[pos + 1] == L'-')) {
+					pos += 2;
+				} else if (c == L'.' || isIdChar(c)) {
+					pos++;
+				} else {
+					break;
+				}
+			}
+			token.type = SQL_TOKEN_NUMBER;
+		} else if (ch == L'?' || ch == L':' || ch == L'@' || ch == L'$' || ch == L'#') {
+			pos++;
+			while (pos < n && isIdChar(sql[pos])) {
+				pos++;
+			}
+			token.type = pos - begin > 1 || ch == L'?' ? SQL_TOKEN_PARAM : SQL_TOKEN_OPERATOR;
+		} else if (isIdChar(ch)) {
+			while (pos < n && isIdChar(sql[pos])) {
+				pos++;
+			}
+			token.type = SQL_TOKEN_WORD;
+		} else {
+			pos++;
+			token.type = SQL_TOKEN_OPERATOR;
+		}
+		token.len = pos - begin;
+		return true;
+	}
+	return false;
+}
+
+bool SqlLexer::isIdChar(wchar_t ch)
+{
+	return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') || (ch >= L'0' && ch <= L'9') 
+		|| ch == L'_' || ch == L'$' || ch >= 0x80;
+}
@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   SqlLexer.h
+ * @brief  Single pass tokenizer of SQLite statements, the tokens are used to classify, split 
+ *         and extract the clauses of the statements in linear time. 
+ *         The strings, quoted identifiers and comments follow the rules of SQLite tokenizer.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+
+typedef enum {
+	SQL_TOKEN_WORD = 0,  // keyword or identifier without quotes
+	SQL_TOKEN_QUOTED_ID, // "id", [id], `id`
+	SQL_TOKEN_STRING,    // 'string', x'blob'
+	SQL_TOKEN_NUMBER,
+	SQL_TOKEN_PARAM,     // ?, ?1, :name, @name, $name
+	SQL_TOKEN_OPERATOR,  // the punctuation such as ( ) , . ; = 
+} SqlTokenType;
+
+typedef struct _SqlToken {
+	SqlTokenType type = SQL_TOKEN_WORD;
+	size_t pos = 0;  // the position in the sql
+	size_t len = 0;
+	int depth = 0;   // the depth of parentheses, "(" and ")" have the same depth as the tokens around them
+} SqlToken;
+typedef std::vector<SqlToken> SqlTokens;
+
+class SqlLexer
+{
+public:
+	// tokenize the sql, the spaces and comments are skipped
+	static SqlTokens tokenize(const std::wstring & sql);
+
+	// split the sql to statements by ";", the ";" in the strings, comments and the body of CREATE TRIGGER are ignored
+	static std::vector<std::wstring> splitStatements(const std::wstring & sql, bool bTrim = true);
+
+	// the token is the keyword, upWord is upper case, such as L"SELECT"
+	static bool isWord(const std::wstring & sql, const SqlToken & token, const wchar_t * upWord);
+	static bool isOperator(const std::wstring & sql, const SqlToken & token, wchar_t op);
+	// the text of identifier without the quotes
+	static std::wstring getIdentifier(const std::wstring & sql, const SqlToken & token);
+	// the sql text from the begin token to the end token(included)
+	static std::wstring getText(const std::wstring & sql, const SqlToken & beginToken, const SqlToken & endToken);
+private:
+	// scan the next token from pos, return false if no more token
+	static bool nextToken(const std::wstring & sql, size_t & pos, SqlToken & token);
+	static bool isIdChar(wchar_t ch);
+};
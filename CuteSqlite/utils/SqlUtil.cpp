@@ -20,22 +20,9 @@
 #include "stdafx.h"
 #include "SqlUtil.h"
 #include <chrono>
+#include <unordered_set>
 #include "StringUtil.h"
-
-std::wregex SqlUtil::selectPat(L"^select\\s+(.*)\\s+from\\s+(.*)\\s*(where .*)?", std::wregex::icase);
-std::wregex SqlUtil::selectPat2(L"^with\\s(.*)?\\s?select\\s+(.*)\\s+from\\s+(.*)\\s*(where .*)?", std::wregex::icase);
-std::wregex SqlUtil::selectPat3(L"select\\s+(.*)\\s+from\\s+(.*)\\s*(order .*)+", std::wregex::icase);
-std::wregex SqlUtil::selectPat4(L"(select\\s+(.*))\\s+from(.*)", std::wregex::icase);
-std::wregex SqlUtil::explainPat(L"^explain(query|\\s|plan)+(.*)+", std::wregex::icase);
-
-std::wregex SqlUtil::whereClausePat1(L"((where)\\s+.*)\\s+(order|group|limit|having|window)+(.*)?", std::wregex::icase);
-std::wregex SqlUtil::whereClausePat2(L"(where .*\\)?)+", std::wregex::icase);
-
-//std::wregex SqlUtil::orderClausePat(L"(select.*((order\\s+by)\\s+.*)(limit|offset)+(.*)?)|(\\(select.*(order\\s+by.*)\\))|(select.*(order\\s+by\\s+.*)+)", std::wregex::icase);
-
-std::wregex SqlUtil::limitClausePat(L"(limit .*)+", std::wregex::icase);
-
-std::wregex SqlUtil::fourthClausePat(L"((order|group|limit|having|window)\\s+.*)+", std::wregex::icase);
+#include "SqlLexer.h"
 
 std::wregex SqlUtil::primaryKeyPat(L"\\s+primary\\s+key\\s?\\(?(\\\"?([^(\\s|\\\"|\\s)]+)\\\"?\\s?)", std::wregex::icase);
 
@@ -43,8 +30,6 @@ std::wregex SqlUtil::columnPat(L"(.*)\\s+\\[(.*)\\]+");
 
 std::wregex SqlUtil::tblNumSuffixPat(L"([0-9]+)$");
 
-
-
 std::vector<std::wstring> SqlUtil::tableTags({ L"as", L"left", L"right",L"inner", L"cross", L"full", L"outer", L"natural", L"join" });
 
 bool SqlUtil::isSelectSql(std::wstring & sql)
@@ -52,13 +37,8 @@ bool SqlUtil::isSelectSql(std::wstring & sql)
 	if (sql.empty()) {
 		return false;
 	}
-
-	if (std::regex_search(sql, SqlUtil::selectPat) 
-		|| std::regex_search(sql, SqlUtil::explainPat)
-		|| std::regex_search(sql, SqlUtil::selectPat2)) {
-		return true;
-	}
-	return false;
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	return getMainKeywordIndex(sql, tokens) >= 0;
 }
 
 bool SqlUtil::isPragmaStmt(std::wstring & sql, bool excludeEqual)
@@ -66,23 +46,33 @@ bool SqlUtil::isPragmaStmt(std::wstring & sql, bool excludeEqual)
 	if (sql.empty()) {
 		return false;
 	}
-	std::wstring upsql = StringUtil::toupper(sql);
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	if (tokens.empty() || !SqlLexer::isWord(sql, tokens.front(), L"PRAGMA")) {
+		return false;
+	}
 	if (excludeEqual) {
-		return upsql.find(L"PRAGMA") == 0 && upsql.find_last_of(L'=') == std::wstring::npos;
+		// such as PRAGMA cache_size = 1000
+		auto iter = std::find_if(tokens.begin(), tokens.end(), [&sql](const SqlToken & token) {
+			return token.depth == 0 && SqlLexer::isOperator(sql, token, L'=');
+		});
+		return iter == tokens.end();
 	}
-	return upsql.find(L"PRAGMA") == 0;
+	return true;
 }
 
+/**
+ * The LIMIT clause of the statement, the LIMIT of the subquery or in the string is not included.
+ */
 bool SqlUtil::hasLimitClause(std::wstring & sql)
 {
 	if (sql.empty()) {
 		return false;
 	}
-
-	if (std::regex_search(sql, SqlUtil::limitClausePat)) {
-		return true;
-	}
-	return false;
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	auto iter = std::find_if(tokens.begin(), tokens.end(), [&sql](const SqlToken & token) {
+		return token.depth == 0 && SqlLexer::isWord(sql, token, L"LIMIT");
+	});
+	return iter != tokens.end();
 }
 
 /**
@@ -117,31 +107,56 @@ std::vector<std::wstring> SqlUtil::getTablesFromSelectSql(const std::wstring & s
 	if (selectSql.empty()) {
 		return tbls;
 	}
-	
-	std::wsmatch results;
-	if (!std::regex_search(selectSql, results, SqlUtil::selectPat)) {
+	SqlTokens tokens = SqlLexer::tokenize(selectSql);
+	int mainIndex = getMainKeywordIndex(selectSql, tokens);
+	if (mainIndex < 0) {
 		return tbls;
 	}
-	// The second param from match results is the tables statement,
-	//   such as : table1 as tbl1, table2 as tbl2 or table1 t1 left join table2 t2 
-	std::wstring tblClause = results[2];
-	if (tblClause.empty()) {
-		return tbls;
+	// The first identifier after FROM/JOIN/',' of the main statement is the table name, the others are the alias,
+	//   such as : table1 as tbl1, table2 as tbl2 or table1 t1 left join main.table2 t2 
+	// the tables of the subqueries and the common table expressions are in the parentheses, they are not counted
+	std::unordered_set<std::wstring> names;
+	int mainDepth = tokens.at(mainIndex).depth;
+	bool isTableClause = false;
+	bool isTableName = false; // the next identifier is the table name
+	int n = static_cast<int>(tokens.size());
+	for (int i = mainIndex; i < n; i++) {
+		auto & token = tokens.at(i);
+		if (token.depth != mainDepth) {
+			// the subquery in the table clause, the identifier after it is the alias
+			isTableName = false;
+			continue;
+		}
+		if (SqlLexer::isWord(selectSql, token, L"FROM") || SqlLexer::isWord(selectSql, token, L"JOIN")) {
+			isTableClause = true;
+			isTableName = true;
+			continue;
+		}
+		if (!isTableClause) {
+			continue;
+		}
+		if (isEndOfTableClause(selectSql, token)) {
+			isTableClause = false;
+		} else if (SqlLexer::isOperator(selectSql, token, L',')) {
+			isTableName = true;
+		} else if (isTableName && (token.type == SQL_TOKEN_WORD || token.type == SQL_TOKEN_QUOTED_ID)) {
+			// the schema name before '.', such as main.table1, the table name is after it
+			if (i + 2 < n && SqlLexer::isOperator(selectSql, tokens.at(i + 1), L'.')) {
+				i++;
+				continue;
+			}
+			names.insert(StringUtil::tolower(SqlLexer::getIdentifier(selectSql, token)));
+			isTableName = false;
+		} else if (token.type == SQL_TOKEN_OPERATOR) {
+			isTableName = false;
+		}
 	}
 	
-	auto vec = parseTablesFromTableClause(tblClause);
-	for (auto tbl : allTables) {
-		auto iterator = std::find_if(vec.begin(), vec.end(), [&tbl](std::wstring & str) {
-			std::wstring lowtbl = StringUtil::tolower(tbl);
-			std::wstring lowstr = StringUtil::tolower(str);
-			return lowtbl == lowstr;
-		});
-
-		if (iterator != vec.end()) {
+	for (auto & tbl : allTables) {
+		if (names.count(StringUtil::tolower(tbl))) {
 			tbls.push_back(tbl);
 		}
 	}
-
 	return tbls;
 }
 
@@ -206,44 +221,36 @@ std::wstring SqlUtil::getWhereClause(const std::wstring & sql)
 	if (sql.empty()) {
 		return L"";
 	}
-	std::wsmatch results;
-	if (!std::regex_search(sql, results, SqlUtil::selectPat)) {
-		return L"";
-	}
-	if (results.size() < 3 || results[3].matched == false) {
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	int mainIndex = getMainKeywordIndex(sql, tokens);
+	if (mainIndex < 0 || !SqlLexer::isWord(sql, tokens[mainIndex], L"SELECT")) {
 		return L"";
 	}
-	std::wsmatch whereResults;
-	std::wstring whereStmt = results[3];
-	std::wstring whereClause;
-
-	while (!whereStmt.empty() && std::regex_search(whereStmt, whereResults, SqlUtil::whereClausePat1)) {
-		if (whereResults[1].matched == false) {
-			return L"";
+	// the first WHERE clause of the statement, ends before the fourth clause or the compound operator
+	int n = static_cast<int>(tokens.size());
+	int whereIndex = -1, endIndex = -1;
+	for (int i = mainIndex + 1; i < n; i++) {
+		auto & token = tokens[i];
+		if (token.depth != 0) {
+			continue;
 		}
-		whereClause = whereResults[1];
-		if (std::regex_search(whereClause, SqlUtil::fourthClausePat)) {
-			whereStmt = whereClause;
+		if (whereIndex < 0) {
+			if (SqlLexer::isWord(sql, token, L"WHERE")) {
+				whereIndex = i;
+			}
 			continue;
 		}
-		break;
-	}
-
-	if (whereClause.empty() && std::regex_search(whereStmt, whereResults, SqlUtil::whereClausePat2)) {
-		if (whereResults[1].matched == false) {
-			return L"";
+		if (isFourthClauseKeyword(sql, token) || isCompoundKeyword(sql, token) || SqlLexer::isOperator(sql, token, L';')) {
+			break;
 		}
-		whereClause = whereResults[1];
+		endIndex = i;
 	}
-
-	if (whereClause.empty() || StringUtil::toupper(whereClause.substr(0, 5)) != L"WHERE") {
+	if (whereIndex < 0 || endIndex < 0) {
 		return L"";
 	}
-	return whereClause;
+	return SqlLexer::getText(sql, tokens[whereIndex], tokens[endIndex]);
 }
 
-std::wregex SqlUtil::orderClausePat(L"(((order\\s+by)\\s+.+)(limit|offset)+(.*)?)|(\\(.*(order\\s+by.*)\\))|(order\\s+by\\s+.*)", std::wregex::icase);
-
 /**
  * Fetch the ORDER clause such as "select * from [tbl clause] [where clause] [order clause] [fourth clause : limit...]"...
  * 
@@ -256,46 +263,29 @@ std::vector<std::wstring> SqlUtil::getOrderClauses(const std::wstring & sql)
 	if (sql.empty()) {
 		return result;
 	}
-	std::wstring upsql = StringUtil::toupper(sql);
-	if (upsql.find(L"ORDER") == std::wstring::npos) {
-		return result;
-	}
-
-	
-	std::wsmatch orderResults;
-	std::wstring orderClause;
-	std::wstring orderInSql;
-
-	auto iter_begin = std::wsregex_iterator(sql.begin(), sql.end(), SqlUtil::orderClausePat);
-    auto iter_end= std::wsregex_iterator();
-
-	for (std::wsregex_iterator iter = iter_begin; iter != iter_end; ++iter) {
-		orderResults = *iter;
-		bool foundFirst = orderResults[2].matched;
-		bool foundSecond = orderResults[7].matched;
-		bool foundThird = orderResults[8].matched;
-		if (foundFirst == false && foundSecond == false && foundThird == false) {
-			break;
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	int n = static_cast<int>(tokens.size());
+	for (int i = 0; i + 1 < n; i++) {
+		if (!SqlLexer::isWord(sql, tokens[i], L"ORDER") || !SqlLexer::isWord(sql, tokens[i + 1], L"BY")) {
+			continue;
 		}
-		orderClause.clear();
-		// Fetch valid order by clause
-		if (foundFirst) {
-			orderClause = orderResults[2];
-		} else if (foundSecond) {
-			orderClause = orderResults[7];			
-		} else if (foundThird) {
-			orderClause = orderResults[8];
+		// the ORDER clause ends before LIMIT/OFFSET, or the end of the subquery
+		int depth = tokens[i].depth;
+		int endIndex = i + 1;
+		for (int j = i + 2; j < n; j++) {
+			auto & token = tokens[j];
+			if (token.depth < depth || (token.depth == depth && (SqlLexer::isOperator(sql, token, L')') 
+				|| SqlLexer::isOperator(sql, token, L';') || SqlLexer::isWord(sql, token, L"LIMIT") 
+				|| SqlLexer::isWord(sql, token, L"OFFSET")))) {
+				break;
+			}
+			endIndex = j;
 		}
-		if (orderClause.empty() || orderClause == sql 
-			|| StringUtil::toupper(orderClause.substr(0, 5)) != L"ORDER") {
+		if (endIndex == i + 1) {
 			continue;
 		}
-		
-		auto & iter2 = std::find_if(result.begin(), result.end(), [&orderClause](auto & express) {
-			return orderClause == express;
-		});
-
-		if (iter2 == result.end()) {
+		std::wstring orderClause = SqlLexer::getText(sql, tokens[i], tokens[endIndex]);
+		if (std::find(result.begin(), result.end(), orderClause) == result.end()) {
 			result.push_back(orderClause);
 		}
 	}
@@ -398,23 +388,85 @@ std::vector<std::wstring> SqlUtil::getOrderExpresses(const std::wstring & sql)
  */
 std::wstring SqlUtil::getFourthClause(const std::wstring & sql)
 {
-	std::wsmatch results;
-	if (!std::regex_search(sql, results, SqlUtil::fourthClausePat)) {
-		return L"";
+	SqlTokens tokens = SqlLexer::tokenize(sql);
+	int n = static_cast<int>(tokens.size());
+	int beginIndex = -1, endIndex = -1;
+	for (int i = 0; i < n; i++) {
+		auto & token = tokens[i];
+		if (token.depth != 0) {
+			continue;
+		}
+		if (SqlLexer::isOperator(sql, token, L';')) {
+			break;
+		}
+		if (beginIndex < 0 && isFourthClauseKeyword(sql, token)) {
+			beginIndex = i;
+		}
+		endIndex = i;
 	}
-	if (results.size() == 0 || results[1].matched == false) {
+	if (beginIndex < 0) {
 		return L"";
 	}
+	return SqlLexer::getText(sql, tokens[beginIndex], tokens[endIndex]);
+}
 
-	std::wstring fouthClause = results[1];
-	if (fouthClause.empty()  || (StringUtil::toupper(fouthClause.substr(0, 5)) != L"ORDER"
-		&& StringUtil::toupper(fouthClause.substr(0, 5)) != L"GROUP"
-		&& StringUtil::toupper(fouthClause.substr(0, 5)) != L"LIMIT"
-		&& StringUtil::toupper(fouthClause.substr(0, 6)) != L"HAVING"
-		&& StringUtil::toupper(fouthClause.substr(0, 6)) != L"WINDOW")) {
-		return L"";
+/**
+ * The index of the keyword of the main statement if it's a query: SELECT/VALUES, 
+ * the SELECT/VALUES after the common table expressions of WITH clause, or EXPLAIN.
+ * 
+ * @param sql - the sql
+ * @param tokens - the tokens of sql
+ * @return the index of the keyword in the tokens, -1 if it's not a query
+ */
+int SqlUtil::getMainKeywordIndex(const std::wstring & sql, const SqlTokens & tokens)
+{
+	if (tokens.empty()) {
+		return -1;
+	}
+	auto & first = tokens.front();
+	if (SqlLexer::isWord(sql, first, L"SELECT") || SqlLexer::isWord(sql, first, L"VALUES") 
+		|| SqlLexer::isWord(sql, first, L"EXPLAIN")) {
+		return 0;
+	}
+	if (!SqlLexer::isWord(sql, first, L"WITH")) {
+		return -1;
+	}
+	// the common table expressions are in the parentheses, the first keyword of depth 0 is the main statement
+	int n = static_cast<int>(tokens.size());
+	for (int i = 1; i < n; i++) {
+		auto & token = tokens[i];
+		if (token.depth != 0) {
+			continue;
+		}
+		if (SqlLexer::isWord(sql, token, L"SELECT") || SqlLexer::isWord(sql, token, L"VALUES")) {
+			return i;
+		}
+		if (SqlLexer::isWord(sql, token, L"INSERT") || SqlLexer::isWord(sql, token, L"REPLACE")
+			|| SqlLexer::isWord(sql, token, L"UPDATE") || SqlLexer::isWord(sql, token, L"DELETE")) {
+			return -1;
+		}
 	}
-	return fouthClause;
+	return -1;
+}
+
+bool SqlUtil::isFourthClauseKeyword(const std::wstring & sql, const SqlToken & token)
+{
+	return SqlLexer::isWord(sql, token, L"ORDER") || SqlLexer::isWord(sql, token, L"GROUP")
+		|| SqlLexer::isWord(sql, token, L"LIMIT") || SqlLexer::isWord(sql, token, L"HAVING")
+		|| SqlLexer::isWord(sql, token, L"WINDOW");
+}
+
+bool SqlUtil::isCompoundKeyword(const std::wstring & sql, const SqlToken & token)
+{
+	return SqlLexer::isWord(sql, token, L"UNION") || SqlLexer::isWord(sql, token, L"EXCEPT")
+		|| SqlLexer::isWord(sql, token, L"INTERSECT");
+}
+
+bool SqlUtil::isEndOfTableClause(const std::wstring & sql, const SqlToken & token)
+{
+	return SqlLexer::isOperator(sql, token, L';') || SqlLexer::isWord(sql, token, L"WHERE") 
+		|| SqlLexer::isWord(sql, token, L"ON") || SqlLexer::isWord(sql, token, L"USING")
+		|| isFourthClauseKeyword(sql, token) || isCompoundKeyword(sql, token);
 }
 
 /**
@@ -581,6 +633,37 @@ std::wstring SqlUtil::makeInsertValuesClause(RowItem & rowItem)
 	return valuesClause;
 }
 
+/**
+ * Make the select sql that sorts the result of selectSql by one result column, such as:
+ * SELECT * FROM (SELECT ROWID AS _ct_sqlite_rowid,* FROM "tbl" WHERE id > 1) ORDER BY 3 DESC
+ * SQLite flattens the subquery of single table, so the index of the column is still used for ORDER BY.
+ * 
+ * @param selectSql - The select statement
+ * @param columnNo - The result column number of selectSql, begin with 1
+ * @param isDesc - true is DESC, false is ASC
+ * @return 
+ */
+std::wstring SqlUtil::makeOrderBySelectSql(const std::wstring & selectSql, int columnNo, bool isDesc)
+{
+	if (selectSql.empty() || columnNo <= 0) {
+		return L"";
+	}
+	std::wstring sql = selectSql;
+	StringUtil::trim(sql);
+	while (!sql.empty() && sql.back() == L';') {
+		sql.pop_back();
+		StringUtil::trim(sql);
+	}
+
+	// the line break avoids the ")" is commented by the "--" comment in the end of selectSql
+	std::wstring result(L"SELECT * FROM (");
+	result.append(sql).append(L"\n) ORDER BY ").append(std::to_wstring(columnNo));
+	if (isDesc) {
+		result.append(L" DESC");
+	}
+	return result;
+}
+
 std::wstring SqlUtil::makeTmpTableName(const std::wstring & tblName, int number,  const std::wstring & prefix /*= std::wstring(L"ctsqlite_tmp_")*/)
 {
 	std::wstring result = prefix;
@@ -588,6 +671,52 @@ std::wstring SqlUtil::makeTmpTableName(const std::wstring & tblName, int number,
 	return result;
 }
 
+/**
+ * The type affinity of the declared type of column, see the rules of "Determination Of Column Affinity" of SQLite,
+ * the rules are checked in order, such as "CHARINT" is INTEGER.
+ * 
+ * @param declType - the declared type of column, such as "VARCHAR(20)"
+ * @return the affinity, BLOB if the declared type is empty
+ */
+ColumnAffinity SqlUtil::getColumnAffinity(const std::wstring & declType)
+{
+	std::wstring type = StringUtil::toupper(declType);
+	if (type.find(L"INT") != std::wstring::npos) {
+		return COLUMN_AFFINITY_INTEGER;
+	}
+	if (type.find(L"CHAR") != std::wstring::npos || type.find(L"CLOB") != std::wstring::npos
+		|| type.find(L"TEXT") != std::wstring::npos) {
+		return COLUMN_AFFINITY_TEXT;
+	}
+	if (type.empty() || type.find(L"BLOB") != std::wstring::npos) {
+		return COLUMN_AFFINITY_BLOB;
+	}
+	if (type.find(L"REAL") != std::wstring::npos || type.find(L"FLOA") != std::wstring::npos
+		|| type.find(L"DOUB") != std::wstring::npos) {
+		return COLUMN_AFFINITY_REAL;
+	}
+	return COLUMN_AFFINITY_NUMERIC;
+}
+
+/**
+ * Get the name of rowid can be used for the table, the column with the same name shadows the rowid.
+ * 
+ * @param columnNames - all the column names of table, include the hidden columns
+ * @return rowid, _rowid_ or oid, empty if all of them are the column names
+ */
+std::wstring SqlUtil::getRowIdAlias(const Columns & columnNames)
+{
+	for (auto rowIdName : { L"rowid", L"_rowid_", L"oid" }) {
+		auto iter = std::find_if(columnNames.begin(), columnNames.end(), [&rowIdName](const std::wstring & columnName) {
+			return StringUtil::tolower(columnName) == rowIdName;
+		});
+		if (iter == columnNames.end()) {
+			return rowIdName;
+		}
+	}
+	return std::wstring();
+}
+
 /**
  * Parse all columns from create table DDL.
  * 
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include "core/entity/Entity.h"
+#include "SqlLexer.h"
 
 // special charactor for SQL
 // special characters for sql statement
@@ -40,29 +41,6 @@
 
 class SqlUtil {
 public:
-	// select sql regex pattern
-	static std::wregex selectPat;
-	static std::wregex selectPat2;
-	static std::wregex selectPat3;
-	static std::wregex selectPat4;
-	static std::wregex explainPat;
-
-	// where clause regex pattern
-	static std::wregex whereClausePat1;
-	static std::wregex whereClausePat2;
-
-	// order clause regex pattern
-	static std::wregex orderClausePat;
-
-	// limit clause regex patter
-	static std::wregex limitClausePat;
-
-	// fourth clause regex pattern 
-	static std::wregex fourthClausePat;
-
-	// table statement of select sql regex pattern
-	static std::wregex selectTablesPat;
-
 	//primary key pattern of create table statement
 	static std::wregex primaryKeyPat;
 
@@ -97,9 +75,16 @@ public:
 	static std::wstring makeWhereClauseByRowId(Columns & columns, RowItem &rowItem);
 	static std::wstring makeInsertColumsClause(Columns & columns);
 	static std::wstring makeInsertValuesClause(RowItem & rowItem);
+	static std::wstring makeOrderBySelectSql(const std::wstring & selectSql, int columnNo, bool isDesc);
 
 	// make table name
 	static std::wstring makeTmpTableName(const std::wstring & tblName, int number = 1, const std::wstring & prefix = std::wstring(L"ctsqlite_tmp_"));
+
+	// the type affinity of the declared type of column
+	static ColumnAffinity getColumnAffinity(const std::wstring & declType);
+
+	// the name of rowid (rowid, _rowid_ or oid) isn't shadowed by the columns of table, empty if all of them are shadowed
+	static std::wstring getRowIdAlias(const Columns & columnNames);
 	
 	// parse columns by create table DDL
 	static ColumnInfoList parseColumnsByTableDDL(const std::wstring & createTblSql);
@@ -125,6 +110,12 @@ public:
 		const std::vector<std::wstring>& upSqlWords, 
 		const std::vector<std::pair<std::wstring, std::wstring>> & allAliases);
 private:
+	// the statement is parsed by the tokens of SqlLexer
+	static int getMainKeywordIndex(const std::wstring & sql, const SqlTokens & tokens);
+	static bool isFourthClauseKeyword(const std::wstring & sql, const SqlToken & token);
+	static bool isCompoundKeyword(const std::wstring & sql, const SqlToken & token);
+	static bool isEndOfTableClause(const std::wstring & sql, const SqlToken & token);
+
 	static IndexInfo parseConstraintFromLine(const std::wstring& line);
 	static IndexInfo parseLineToPrimaryKey(const std::wstring& line, bool isConstaintLine = true);
 	static IndexInfo parseLineToUnique(const std::wstring& line, bool isConstaintLine = true);
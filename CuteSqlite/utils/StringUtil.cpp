@@ -19,6 +19,13 @@
  *********************************************************************/
 #include "stdafx.h"
 #include "StringUtil.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define STRING_UTIL_SSE2
+#endif
 
 /**
 * convert Unicodes to UTF8..
@@ -28,86 +35,221 @@
 */
 char * StringUtil::unicodeToUtf8(const std::wstring& widestring)
 {
-	if (widestring.empty()) {
-		return "";
-	}
-
-	int utf8size = ::WideCharToMultiByte(CP_UTF8, 0, widestring.c_str(), -1, NULL, 0, NULL, NULL);
-	if (utf8size == 0)
-	{
-		throw std::exception("Error in conversion.");
-	}
-	char * buff = new char[utf8size + 1]{ 0 };
-	int convresult = ::WideCharToMultiByte(CP_UTF8, 0, widestring.c_str(), -1, buff, utf8size, NULL, NULL);
-	if (convresult != utf8size)
-	{
+	// the callers release the buffer by free()
+	char * buff = static_cast<char *>(malloc(widestring.size() * 3 + 1));
+	if (!buff) {
 		throw std::exception("Error in conversion.");
 	}
-	buff[utf8size] = '\0';
-		
+	size_t n = utf16ToUtf8(widestring.c_str(), widestring.size(), buff);
+	buff[n] = '\0';
 	return buff;
 }
 
 wchar_t * StringUtil::utf8ToUnicode(const char * utf8str)
 {
-	int len = static_cast<int>(strlen(utf8str));
-	if (!len) {
-		return nullptr;
-	}
-	//ԤתõռĴС;
-	int wcsLen = ::MultiByteToWideChar(CP_UTF8, NULL, utf8str, len, NULL, 0);
-
-	//ռҪ'\0'ռ䣬MultiByteToWideChar'\0'ռ
-	wchar_t * buff = new wchar_t[wcsLen + 1]{ 0 };
-
-	//ת
-	int convresult =::MultiByteToWideChar(CP_UTF8, NULL, utf8str, len, buff, wcsLen);
-	if (convresult != wcsLen) {
+	size_t len = utf8str ? strlen(utf8str) : 0;
+	// the callers release the buffer by free()
+	wchar_t * buff = static_cast<wchar_t *>(malloc((len + 1) * sizeof(wchar_t)));
+	if (!buff) {
 		throw std::exception("Error in conversion.");
 	}
-	//'\0'
-	buff[wcsLen] = '\0';
+	size_t n = utf8ToUtf16(utf8str, len, buff);
+	buff[n] = L'\0';
 	return buff;
 }
 
 //Utf8 ת unicode 
 std::wstring StringUtil::utf82Unicode(const std::string& utf8string)
 {
-	if (utf8string.empty()) {
-		return std::wstring(L"");
-	}
-	int widesize = ::MultiByteToWideChar(CP_UTF8, 0, utf8string.c_str(), -1, NULL, 0);
-	if (widesize == ERROR_NO_UNICODE_TRANSLATION) {
-		throw std::exception("Invalid UTF-8 sequence.");
-	}
-	if (widesize == 0) {
-		throw std::exception("Error in conversion.");
-	}
-	std::vector<wchar_t> resultstring(widesize);
-	int convresult = ::MultiByteToWideChar(CP_UTF8, 0, utf8string.c_str(), -1, &resultstring[0], widesize);
-	if (convresult != widesize) {
-		throw std::exception("Error in conversion.");
+	std::wstring result;
+	utf82Unicode(utf8string.data(), utf8string.size(), result);
+	return result;
+}
+
+/**
+ * One UTF-8 byte never produces more than one UTF-16 char, so the buffer of len chars is enough, 
+ * and the text is converted by one pass instead of the pass for sizing and the pass for converting.
+ */
+std::wstring & StringUtil::utf82Unicode(const char * utf8str, size_t len, std::wstring & out)
+{
+	if (!utf8str || !len) {
+		out.clear();
+		return out;
 	}
-	return std::wstring(&resultstring[0]);
+	out.resize(len);
+	out.resize(utf8ToUtf16(utf8str, len, &out[0]));
+	return out;
 }
 
 //Unicode ת Utf8 
 std::string StringUtil::unicode2Utf8(const std::wstring& widestring)
 { 
-	if (widestring.empty()) {
-		return std::string("");
+	std::string result;
+	unicode2Utf8(widestring.data(), widestring.size(), result);
+	return result;
+}
+
+std::string & StringUtil::unicode2Utf8(const wchar_t * widestr, size_t len, std::string & out)
+{
+	if (!widestr || !len) {
+		out.clear();
+		return out;
 	}
-	int utf8size = ::WideCharToMultiByte(CP_UTF8, 0, widestring.c_str(), -1, NULL, 0, NULL, NULL); 
-	if (utf8size == 0)  { 
-		throw std::exception("Error in conversion."); 
-	} 
-	std::vector<char> resultstring(utf8size); 
-	int convresult = ::WideCharToMultiByte(CP_UTF8, 0, widestring.c_str(), -1, &resultstring[0], utf8size, NULL, NULL); 
-	if (convresult != utf8size)  { 
-		throw std::exception("Error in conversion."); 
-	} 
-		
-	return std::string(&resultstring[0]);
+	out.resize(len * 3);
+	out.resize(utf16ToUtf8(widestr, len, &out[0]));
+	return out;
+}
+
+/**
+ * The ASCII bytes are checked and widened by 16 bytes once with SSE2, the others are decoded one by one.
+ * The invalid sequence is replaced by U+FFFD for its maximal subpart, as MultiByteToWideChar does.
+ */
+size_t StringUtil::utf8ToUtf16(const char * utf8str, size_t len, wchar_t * dest) noexcept
+{
+	const unsigned char * p = reinterpret_cast<const unsigned char *>(utf8str);
+	const unsigned char * end = p + len;
+	wchar_t * out = dest;
+	while (p < end) {
+		unsigned int c = *p;
+		if (c < 0x80) {
+#ifdef STRING_UTIL_SSE2
+			// out - dest <= p - utf8str, so the 16 chars always fit dest
+			if (end - p >= 16) {
+				const __m128i zero = _mm_setzero_si128();
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(v, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8), _mm_unpackhi_epi8(v, zero));
+				int mask = _mm_movemask_epi8(v);
+				if (!mask) {
+					p += 16;
+					out += 16;
+					continue;
+				}
+				// keep the ASCII prefix only
+				unsigned long idx;
+				_BitScanForward(&idx, static_cast<unsigned long>(mask));
+				p += idx;
+				out += idx;
+				continue;
+			}
+#endif
+			*out++ = static_cast<wchar_t>(c);
+			p++;
+			continue;
+		}
+
+		size_t avail = static_cast<size_t>(end - p);
+		if (c >= 0xC2 && c <= 0xDF) {
+			if (avail >= 2 && (p[1] & 0xC0) == 0x80) {
+				*out++ = static_cast<wchar_t>(((c & 0x1F) << 6) | (p[1] & 0x3F));
+				p += 2;
+				continue;
+			}
+		} else if (c >= 0xE0 && c <= 0xEF) {
+			// no overlong form and no surrogate
+			unsigned int lo = c == 0xE0 ? 0xA0 : 0x80;
+			unsigned int hi = c == 0xED ? 0x9F : 0xBF;
+			if (avail >= 2 && p[1] >= lo && p[1] <= hi) {
+				if (avail >= 3 && (p[2] & 0xC0) == 0x80) {
+					*out++ = static_cast<wchar_t>(((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F));
+					p += 3;
+				} else {
+					*out++ = 0xFFFD;
+					p += 2;
+				}
+				continue;
+			}
+		} else if (c >= 0xF0 && c <= 0xF4) {
+			// no overlong form and not above U+10FFFF
+			unsigned int lo = c == 0xF0 ? 0x90 : 0x80;
+			unsigned int hi = c == 0xF4 ? 0x8F : 0xBF;
+			if (avail >= 2 && p[1] >= lo && p[1] <= hi) {
+				if (avail >= 3 && (p[2] & 0xC0) == 0x80) {
+					if (avail >= 4 && (p[3] & 0xC0) == 0x80) {
+						unsigned int cp = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+						cp -= 0x10000;
+						*out++ = static_cast<wchar_t>(0xD800 + (cp >> 10));
+						*out++ = static_cast<wchar_t>(0xDC00 + (cp & 0x3FF));
+						p += 4;
+					} else {
+						*out++ = 0xFFFD;
+						p += 3;
+					}
+				} else {
+					*out++ = 0xFFFD;
+					p += 2;
+				}
+				continue;
+			}
+		}
+		*out++ = 0xFFFD;
+		p++;
+	}
+	return static_cast<size_t>(out - dest);
+}
+
+/**
+ * The ASCII chars are checked and narrowed by 8 chars once with SSE2, the others are encoded one by one.
+ */
+size_t StringUtil::utf16ToUtf8(const wchar_t * widestr, size_t len, char * dest) noexcept
+{
+	const wchar_t * p = widestr;
+	const wchar_t * end = p + len;
+	char * out = dest;
+	while (p < end) {
+		unsigned int c = static_cast<unsigned int>(*p);
+		if (c < 0x80) {
+#ifdef STRING_UTIL_SSE2
+			// out - dest <= (p - widestr) * 3, so the 8 bytes always fit dest
+			if (end - p >= 8) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(v, v));
+				// the ASCII chars have no bit in 0xFF80
+				__m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128());
+				int mask = _mm_movemask_epi8(ascii);
+				if (mask == 0xFFFF) {
+					p += 8;
+					out += 8;
+					continue;
+				}
+				// keep the ASCII prefix only
+				unsigned long idx;
+				_BitScanForward(&idx, static_cast<unsigned long>(~mask & 0xFFFF));
+				p += idx >> 1;
+				out += idx >> 1;
+				continue;
+			}
+#endif
+			*out++ = static_cast<char>(c);
+			p++;
+			continue;
+		}
+
+		if (c < 0x800) {
+			*out++ = static_cast<char>(0xC0 | (c >> 6));
+			*out++ = static_cast<char>(0x80 | (c & 0x3F));
+			p++;
+			continue;
+		}
+		if (c >= 0xD800 && c <= 0xDFFF) {
+			if (c <= 0xDBFF && end - p >= 2 && p[1] >= 0xDC00 && p[1] <= 0xDFFF) {
+				unsigned int cp = 0x10000 + ((c - 0xD800) << 10) + (static_cast<unsigned int>(p[1]) - 0xDC00);
+				*out++ = static_cast<char>(0xF0 | (cp >> 18));
+				*out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+				*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+				*out++ = static_cast<char>(0x80 | (cp & 0x3F));
+				p += 2;
+				continue;
+			}
+			// the unpaired surrogate
+			c = 0xFFFD;
+		}
+		*out++ = static_cast<char>(0xE0 | (c >> 12));
+		*out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+		*out++ = static_cast<char>(0x80 | (c & 0x3F));
+		p++;
+	}
+	return static_cast<size_t>(out - dest);
 }
 
 // ascii ת Utf8
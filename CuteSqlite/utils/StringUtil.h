@@ -25,7 +25,7 @@ public:
 	 * convert Unicodes to UTF8..
 	 * 
 	 * @param widestring unicode string 
-	 * @return 
+	 * @return the UTF-8 text terminated by '\0', release it by free()
 	 */
 	static char * unicodeToUtf8(const std::wstring& widestring);
 
@@ -34,14 +34,52 @@ public:
 	 * UTF8s to unicode..
 	 * 
 	 * @param utf8str
-	 * @return 
+	 * @return the UTF-16 text terminated by '\0', release it by free()
 	 */
 	static wchar_t * utf8ToUnicode(const char * utf8str);
 	//Utf8 ת unicode 
 	static std::wstring utf82Unicode(const std::string& utf8string);
+	/**
+	 * Convert len bytes of UTF-8 to the out buffer, the capacity of out is reused, so no allocation if it is big enough.
+	 * The embedded '\0' is converted too.
+	 * 
+	 * @param utf8str - UTF-8 bytes, not need to be terminated by '\0'
+	 * @param len - the bytes of utf8str
+	 * @param out - [out] the UTF-16 text
+	 * @return out
+	 */
+	static std::wstring & utf82Unicode(const char * utf8str, size_t len, std::wstring & out);
 
 	//Unicode ת Utf8 
 	static std::string unicode2Utf8(const std::wstring& widestring);
+	/**
+	 * Convert len chars of UTF-16 to the out buffer, the capacity of out is reused, so no allocation if it is big enough.
+	 * 
+	 * @param widestr - UTF-16 chars, not need to be terminated by '\0'
+	 * @param len - the chars of widestr
+	 * @param out - [out] the UTF-8 text
+	 * @return out
+	 */
+	static std::string & unicode2Utf8(const wchar_t * widestr, size_t len, std::string & out);
+
+	/**
+	 * Convert len bytes of UTF-8 to the caller buffer by one pass, the invalid sequence is replaced by U+FFFD.
+	 * 
+	 * @param utf8str - UTF-8 bytes
+	 * @param len - the bytes of utf8str
+	 * @param dest - [out] the buffer of len chars at least, one UTF-8 byte never produces more than one UTF-16 char
+	 * @return the chars written to dest, not terminated by '\0'
+	 */
+	static size_t utf8ToUtf16(const char * utf8str, size_t len, wchar_t * dest) noexcept;
+	/**
+	 * Convert len chars of UTF-16 to the caller buffer by one pass, the unpaired surrogate is replaced by U+FFFD.
+	 * 
+	 * @param widestr - UTF-16 chars
+	 * @param len - the chars of widestr
+	 * @param dest - [out] the buffer of len * 3 bytes at least, one UTF-16 char never produces more than 3 UTF-8 bytes
+	 * @return the bytes written to dest, not terminated by '\0'
+	 */
+	static size_t utf16ToUtf8(const wchar_t * widestr, size_t len, char * dest) noexcept;
 
 	//ascii ת Utf8 
 	static std::string ASCII2UTF_8(std::string& strAsciiCode);
@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   Utf8FileWriter.cpp
+ * @brief  Write the UTF-8 bytes to file through a large buffer.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#include "stdafx.h"
+#include "Utf8FileWriter.h"
+#include "Log.h"
+#include "core/common/exception/QRuntimeException.h"
+
+Utf8FileWriter::Utf8FileWriter(size_t bufferSize)
+{
+	buffer.resize(bufferSize > 0 ? bufferSize : UTF8_WRITER_BUFFER_SIZE);
+}
+
+Utf8FileWriter::~Utf8FileWriter()
+{
+	try {
+		close();
+	} catch (QRuntimeException &ex) {
+		Q_ERROR(L"close file has error:{}, msg:{}", ex.getCode(), ex.getMsg());
+	}
+}
+
+/**
+ * Open and truncate the file.
+ *
+ * @param path - the file path
+ * @param withBom - write the UTF-8 BOM at the begin of file
+ */
+void Utf8FileWriter::open(const std::wstring & path, bool withBom)
+{
+	close();
+	errno_t _err;
+	wchar_t _err_buf[256] = { 0 };
+	_err = _wfopen_s(&file, path.c_str(), L"wb");
+	if (_err != 0 || file == NULL) {
+		file = nullptr;
+		_wcserror_s(_err_buf, 256, _err);
+		Q_ERROR(L"open file for writing has error:{}, path:{}", _err_buf, path);
+		throw QRuntimeException(std::to_wstring(_err), _err_buf);
+	}
+	filePath = path;
+	pos = 0;
+	writtenBytes = 0;
+	if (withBom) {
+		write("\xEF\xBB\xBF", 3);
+	}
+}
+
+void Utf8FileWriter::close()
+{
+	if (!file) {
+		return;
+	}
+	flush();
+	fclose(file);
+	file = nullptr;
+}
+
+/**
+ * Append the bytes to the buffer, the big bytes that exceed the buffer are written to file directly.
+ *
+ * @param bytes - the UTF-8 bytes
+ * @param len - the size of bytes
+ */
+void Utf8FileWriter::write(const char * bytes, size_t len)
+{
+	if (!len) {
+		return;
+	}
+	if (pos + len > buffer.size()) {
+		flush();
+		if (len >= buffer.size()) {
+			if (fwrite(bytes, 1, len, file) != len) {
+				Q_ERROR(L"write file has error, path:{}", filePath);
+				throw QRuntimeException(L"200101", L"write file has error");
+			}
+			writtenBytes += len;
+			return;
+		}
+	}
+	memcpy(buffer.data() + pos, bytes, len);
+	pos += len;
+}
+
+void Utf8FileWriter::write(const std::wstring & str)
+{
+	if (str.empty()) {
+		return;
+	}
+	int len = static_cast<int>(str.size());
+	int bytes = ::WideCharToMultiByte(CP_UTF8, 0, str.c_str(), len, nullptr, 0, nullptr, nullptr);
+	if (bytes <= 0) {
+		return;
+	}
+	if (pos + bytes > buffer.size()) {
+		flush();
+	}
+	if (static_cast<size_t>(bytes) <= buffer.size()) {
+		// convert to the buffer directly
+		::WideCharToMultiByte(CP_UTF8, 0, str.c_str(), len, buffer.data() + pos, bytes, nullptr, nullptr);
+		pos += bytes;
+		return;
+	}
+	std::string utf8(bytes, '\0');
+	::WideCharToMultiByte(CP_UTF8, 0, str.c_str(), len, &utf8[0], bytes, nullptr, nullptr);
+	write(utf8.data(), utf8.size());
+}
+
+void Utf8FileWriter::flush()
+{
+	if (!file || !pos) {
+		return;
+	}
+	size_t n = pos;
+	pos = 0;
+	if (fwrite(buffer.data(), 1, n, file) != n) {
+		Q_ERROR(L"write file has error, path:{}", filePath);
+		throw QRuntimeException(L"200101", L"write file has error");
+	}
+	writtenBytes += n;
+}
@@ -0,0 +1,66 @@
+/*****************************************************************//**
+ * Copyright 2023 Xuehan Qin
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+ * limitations under the License.
+
+ * @file   Utf8FileWriter.h
+ * @brief  Write the UTF-8 bytes to file through a large buffer.
+ *         The bytes are copied to the buffer and written to file only when the buffer is full,
+ *         no locale conversion and no flush per line.
+ *
+ * @author Xuehan Qin
+ * @date   2026-10-17
+ *********************************************************************/
+#pragma once
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// the buffer size of Utf8FileWriter
+#define UTF8_WRITER_BUFFER_SIZE (1024 * 1024)
+
+class Utf8FileWriter
+{
+public:
+	Utf8FileWriter(size_t bufferSize = UTF8_WRITER_BUFFER_SIZE);
+	~Utf8FileWriter();
+
+	// open and truncate the file, throw QRuntimeException if the file can't be opened
+	void open(const std::wstring & path, bool withBom = true);
+	void close();
+	bool isOpen() const { return file != nullptr; }
+
+	void write(const char * bytes, size_t len);
+	void write(const char * str) { write(str, strlen(str)); }
+	void write(const std::string & str) { write(str.data(), str.size()); }
+	// convert the wide chars to UTF-8 and write them
+	void write(const std::wstring & str);
+	void write(char ch)
+	{
+		if (pos == buffer.size()) {
+			flush();
+		}
+		buffer[pos++] = ch;
+	}
+	// write the line terminator "\r\n"
+	void writeLine() { write("\r\n", 2); }
+	void flush();
+
+	uint64_t getWrittenBytes() const { return writtenBytes + pos; }
+private:
+	FILE * file = nullptr;
+	std::wstring filePath;
+	std::vector<char> buffer;
+	size_t pos = 0;
+	uint64_t writtenBytes = 0;
+};
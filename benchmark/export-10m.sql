@@ -0,0 +1,8 @@
+-- The 10,000,000-row table of the export benchmark, run it in an empty database:
+--   sqlite3 export-10m.db < export-10m.sql
+-- then open export-10m.db, execute "SELECT * FROM t" in the query page and export the result.
+-- Every tenth note is NULL, the others have quotes to escape.
+CREATE TABLE t(id INTEGER PRIMARY KEY, name TEXT, score REAL, note TEXT);
+WITH RECURSIVE n(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM n WHERE x < 10000000)
+INSERT INTO t(id, name, score, note)
+	SELECT x, 'user_' || x, x * 0.25, CASE WHEN x % 10 = 0 THEN NULL ELSE 'note "' || (x % 97) || '" here' END FROM n;
@@ -0,0 +1,7 @@
+-- The 1,000,000-row result of the result grid benchmark, run it in an empty database:
+--   sqlite3 result-1m.db < result-1m.sql
+-- then open result-1m.db and execute "SELECT * FROM result_1m" in the query page.
+CREATE TABLE result_1m(id INTEGER PRIMARY KEY, name TEXT, score REAL, note TEXT);
+WITH RECURSIVE n(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM n WHERE x < 1000000)
+INSERT INTO result_1m(id, name, score, note)
+	SELECT x, 'name ' || x, (x * 7919 % 100000) / 100.0, 'note of the row ' || x || ', ' || hex(randomblob(8)) FROM n;
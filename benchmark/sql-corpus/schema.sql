@@ -0,0 +1,6 @@
+-- The tables that the cases of select-tables.sql refer to.
+CREATE TABLE t1(a INTEGER PRIMARY KEY, b TEXT, x INTEGER);
+CREATE TABLE t2(a INTEGER PRIMARY KEY, b TEXT, x INTEGER);
+CREATE TABLE t3(a INTEGER PRIMARY KEY, b TEXT, x INTEGER);
+CREATE TABLE "order"(id INTEGER PRIMARY KEY, "select" TEXT);
+CREATE INDEX t1_x ON t1(x);
@@ -0,0 +1,94 @@
+-- Every case is one statement after its "-- @expect" line.
+--   select : SqlUtil::isSelectSql()
+--   limit  : SqlUtil::hasLimitClause()
+--   tables : SqlUtil::getTablesFromSelectSql() with the tables of schema.sql, in the order of schema.sql
+-- The aliases, the schema names, the subqueries and the common table expressions are not tables of the result.
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1;
+
+-- @expect select=1 limit=0 tables=t1
+SELECT a, b FROM t1 WHERE b = 'from t2 join t3';
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 where a in (select a from t2);
+
+-- @expect select=1 limit=0 tables=t1
+select (select max(a) from t2) from t1;
+
+-- @expect select=1 limit=0 tables=t1
+select * from (select * from t2) x join t1 on x.a = t1.a;
+
+-- @expect select=1 limit=0 tables=t1
+with c as (select * from t2) select * from c, t1;
+
+-- @expect select=1 limit=0 tables=t1
+with recursive c(n) as (select 1 union all select n + 1 from c where n < 10) select * from t1, c;
+
+-- @expect select=1 limit=0 tables=t1,t3
+select a from t1 union select a from t3;
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 t2;
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 as t3;
+
+-- @expect select=1 limit=0 tables=t1
+select * from main.t1 a;
+
+-- @expect select=1 limit=0 tables=t1
+select * from "main"."t1" as "t2";
+
+-- @expect select=1 limit=0 tables=t1,t2
+select * from t1 a left outer join t2 b on a.x = b.x;
+
+-- @expect select=1 limit=0 tables=t1,t2
+select * from t1 a natural join t2 using (a);
+
+-- @expect select=1 limit=0 tables=t1,t2
+select * from t1 a, "t2" as t3 where a.a = t3.a;
+
+-- @expect select=1 limit=0 tables=t1,t2,t3
+select * from [t1], `t2`, t3 t;
+
+-- @expect select=1 limit=0 tables=
+select * from (select 1 as a) t2;
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 indexed by t1_x where x > 0;
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 not indexed;
+
+-- @expect select=1 limit=0 tables=
+select * from json_each('[1,2]') t1;
+
+-- @expect select=1 limit=0 tables=order
+select "select" from "order";
+
+-- @expect select=1 limit=1 tables=t1
+select * from t1 order by a desc limit 10 offset 5;
+
+-- @expect select=1 limit=0 tables=t1
+select * from t1 where a in (select a from t2 limit 1);
+
+-- @expect select=1 limit=1 tables=t1,t2
+select * from t1 /* from t3 */ join t2 on t1.a = t2.a -- from t3
+limit 1;
+
+-- @expect select=1 limit=0 tables=t1
+select
+	a,
+	case when b like '%limit%' then 'x' else b end
+from
+	t1;
+
+-- @expect select=0 limit=0 tables=
+update t1 set b = 'select * from t2' where a = 1;
+
+-- @expect select=0 limit=0 tables=
+insert into t1(b) select b from t2;
+
+-- @expect select=0 limit=0 tables=
+pragma table_info(t1);
@@ -0,0 +1,31 @@
+-- @statements 9
+-- SqlLexer::splitStatements() splits this file to the statements below, the ';' in the strings,
+-- the quoted identifiers, the comments and the trigger bodies don't end a statement.
+-- The statement that only has the comments is dropped.
+CREATE TABLE "a;b"(x TEXT, [y;z] TEXT, `w;v` TEXT);
+
+INSERT INTO "a;b" VALUES ('1;2', 'it''s; here', x'3b3b');
+
+/* ; */ -- ;
+SELECT 1 /* ; */, '--;' -- ;
+;
+
+CREATE TRIGGER tr1 AFTER INSERT ON "a;b" BEGIN
+	UPDATE "a;b" SET x = 'end;' WHERE x = NEW.x;
+	INSERT INTO "a;b"(x) VALUES (CASE WHEN NEW.x = 'a' THEN 'b;' ELSE 'c' END);
+END;
+
+CREATE TEMP TRIGGER IF NOT EXISTS tr2 BEFORE DELETE ON "a;b" FOR EACH ROW WHEN OLD.x <> ';' BEGIN
+	SELECT RAISE(ABORT, 'no;');
+END;
+
+CREATE VIEW v AS SELECT x AS "end" FROM "a;b";
+
+SELECT "end", 'BEGIN; END;' FROM v;
+
+-- only the comment ;
+/* and the block comment ; */ ;
+
+WITH c(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM c WHERE n < 3) SELECT n FROM c;
+
+SELECT 'the last statement has no semicolon'